@@ -165,6 +165,56 @@ class liggghts:
   def get_natoms(self):
     return self.lib.lammps_get_natoms(self.lmp)
 
+  # return numpy array viewing the per-atom quantity of the local atoms
+  # no data is copied, writing to the array changes the LIGGGHTS data
+  # the view is only valid until LIGGGHTS reallocates or reorders atoms,
+  # i.e. until the next run or command that adds, deletes or sorts atoms
+
+  def numpy_atom(self,name):
+    if name not in self.atom_layout: return None
+    type,count = self.atom_layout[name]
+    ptr = self.extract_atom(name,type)
+    if not ptr: return None
+    return self._numpy_view(ptr,type,count)
+
+  # return numpy array viewing the per-atom data of a fix for local atoms
+  # same validity rules as for numpy_atom()
+
+  def numpy_fix(self,f_id):
+    if self.pyVersion[0] == 3:
+      cf_id = f_id.encode()
+    else: cf_id = f_id
+    ncols = self.lib.lammps_extract_fix_peratom_cols(self.lmp,cf_id)
+    if ncols < 0: return None
+    if ncols == 0:
+      ptr = self.extract_fix(f_id,1,1)
+      if not ptr: return None
+      return self._numpy_view(ptr,2,1)
+    ptr = self.extract_fix(f_id,1,2)
+    if not ptr: return None
+    return self._numpy_view(ptr,3,ncols)
+
+  # per-atom quantities supported by numpy_atom(): name -> (type,count)
+  # type as for extract_atom()
+
+  atom_layout = {"id": (0,1), "type": (0,1), "mask": (0,1),
+                 "radius": (2,1), "rmass": (2,1), "density": (2,1),
+                 "x": (3,3), "v": (3,3), "f": (3,3),
+                 "omega": (3,3), "torque": (3,3)}
+
+  # 2d arrays are allocated contiguously, so wrap the first row pointer
+
+  def _numpy_view(self,ptr,type,count):
+    import numpy.ctypeslib
+    nlocal = self.extract_global("nlocal",0)
+    if nlocal == 0:
+      if type < 2: return numpy.zeros((0,count),dtype=numpy.intc)
+      return numpy.zeros((0,count))
+    if type == 1 or type == 3: ptr = ptr[0]
+    if count == 1:
+      return numpy.ctypeslib.as_array(ptr,shape=(nlocal,))
+    return numpy.ctypeslib.as_array(ptr,shape=(nlocal,count))
+
   # return vector of atom properties gathered across procs, ordered by atom ID
 
   def gather_atoms(self,name,type,count):
@@ -180,6 +230,22 @@ class liggghts:
     else: return None
     return data
 
+  # return vector of atom properties gathered on proc 0, ordered by atom ID
+  # returns None on all other procs, only proc 0 allocates natoms values
+  # must be called on all procs
+
+  def gather_atoms_root(self,name,type,count):
+    if self.pyVersion[0] == 3:
+      name = name.encode()
+    if type != 0 and type != 1: return None
+    natoms = self.lib.lammps_get_natoms(self.lmp)
+    data = None
+    if self.extract_global("me",0) == 0:
+      if type == 0: data = ((count*natoms)*c_int)()
+      else: data = ((count*natoms)*c_double)()
+    self.lib.lammps_gather_atoms_root(self.lmp,name,type,count,data)
+    return data
+
   # scatter vector of atom properties across procs, ordered by atom ID
   # assume vector is of correct type and length, as created by gather_atoms()
 
@@ -333,6 +333,18 @@ int MPI_Allreduce(void *sendbuf, void *recvbuf, int count,
 
 /* ---------------------------------------------------------------------- */
 
+/* copy values from data1 to data2, request is complete on return */
+
+int MPI_Iallreduce(void *sendbuf, void *recvbuf, int count,
+                   MPI_Datatype datatype, MPI_Op op, MPI_Comm comm,
+                   MPI_Request *request)
+{
+  *request = 0;
+  return MPI_Allreduce(sendbuf,recvbuf,count,datatype,op,comm);
+}
+
+/* ---------------------------------------------------------------------- */
+
 /* copy values from data1 to data2 */
 
 int MPI_Reduce(void *sendbuf, void *recvbuf, int count,
@@ -353,6 +365,18 @@ int MPI_Reduce(void *sendbuf, void *recvbuf, int count,
   return 0;
 }
 
+/* ---------------------------------------------------------------------- */
+
+/* copy values from data1 to data2, request is complete on return */
+
+int MPI_Ireduce(void *sendbuf, void *recvbuf, int count,
+                MPI_Datatype datatype, MPI_Op op, int root, MPI_Comm comm,
+                MPI_Request *request)
+{
+  *request = 0;
+  return MPI_Reduce(sendbuf,recvbuf,count,datatype,op,root,comm);
+}
+
 
 /* ---------------------------------------------------------------------- */
 
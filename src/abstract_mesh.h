@@ -105,6 +105,8 @@ namespace LAMMPS_NS
 
         virtual void initialSetup() = 0;
         virtual void pbcExchangeBorders(int setupFlag) = 0;
+        virtual bool pbcExchangeBordersBegin(int setupFlag) = 0;
+        virtual void pbcExchangeBordersEnd(int setupFlag) = 0;
         virtual void clearReverse() = 0;
         virtual void forwardComm(std::list<std::string> * properties = NULL) = 0;
         virtual void forwardComm(std::string) = 0;
@@ -40,19 +40,68 @@
 ------------------------------------------------------------------------- */
 
 #include "atom_vec_sphere.h"
+#include "atom.h"
+#include "modify.h"
+#include "fix.h"
 #include "domain_wedge.h"
 
-#ifndef DOMAIN_WEDGE_REAL_H
-#define DOMAIN_WEDGE_REAL_H
-
 using namespace LAMMPS_NS;
 
-/* ---------------------------------------------------------------------- */
+/* ----------------------------------------------------------------------
+   ghost communication for rotationally periodic (wedge) domains
+   ghosts sent across a wedge face are rotated by +/- the wedge angle
+   (pbc[iphi]) together with their velocity and angular velocity,
+   ghosts sent across the axis boundaries are shifted as usual
+------------------------------------------------------------------------- */
 
 int AtomVecSphere::pack_border_vel_wedge(int n, int *list, double *buf,
                                      int pbc_flag, int *pbc)
 {
-    return 0;
+  DomainWedge *dw = static_cast<DomainWedge*>(domain);
+  const int iaxis = dw->index_axis();
+  int i,j,m,sign;
+  double shift[3],xj[3],vj[3],omegaj[3];
+
+  shift[0] = shift[1] = shift[2] = 0.;
+  sign = 0;
+  if (pbc_flag) {
+    shift[iaxis] = pbc[iaxis]*domain->prd[iaxis];
+    sign = pbc[dw->index_phi()];
+  }
+
+  m = 0;
+  for (i = 0; i < n; i++) {
+    j = list[i];
+    vectorAdd3D(x[j],shift,xj);
+    vectorCopy3D(v[j],vj);
+    vectorCopy3D(omega[j],omegaj);
+    if (sign) {
+      dw->rotate_point(xj,sign);
+      dw->rotate_vector(vj,sign);
+      dw->rotate_vector(omegaj,sign);
+    }
+    buf[m++] = xj[0];
+    buf[m++] = xj[1];
+    buf[m++] = xj[2];
+    buf[m++] = ubuf(tag[j]).d;
+    buf[m++] = ubuf(type[j]).d;
+    buf[m++] = ubuf(mask[j]).d;
+    buf[m++] = radius[j];
+    buf[m++] = rmass[j];
+    buf[m++] = density[j];
+    buf[m++] = vj[0];
+    buf[m++] = vj[1];
+    buf[m++] = vj[2];
+    buf[m++] = omegaj[0];
+    buf[m++] = omegaj[1];
+    buf[m++] = omegaj[2];
+  }
+
+  if (atom->nextra_border)
+    for (int iextra = 0; iextra < atom->nextra_border; iextra++)
+      m += modify->fix[atom->extra_border[iextra]]->pack_border(n,list,&buf[m]);
+
+  return m;
 }
 
 /* ---------------------------------------------------------------------- */
@@ -60,7 +109,45 @@ int AtomVecSphere::pack_border_vel_wedge(int n, int *list, double *buf,
 int AtomVecSphere::pack_comm_vel_wedge(int n, int *list, double *buf,
                                    int pbc_flag, int *pbc)
 {
-    return 0;
+  DomainWedge *dw = static_cast<DomainWedge*>(domain);
+  const int iaxis = dw->index_axis();
+  int i,j,m,sign;
+  double shift[3],xj[3],vj[3],omegaj[3];
+
+  shift[0] = shift[1] = shift[2] = 0.;
+  sign = 0;
+  if (pbc_flag) {
+    shift[iaxis] = pbc[iaxis]*domain->prd[iaxis];
+    sign = pbc[dw->index_phi()];
+  }
+
+  m = 0;
+  for (i = 0; i < n; i++) {
+    j = list[i];
+    vectorAdd3D(x[j],shift,xj);
+    vectorCopy3D(v[j],vj);
+    vectorCopy3D(omega[j],omegaj);
+    if (sign) {
+      dw->rotate_point(xj,sign);
+      dw->rotate_vector(vj,sign);
+      dw->rotate_vector(omegaj,sign);
+    }
+    buf[m++] = xj[0];
+    buf[m++] = xj[1];
+    buf[m++] = xj[2];
+    if (radvary) {
+      buf[m++] = ubuf(type[j]).d;
+      buf[m++] = radius[j];
+      buf[m++] = rmass[j];
+      buf[m++] = density[j];
+    }
+    buf[m++] = vj[0];
+    buf[m++] = vj[1];
+    buf[m++] = vj[2];
+    buf[m++] = omegaj[0];
+    buf[m++] = omegaj[1];
+    buf[m++] = omegaj[2];
+  }
+
+  return m;
 }
-
-#endif
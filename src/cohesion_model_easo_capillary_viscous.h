@@ -457,7 +457,7 @@ namespace ContactModels {
               // assume liquid distributes evenly
               double *liquidFlux = fix_liquidflux->vector_atom;
               
-              const double invdt = 1./update->dt;
+              const double invdt = 1./scdata.dt;
               const double rad_ratio = radj/radi;
               const double split_factor = 1.0/(1.0+rad_ratio*rad_ratio*rad_ratio);
               // liquid flux is in vol% per time
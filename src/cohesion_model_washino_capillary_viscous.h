@@ -510,7 +510,7 @@ namespace ContactModels {
               // assume liquid distributes evenly
               double *liquidFlux = fix_liquidflux->vector_atom;
               
-              const double invdt = 1./update->dt;
+              const double invdt = 1./scdata.dt;
               const double rad_ratio = radj/radi;
               const double split_factor = 1.0/(1.0+rad_ratio*rad_ratio*rad_ratio);
               // liquid flux is in vol% per time
@@ -524,7 +524,7 @@ namespace ContactModels {
           {
               // assume liquid distributes evenly
               double *liquidFlux = fix_liquidflux->vector_atom;
-              const double invdt = 1./update->dt;
+              const double invdt = 1./scdata.dt;
               // liquid flux in vol per time
               double volFlux = invdt*(0.5 * volBond1000 - volumeFraction*volLi1000);
               // liquid flux in vol% per time for particle
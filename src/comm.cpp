@@ -130,6 +130,7 @@ Comm::Comm(LAMMPS *lmp) : Pointers(lmp)
   cutghostmulti = NULL;
   cutghostuser = 0.0;
   ghost_velocity = 0;
+  overlap_flag = 0;
 
   // use of OpenMP threads
   // query OpenMP for number of threads/process set by user at run-time
@@ -173,6 +174,10 @@ Comm::Comm(LAMMPS *lmp) : Pointers(lmp)
   maxrecv = BUFMIN;
   memory->create(buf_recv,maxrecv,"comm:buf_recv");
 
+  noverlap = nrequest_overlap = 0;
+  buf_send_overlap = buf_recv_overlap = NULL;
+  maxsend_overlap = maxrecv_overlap = 0;
+
   maxswap = 6;
   allocate_swap(maxswap);
 
@@ -212,6 +217,8 @@ Comm::~Comm()
 
   memory->destroy(buf_send);
   memory->destroy(buf_recv);
+  memory->destroy(buf_send_overlap);
+  memory->destroy(buf_recv_overlap);
 }
 
 /* ----------------------------------------------------------------------
@@ -771,6 +778,127 @@ int Comm::updown(int dim, int dir, int loc,
 ------------------------------------------------------------------------- */
 
 void Comm::forward_comm(int dummy)
+{
+  forward_comm_swaps(0);
+}
+
+/* ----------------------------------------------------------------------
+   post forward comm of the first pair of swaps without waiting for it
+   these swaps only send owned atoms, so they do not depend on each other
+   pair computation of interior atoms can proceed while they are in flight
+   must be followed by forward_comm_finish() before ghosts are accessed
+------------------------------------------------------------------------- */
+
+void Comm::forward_comm_start()
+{
+  int iswap,n;
+  AtomVec *avec = atom->avec;
+  double **x = atom->x;
+  double *buf;
+
+  noverlap = MIN(2,nswap);
+  nrequest_overlap = 0;
+
+  // posted swaps need their own buffers since their data stays in flight
+
+  int nsend = 0;
+  int nrecv = 0;
+  for (iswap = 0; iswap < noverlap; iswap++) {
+    if (sendproc[iswap] == me) continue;
+    nsend += sendnum[iswap]*size_forward;
+    if (!comm_x_only) nrecv += size_forward_recv[iswap];
+  }
+  if (nsend > maxsend_overlap) {
+    maxsend_overlap = static_cast<int> (BUFFACTOR * nsend);
+    memory->destroy(buf_send_overlap);
+    memory->create(buf_send_overlap,maxsend_overlap,"comm:buf_send_overlap");
+  }
+  if (nrecv > maxrecv_overlap) {
+    maxrecv_overlap = static_cast<int> (BUFFACTOR * nrecv);
+    memory->destroy(buf_recv_overlap);
+    memory->create(buf_recv_overlap,maxrecv_overlap,"comm:buf_recv_overlap");
+  }
+
+  // post recvs and sends with another proc
+  // if other proc is self, just copy as in forward_comm()
+
+  nsend = nrecv = 0;
+  for (iswap = 0; iswap < noverlap; iswap++) {
+    if (sendproc[iswap] != me) {
+      if (size_forward_recv[iswap]) {
+        if (comm_x_only) buf = x[firstrecv[iswap]];
+        else buf = &buf_recv_overlap[nrecv];
+        MPI_Irecv(buf,size_forward_recv[iswap],MPI_DOUBLE,recvproc[iswap],0,
+                  world,&request_overlap[nrequest_overlap++]);
+      }
+      offset_overlap[iswap] = nrecv;
+      if (!comm_x_only) nrecv += size_forward_recv[iswap];
+
+      if (ghost_velocity && !comm_x_only)
+        n = avec->pack_comm_vel(sendnum[iswap],sendlist[iswap],
+                                &buf_send_overlap[nsend],
+                                pbc_flag[iswap],pbc[iswap]);
+      else
+        n = avec->pack_comm(sendnum[iswap],sendlist[iswap],
+                            &buf_send_overlap[nsend],
+                            pbc_flag[iswap],pbc[iswap]);
+      if (n) MPI_Isend(&buf_send_overlap[nsend],n,MPI_DOUBLE,sendproc[iswap],
+                       0,world,&request_overlap[nrequest_overlap++]);
+      nsend += n;
+
+    } else {
+      if (comm_x_only) {
+        if (sendnum[iswap])
+          n = avec->pack_comm(sendnum[iswap],sendlist[iswap],
+                              x[firstrecv[iswap]],pbc_flag[iswap],
+                              pbc[iswap]);
+      } else if (ghost_velocity) {
+        n = avec->pack_comm_vel(sendnum[iswap],sendlist[iswap],
+                                buf_send,pbc_flag[iswap],pbc[iswap]);
+        avec->unpack_comm_vel(recvnum[iswap],firstrecv[iswap],buf_send);
+      } else {
+        n = avec->pack_comm(sendnum[iswap],sendlist[iswap],
+                            buf_send,pbc_flag[iswap],pbc[iswap]);
+        avec->unpack_comm(recvnum[iswap],firstrecv[iswap],buf_send);
+      }
+    }
+  }
+}
+
+/* ----------------------------------------------------------------------
+   wait for swaps posted by forward_comm_start() and unpack them
+   remaining swaps forward ghosts received in earlier swaps,
+   so they are done in order as in forward_comm()
+------------------------------------------------------------------------- */
+
+void Comm::forward_comm_finish()
+{
+  MPI_Status status[4];
+  AtomVec *avec = atom->avec;
+
+  if (nrequest_overlap) MPI_Waitall(nrequest_overlap,request_overlap,status);
+  nrequest_overlap = 0;
+
+  if (!comm_x_only) {
+    for (int iswap = 0; iswap < noverlap; iswap++) {
+      if (sendproc[iswap] == me) continue;
+      if (ghost_velocity)
+        avec->unpack_comm_vel(recvnum[iswap],firstrecv[iswap],
+                              &buf_recv_overlap[offset_overlap[iswap]]);
+      else
+        avec->unpack_comm(recvnum[iswap],firstrecv[iswap],
+                          &buf_recv_overlap[offset_overlap[iswap]]);
+    }
+  }
+
+  forward_comm_swaps(noverlap);
+}
+
+/* ----------------------------------------------------------------------
+   forward comm of atom coords for swaps ifirst to nswap-1
+------------------------------------------------------------------------- */
+
+void Comm::forward_comm_swaps(int ifirst)
 {
   int n;
   MPI_Request request;
@@ -783,7 +911,7 @@ void Comm::forward_comm(int dummy)
   // if other proc is self, just copy
   // if comm_x_only set, exchange or copy directly to x, don't unpack
 
-  for (int iswap = 0; iswap < nswap; iswap++) {
+  for (int iswap = ifirst; iswap < nswap; iswap++) {
     if (sendproc[iswap] != me) {
       if (comm_x_only) {
         if (size_forward_recv[iswap]) buf = x[firstrecv[iswap]];
@@ -1924,6 +2052,12 @@ void Comm::set(int narg, char **arg)
       else if (strcmp(arg[iarg+1],"no") == 0) ghost_velocity = 0;
       else error->all(FLERR,"Illegal communicate command");
       iarg += 2;
+    } else if (strcmp(arg[iarg],"overlap") == 0) {
+      if (iarg+2 > narg) error->all(FLERR,"Illegal communicate command");
+      if (strcmp(arg[iarg+1],"yes") == 0) overlap_flag = 1;
+      else if (strcmp(arg[iarg+1],"no") == 0) overlap_flag = 0;
+      else error->all(FLERR,"Illegal communicate command");
+      iarg += 2;
     } else error->all(FLERR,"Illegal communicate command");
   }
 }
@@ -80,6 +80,7 @@ class Comm : protected Pointers {
   int maxexchange_atom;             // max contribution to exchange from AtomVec
   int maxexchange_fix;              // max contribution to exchange from Fixes
   int nthreads;                     // OpenMP threads per MPI process
+  int overlap_flag;                 // 1 if forward comm may overlap pair compute
 
   //exchange events recorder
   
@@ -95,6 +96,8 @@ class Comm : protected Pointers {
   virtual void set_proc_grid(int outflag = 1); // setup 3d grid of procs
   virtual void setup();                       // setup 3d comm pattern
   virtual void forward_comm(int dummy = 0);   // forward comm of atom coords
+  virtual void forward_comm_start();          // post first forward comm swaps
+  virtual void forward_comm_finish();         // complete forward comm
   virtual void reverse_comm();                // reverse comm of forces
   virtual void exchange();                    // move atoms to new procs
   virtual void borders();                     // setup list of atoms to comm
@@ -168,9 +171,18 @@ class Comm : protected Pointers {
   int maxsend,maxrecv;              // current size of send/recv buffer
   int maxforward,maxreverse;        // max # of datums in forward/reverse comm
 
+  int noverlap;                     // # of swaps posted by forward_comm_start
+  int nrequest_overlap;             // # of pending requests of these swaps
+  MPI_Request request_overlap[4];   // pending send/recv requests
+  int offset_overlap[2];            // offset of each swap in recv buffer
+  double *buf_send_overlap;         // send buffer for posted swaps
+  double *buf_recv_overlap;         // recv buffer for posted swaps
+  int maxsend_overlap,maxrecv_overlap;
+
   int maxexchange;                  // max # of datums/atom in exchange comm
   int bufextra;                     // extra space beyond maxsend in send buffer
 
+  void forward_comm_swaps(int);             // forward comm from a swap on
   int updown(int, int, int, double, int, double *);
                                             // compare cutoff to procs
   virtual void grow_send(int,int);          // reallocate send buffer
@@ -76,6 +76,11 @@ ComputePairGranLocal::ComputePairGranLocal(LAMMPS *lmp, int &iarg, int narg, cha
   local_flag = 1;
   nmax = 0;
   array = NULL;
+  rec_i = rec_j = NULL;
+  capture_step = -1;
+
+  // store invocation steps, so data can be captured in the force pass
+  timeflag = 1;
 
   // store everything by default expect heat flux
   posflag = velflag = idflag = fflag = torqueflag = histflag = areaflag = 1;
@@ -132,6 +137,8 @@ ComputePairGranLocal::ComputePairGranLocal(LAMMPS *lmp, int &iarg, int narg, cha
 ComputePairGranLocal::~ComputePairGranLocal()
 {
   memory->destroy(array);
+  memory->destroy(rec_i);
+  memory->destroy(rec_j);
 
   if(reference_exists == 0) return;
 }
@@ -303,6 +310,15 @@ void ComputePairGranLocal::compute_local()
 
   if(!reference_exists) error->one(FLERR,"Compute pair/gran/local or wall/gran/local reference does no longer exist (pair or fix deleted)");
 
+  // data has been captured in the force pass of this step
+  // only velocities have changed since
+
+  if(capture_step == update->ntimestep)
+  {
+      refresh_captured_velocities();
+      return;
+  }
+
   // count local entries and compute pair info
 
   int nCountSurfacesIntersect(0);
@@ -336,6 +352,60 @@ void ComputePairGranLocal::compute_local()
   }
 }
 
+/* ----------------------------------------------------------------------
+   called by pair gran or fix wall/gran before the regular force pass
+   if compute_local() will be invoked on this step, prepare to fill the
+   array in that pass, so contacts need not be evaluated a second time
+   the array grows as needed, so pairs are not counted beforehand
+------------------------------------------------------------------------- */
+
+bool ComputePairGranLocal::capture_due()
+{
+  if(!reference_exists || !matchstep(update->ntimestep)) return false;
+
+  ipair = 0;
+  size_local_rows = 0;
+  capture_step = update->ntimestep;
+  return true;
+}
+
+/* ----------------------------------------------------------------------
+   called by heat transfer fix before its regular pass
+   heat flux is written to the rows of the pair data captured this step
+------------------------------------------------------------------------- */
+
+bool ComputePairGranLocal::rewind_for_heat()
+{
+  if(capture_step != update->ntimestep) return false;
+
+  ipair = 0;
+  return true;
+}
+
+/* ----------------------------------------------------------------------
+   velocities are stored at end of step, not at the time of the force pass
+------------------------------------------------------------------------- */
+
+void ComputePairGranLocal::refresh_captured_velocities()
+{
+  if(!velflag) return;
+
+  double **v = atom->v;
+  const int iv1 = offset_v1();
+  const int iv2 = offset_v2();
+
+  for(int irow = 0; irow < size_local_rows; irow++)
+  {
+      if(wall == 0)
+      {
+          vectorCopy3D(v[rec_i[irow]],&array[irow][iv1]);
+          vectorCopy3D(v[rec_j[irow]],&array[irow][iv2]);
+      }
+      else
+          vectorCopy3D(v[rec_i[irow]],&array[irow][iv2]);
+  }
+}
+
 /* ----------------------------------------------------------------------
    count pairs on this proc
 ------------------------------------------------------------------------- */
@@ -436,11 +506,9 @@ void ComputePairGranLocal::add_pair(int i,int j,double fx,double fy,double fz,do
     vi = atom->v[i];
     vj = atom->v[j];
 
-    if(ipair>=nmax)
-    {
-        if(screen) fprintf(screen,"ipair: %d, ncount: %d. \n", ipair, ncount);
-        error->one(FLERR,"Attempt to add_pair, but number of pairs (nmax) is too small. Try to increase contact_distance_factor via an appropriate neigh_modify command!");
-    }
+    if(ipair >= nmax) reallocate(ipair+1);
+    rec_i[ipair] = i;
+    rec_j[ipair] = j;
 
     int n = 0;
     if(posflag)
@@ -622,6 +690,7 @@ void ComputePairGranLocal::add_heat(int i,int j,double hf)
     if(heatflag)
     {
         // heat flux is always last value
+        if(ipair >= nmax) reallocate(ipair+1);
         array[ipair][nvalues-1] = hf;
         
     }
@@ -649,6 +718,10 @@ void ComputePairGranLocal::add_wall_1(int iFMG,int idTri,int iP,double *contact_
 {
     if (!(atom->mask[iP] & groupbit)) return;
 
+    if(ipair >= nmax) reallocate(ipair+1);
+    rec_i[ipair] = iP;
+    rec_j[ipair] = -1;
+
     int n = 0;
 
     if(posflag)
@@ -887,12 +960,13 @@ void ComputePairGranLocal::add_heat_wall(int ip,double hf)
 
 void ComputePairGranLocal::reallocate(int n)
 {
-  // grow vector or array and indices array
+  // grow array and indices array, keep rows already filled
 
   while (nmax < n) nmax += DELTA;
 
-  memory->destroy(array);
-  memory->create(array,nmax,nvalues,"pair/local:array");
+  memory->grow(array,nmax,nvalues,"pair/local:array");
+  memory->grow(rec_i,nmax,"pair/local:rec_i");
+  memory->grow(rec_j,nmax,"pair/local:rec_j");
   array_local = array;
 }
 
@@ -903,6 +977,7 @@ void ComputePairGranLocal::reallocate(int n)
 double ComputePairGranLocal::memory_usage()
 {
   double bytes = nmax*nvalues * sizeof(double);
+  bytes += 2*nmax * sizeof(int);
   return bytes;
 }
 
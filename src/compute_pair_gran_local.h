@@ -79,6 +79,10 @@ class ComputePairGranLocal : public Compute {
   virtual void pair_finalize();
   int get_history_offset(const char * const name);
 
+  // capture of contact data in the regular force pass
+  bool capture_due();
+  bool rewind_for_heat();
+
   /* inline access */
 
   virtual bool decide_add(double *hist, double * &contact_pos)
@@ -194,10 +198,16 @@ class ComputePairGranLocal : public Compute {
   double *vector;
   double **array;
 
+  // step on which data was captured in the regular force pass
+  // and local atom indices of each row, -1 for walls
+  bigint capture_step;
+  int *rec_i,*rec_j;
+
   class NeighList *list;
 
   virtual int count_pairs(int &nCountWithOverlap);
   int count_wallcontacts(int &nCountWithOverlap);
+  void refresh_captured_velocities();
   void reallocate(int);
 };
 
@@ -0,0 +1,178 @@
+/* ----------------------------------------------------------------------
+    This is the
+
+    ██╗     ██╗ ██████╗  ██████╗  ██████╗ ██╗  ██╗████████╗███████╗
+    ██║     ██║██╔════╝ ██╔════╝ ██╔════╝ ██║  ██║╚══██╔══╝██╔════╝
+    ██║     ██║██║  ███╗██║  ███╗██║  ███╗███████║   ██║   ███████╗
+    ██║     ██║██║   ██║██║   ██║██║   ██║██╔══██║   ██║   ╚════██║
+    ███████╗██║╚██████╔╝╚██████╔╝╚██████╔╝██║  ██║   ██║   ███████║
+    ╚══════╝╚═╝ ╚═════╝  ╚═════╝  ╚═════╝ ╚═╝  ╚═╝   ╚═╝   ╚══════╝®
+
+    DEM simulation engine, released by
+    DCS Computing Gmbh, Linz, Austria
+    http://www.dcs-computing.com, office@dcs-computing.com
+
+    LIGGGHTS® is part of CFDEM®project:
+    http://www.liggghts.com | http://www.cfdem.com
+
+    Core developer and main author:
+    Christoph Kloss, christoph.kloss@dcs-computing.com
+
+    LIGGGHTS® is open-source, distributed under the terms of the GNU Public
+    License, version 2 or later. It is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+    of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. You should have
+    received a copy of the GNU General Public License along with LIGGGHTS®.
+    If not, see http://www.gnu.org/licenses . See also top-level README
+    and LICENSE files.
+
+    LIGGGHTS® and CFDEM® are registered trade marks of DCS Computing GmbH,
+    the producer of the LIGGGHTS® software and the CFDEM®coupling software
+    See http://www.cfdem.com/terms-trademark-policy for details.
+
+-------------------------------------------------------------------------
+    Contributing author and copyright for this file:
+    (if not contributing author is listed, this file has been contributed
+    by the core developer)
+
+    Copyright 2012-     DCS Computing GmbH, Linz
+------------------------------------------------------------------------- */
+
+#include <mpi.h>
+#include "compute_timing.h"
+#include "timer.h"
+#include "update.h"
+#include "modify.h"
+#include "fix.h"
+#include "comm.h"
+#include "memory.h"
+#include "error.h"
+
+using namespace LAMMPS_NS;
+
+// entries of global vector
+
+enum{LOOP,PAIR,NEIGH,COMM,OUTPUT,MODIFY,MESH_NEIGH,WALL_CONTACT,NVECTOR};
+
+/* ---------------------------------------------------------------------- */
+
+ComputeTiming::ComputeTiming(LAMMPS *lmp, int &iarg, int narg, char **arg) :
+  Compute(lmp, iarg, narg, arg),
+  nfix(0),
+  vector_one(NULL),
+  array_one(NULL)
+{
+  if (narg != iarg) error->all(FLERR,"Illegal compute timing command");
+
+  vector_flag = 1;
+  size_vector = NVECTOR;
+  extvector = 0;
+
+  array_flag = 1;
+  size_array_cols = 1 + FIX_TIME_N;
+  extarray = 0;
+
+  vector = NULL;
+  array = NULL;
+  allocate();
+}
+
+/* ---------------------------------------------------------------------- */
+
+ComputeTiming::~ComputeTiming()
+{
+  memory->destroy(vector);
+  memory->destroy(vector_one);
+  memory->destroy(array);
+  memory->destroy(array_one);
+}
+
+/* ----------------------------------------------------------------------
+   one row per fix, fixes may have been added or deleted since last run
+------------------------------------------------------------------------- */
+
+void ComputeTiming::allocate()
+{
+  memory->destroy(vector);
+  memory->destroy(vector_one);
+  memory->destroy(array);
+  memory->destroy(array_one);
+
+  nfix = modify->nfix;
+  size_array_rows = nfix;
+
+  memory->create(vector,NVECTOR,"timing:vector");
+  memory->create(vector_one,NVECTOR,"timing:vector_one");
+  if (nfix) {
+    memory->create(array,nfix,size_array_cols,"timing:array");
+    memory->create(array_one,nfix,size_array_cols,"timing:array_one");
+  }
+}
+
+/* ---------------------------------------------------------------------- */
+
+void ComputeTiming::init()
+{
+  if (modify->nfix != nfix) allocate();
+
+  if (!modify->timing && comm->me == 0)
+    error->warning(FLERR,"Compute timing: fix timings are only recorded with modify_timing on");
+}
+
+/* ----------------------------------------------------------------------
+   cumulative times of the current run, averaged over procs
+------------------------------------------------------------------------- */
+
+void ComputeTiming::compute_vector()
+{
+  invoked_vector = update->ntimestep;
+
+  double modify_time = 0.0;
+  for (int i = 0; i < modify->nfix; i++)
+    modify_time += modify->fix[i]->get_recorded_time();
+
+  // loop timer is only started after setup
+
+  if (update->whichflag && !update->setupflag)
+    vector_one[LOOP] = timer->elapsed(TIME_LOOP);
+  else vector_one[LOOP] = 0.0;
+  vector_one[PAIR] = timer->array[TIME_PAIR];
+  vector_one[NEIGH] = timer->array[TIME_NEIGHBOR];
+  vector_one[COMM] = timer->array[TIME_COMM];
+  vector_one[OUTPUT] = timer->array[TIME_OUTPUT];
+  vector_one[MODIFY] = modify_time;
+  vector_one[MESH_NEIGH] = timer->array[TIME_MESH_NEIGHBOR];
+  vector_one[WALL_CONTACT] = timer->array[TIME_WALL_CONTACT];
+
+  MPI_Allreduce(vector_one,vector,NVECTOR,MPI_DOUBLE,MPI_SUM,world);
+  for (int i = 0; i < NVECTOR; i++) vector[i] /= comm->nprocs;
+}
+
+/* ----------------------------------------------------------------------
+   row per fix: total time, then time per timestep stage
+------------------------------------------------------------------------- */
+
+void ComputeTiming::compute_array()
+{
+  invoked_array = update->ntimestep;
+
+  if (nfix == 0) return;
+
+  // fixes created during the run are only reported from the next run on
+
+  const int n = modify->nfix < nfix ? modify->nfix : nfix;
+  for (int i = 0; i < nfix; i++) {
+    for (int j = 0; j < size_array_cols; j++) array_one[i][j] = 0.0;
+    if (i >= n) continue;
+    Fix *fix = modify->fix[i];
+    array_one[i][0] = fix->get_recorded_time();
+    for (int j = 0; j < FIX_TIME_N; j++)
+      array_one[i][1+j] = fix->get_recorded_time(j);
+  }
+
+  MPI_Allreduce(&array_one[0][0],&array[0][0],nfix*size_array_cols,
+                MPI_DOUBLE,MPI_SUM,world);
+  for (int i = 0; i < nfix; i++)
+    for (int j = 0; j < size_array_cols; j++)
+      array[i][j] /= comm->nprocs;
+}
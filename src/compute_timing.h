@@ -32,46 +32,55 @@
 
 -------------------------------------------------------------------------
     Contributing author and copyright for this file:
-
-    Christoph Kloss (DCS Computing GmbH, Linz)
-    Christoph Kloss (JKU Linz)
-    Stefan Amberger (JKU Linz)
+    (if not contributing author is listed, this file has been contributed
+    by the core developer)
 
     Copyright 2012-     DCS Computing GmbH, Linz
-    Copyright 2009-2012 JKU Linz
 ------------------------------------------------------------------------- */
 
-#ifndef DOMAIN_WEDGE_H
-#define DOMAIN_WEDGE_H
-
-#include "domain.h"
-
-namespace LAMMPS_NS {
+#ifdef COMPUTE_CLASS
 
-class DomainWedge : public Domain
-{
+ComputeStyle(timing,ComputeTiming)
 
-  public:
+#else
 
-    DomainWedge(class LAMMPS *lmp) : Domain(lmp) {};
-    void set_domain(class RegWedge *rw) {}
+#ifndef LMP_COMPUTE_TIMING_H
+#define LMP_COMPUTE_TIMING_H
 
-    inline int index_axis()
-    { return 0; }
+#include "compute.h"
 
-    inline int index_phi()
-    { return 0; }
+namespace LAMMPS_NS {
 
-    inline void n1(double *_n1)
-    { }
+class ComputeTiming : public Compute {
+ public:
+  ComputeTiming(class LAMMPS *, int &iarg, int, char **);
+  ~ComputeTiming();
+  void init();
+  void compute_vector();
+  void compute_array();
 
-    inline void n2(double *_n2)
-    { }
+ private:
+  int nfix;
+  double *vector_one;
+  double **array_one;
 
-    inline void center(double *_c)
-    { }
+  void allocate();
 };
 
 }
 
 #endif
+#endif
+
+/* ERROR/WARNING messages:
+
+E: Illegal compute timing command
+
+Self-explanatory.  Check the input script syntax and compare to the
+documentation for the command.
+
+W: Compute timing: fix timings are only recorded with modify_timing on
+
+Self-explanatory.
+
+*/
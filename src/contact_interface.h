@@ -100,6 +100,10 @@ struct SurfacesCloseData {
   int computeflag;
   int shearupdate;
 
+  // time-step used by the contact models, e.g. to integrate the history
+  // can differ from update->dt for pairs evaluated at a coarser rate
+  double dt;
+
   SurfacesCloseData() :
     radi(0.0),
     radj(0.0),
@@ -125,7 +129,8 @@ struct SurfacesCloseData {
     reff(0.0),
 #endif
     computeflag(0),
-    shearupdate(0)
+    shearupdate(0),
+    dt(0.0)
   {}
 };
 
@@ -259,6 +259,20 @@ void CreateAtoms::command(int narg, char **arg)
   else if (style == RANDOM) add_random();
   else add_lattice();
 
+  // coarsegraining: scale default size and mass of new atoms
+  // by the cg factor of their type, as particle templates do
+
+  if (force->cg_active() && atom->radius_flag) {
+    double *radius = atom->radius;
+    double *rmass = atom->rmass_flag ? atom->rmass : NULL;
+    int *type = atom->type;
+    for (int i = nlocal_previous; i < atom->nlocal; i++) {
+      const double cg = force->cg(type[i]);
+      radius[i] *= cg;
+      if (rmass) rmass[i] *= cg*cg*cg;
+    }
+  }
+
   // invoke set_arrays() for fixes that need initialization of new atoms
 
   int nlocal = atom->nlocal;
@@ -324,10 +338,6 @@ void CreateAtoms::command(int narg, char **arg)
   //    nspecial[i][2] = 0;
   //  }
   //}
-
-  // error checks on coarsegraining
-  if(force->cg_active())
-    error->cg(FLERR,"create_atoms");
 }
 
 /* ----------------------------------------------------------------------
@@ -155,8 +155,8 @@ class Domain : protected Pointers {
   int closest_image(int, int);
   void closest_image(const double * const, const double * const,
                      double * const);
-  void remap(double *, tagint &);
-  void remap(double *);
+  virtual void remap(double *, tagint &);
+  virtual void remap(double *);
   void remap_near(double *, double *);
   void unmap(double *, tagint);
   void unmap(double *, tagint, double *);
@@ -149,8 +149,8 @@ inline double Domain::dist_subbox_borders(double* pos)
 
 inline void Domain::min_subbox_extent(double &min_extent,int &dim) 
 {
-    if(is_wedge)
-        error->one(FLERR,"missing implementation");
+    // for a wedge domain, the subbox spans the bounding box of the
+    // wedge in the plane, so this is an upper estimate in that case
 
     double delta[3];
     vectorSubtract3D(subhi,sublo,delta);
@@ -0,0 +1,419 @@
+/* ----------------------------------------------------------------------
+    This is the
+
+    ██╗     ██╗ ██████╗  ██████╗  ██████╗ ██╗  ██╗████████╗███████╗
+    ██║     ██║██╔════╝ ██╔════╝ ██╔════╝ ██║  ██║╚══██╔══╝██╔════╝
+    ██║     ██║██║  ███╗██║  ███╗██║  ███╗███████║   ██║   ███████╗
+    ██║     ██║██║   ██║██║   ██║██║   ██║██╔══██║   ██║   ╚════██║
+    ███████╗██║╚██████╔╝╚██████╔╝╚██████╔╝██║  ██║   ██║   ███████║
+    ╚══════╝╚═╝ ╚═════╝  ╚═════╝  ╚═════╝ ╚═╝  ╚═╝   ╚═╝   ╚══════╝®
+
+    DEM simulation engine, released by
+    DCS Computing Gmbh, Linz, Austria
+    http://www.dcs-computing.com, office@dcs-computing.com
+
+    LIGGGHTS® is part of CFDEM®project:
+    http://www.liggghts.com | http://www.cfdem.com
+
+    Core developer and main author:
+    Christoph Kloss, christoph.kloss@dcs-computing.com
+
+    LIGGGHTS® is open-source, distributed under the terms of the GNU Public
+    License, version 2 or later. It is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+    of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. You should have
+    received a copy of the GNU General Public License along with LIGGGHTS®.
+    If not, see http://www.gnu.org/licenses . See also top-level README
+    and LICENSE files.
+
+    LIGGGHTS® and CFDEM® are registered trade marks of DCS Computing GmbH,
+    the producer of the LIGGGHTS® software and the CFDEM®coupling software
+    See http://www.cfdem.com/terms-trademark-policy for details.
+
+-------------------------------------------------------------------------
+    Contributing author and copyright for this file:
+
+    Christoph Kloss (DCS Computing GmbH, Linz)
+    Christoph Kloss (JKU Linz)
+    Stefan Amberger (JKU Linz)
+
+    Copyright 2012-     DCS Computing GmbH, Linz
+    Copyright 2009-2012 JKU Linz
+------------------------------------------------------------------------- */
+
+#include <cmath>
+#include <string.h>
+#include "domain_wedge.h"
+#include "region_wedge.h"
+#include "atom.h"
+#include "atom_vec_sphere.h"
+#include "comm.h"
+#include "force.h"
+#include "modify.h"
+#include "neighbor.h"
+#include "fix_contact_history.h"
+#include "fix_wall_gran.h"
+#include "vector_liggghts.h"
+#include "error.h"
+
+using namespace LAMMPS_NS;
+
+/* ---------------------------------------------------------------------- */
+
+DomainWedge::DomainWedge(LAMMPS *lmp) :
+  Domain(lmp),
+  domain_set_(false),
+  iaxis_(2),
+  iphi_(0),
+  iplane_(1),
+  radius_(0.),
+  angle1_(0.),
+  angle_(0.),
+  cos_(1.),
+  sin_(0.),
+  nfix_history_(0),
+  fix_history_(0),
+  nfix_wall_history_(0),
+  fix_wall_history_(0)
+{
+  c_[0] = c_[1] = 0.;
+  n1_[0] = n1_[1] = 0.;
+  n2_[0] = n2_[1] = 0.;
+}
+
+/* ---------------------------------------------------------------------- */
+
+DomainWedge::~DomainWedge()
+{
+  delete [] fix_history_;
+  delete [] fix_wall_history_;
+}
+
+/* ---------------------------------------------------------------------- */
+
+void DomainWedge::init()
+{
+  Domain::init();
+
+  if(!domain_set_)
+    error->all(FLERR,"Domain wedge requires a wedge region passed to create_box");
+  if(!dynamic_cast<AtomVecSphere*>(atom->avec))
+    error->all(FLERR,"Domain wedge requires atom_style sphere");
+  if(!comm->ghost_velocity)
+    error->all(FLERR,"Domain wedge requires ghost atoms to store velocity");
+  if(force->newton_pair)
+    error->all(FLERR,"Domain wedge requires newton off");
+  if(comm->procgrid[iphi_] != 1 || comm->procgrid[iplane_] != 1)
+    error->all(FLERR,"Domain wedge requires 1 processor in the plane of the wedge");
+  if(deform_flag)
+    error->all(FLERR,"Domain wedge is not compatible with fix deform");
+
+  // contact history is stored in global coordinates and has to be
+  // rotated together with the atoms in pbc()
+
+  delete [] fix_history_;
+  nfix_history_ = modify->n_fixes_style_strict("contacthistory");
+  fix_history_ = new FixContactHistory*[nfix_history_];
+  for(int ifix = 0; ifix < nfix_history_; ifix++)
+    fix_history_[ifix] = static_cast<FixContactHistory*>
+        (modify->find_fix_style_strict("contacthistory",ifix));
+
+  delete [] fix_wall_history_;
+  const int nwall = modify->n_fixes_style("wall/gran");
+  fix_wall_history_ = new FixWallGran*[nwall];
+  nfix_wall_history_ = 0;
+  for(int ifix = 0; ifix < nwall; ifix++)
+  {
+    FixWallGran *fwg = static_cast<FixWallGran*>(modify->find_fix_style("wall/gran",ifix));
+    if(fwg->primitiveWall() && fwg->dnum() > 0)
+      fix_wall_history_[nfix_wall_history_++] = fwg;
+  }
+}
+
+/* ----------------------------------------------------------------------
+   set up box and wedge geometry from the region passed to create_box
+   in-plane boundary settings of the input script are overridden:
+   periodic (by rotation) in iphi, fixed in the other in-plane dim
+------------------------------------------------------------------------- */
+
+void DomainWedge::set_domain(RegWedge *rw)
+{
+  if(dimension == 2)
+    error->all(FLERR,"Domain wedge requires a 3d simulation");
+
+  iaxis_ = rw->axis - 'x';
+  iphi_ = (iaxis_+1) % 3;
+  iplane_ = (iphi_+1) % 3;
+
+  c_[0] = rw->c1;
+  c_[1] = rw->c2;
+  vectorCopy2D(rw->normal1,n1_);
+  vectorCopy2D(rw->normal2,n2_);
+  radius_ = rw->radius;
+  angle1_ = rw->angle1;
+  angle_ = rw->dang;
+  cos_ = cos(angle_);
+  sin_ = sin(angle_);
+
+  for(int i = 0; i < 3; i++)
+    for(int j = 0; j < 3; j++)
+      rotp_[i][j] = rotm_[i][j] = (i == j) ? 1. : 0.;
+  rotp_[iphi_][iphi_] = rotm_[iphi_][iphi_] = cos_;
+  rotp_[iplane_][iplane_] = rotm_[iplane_][iplane_] = cos_;
+  rotp_[iphi_][iplane_] = -sin_;
+  rotp_[iplane_][iphi_] = sin_;
+  rotm_[iphi_][iplane_] = sin_;
+  rotm_[iplane_][iphi_] = -sin_;
+
+  triclinic = 0;
+  boxlo[0] = rw->extent_xlo;
+  boxhi[0] = rw->extent_xhi;
+  boxlo[1] = rw->extent_ylo;
+  boxhi[1] = rw->extent_yhi;
+  boxlo[2] = rw->extent_zlo;
+  boxhi[2] = rw->extent_zhi;
+
+  boundary[iphi_][0] = boundary[iphi_][1] = 0;
+  boundary[iplane_][0] = boundary[iplane_][1] = 1;
+  periodicity[iphi_] = 1;
+  periodicity[iplane_] = 0;
+  xperiodic = periodicity[0];
+  yperiodic = periodicity[1];
+  zperiodic = periodicity[2];
+
+  nonperiodic = 1;
+  if (boundary[iaxis_][0] >= 2 || boundary[iaxis_][1] >= 2) nonperiodic = 2;
+
+  domain_set_ = true;
+}
+
+/* ----------------------------------------------------------------------
+   0 if point is inside the angular sector of the wedge
+   +1/-1 if it has to be rotated by +/- the wedge angle to get there
+------------------------------------------------------------------------- */
+
+int DomainWedge::side(const double *pos)
+{
+  double d[2];
+  d[0] = pos[iphi_] - c_[0];
+  d[1] = pos[iplane_] - c_[1];
+
+  if(vectorDot2D(n1_,d) <= 0. && vectorDot2D(n2_,d) <= 0.)
+    return 0;
+
+  // angle relative to the first face, wrapped to [-pi,pi)
+
+  double phi = atan2(d[1],d[0]) - angle1_;
+  while(phi < -M_PI) phi += 2.*M_PI;
+  while(phi >= M_PI) phi -= 2.*M_PI;
+
+  if(phi < 0.) return 1;
+  if(phi > angle_) return -1;
+  return 0;
+}
+
+/* ----------------------------------------------------------------------
+   rotate point into the angular sector, return net number of rotations
+------------------------------------------------------------------------- */
+
+int DomainWedge::rotate_into_wedge(double *x)
+{
+  const int nmax = static_cast<int>(2.*M_PI/angle_) + 1;
+  int s, n = 0, net = 0;
+
+  while((s = side(x)) != 0 && n++ < nmax)
+  {
+    rotate_point(x,s);
+    net += s;
+  }
+  return net;
+}
+
+/* ----------------------------------------------------------------------
+   rotate owned atom and its vector-valued properties
+------------------------------------------------------------------------- */
+
+void DomainWedge::rotate_atom(int i, int sign)
+{
+  rotate_point(atom->x[i],sign);
+  rotate_vector(atom->v[i],sign);
+  if(atom->omega)
+    rotate_vector(atom->omega[i],sign);
+
+  for(int ifix = 0; ifix < nfix_history_; ifix++)
+    fix_history_[ifix]->rotate_history(i, sign > 0 ? rotp_ : rotm_);
+  for(int ifix = 0; ifix < nfix_wall_history_; ifix++)
+    fix_wall_history_[ifix]->rotate_history(i, sign > 0 ? rotp_ : rotm_);
+}
+
+/* ----------------------------------------------------------------------
+   in-plane periodicity is realized by rotation, the periodic remap of
+   the base class must only act along the axis
+------------------------------------------------------------------------- */
+
+void DomainWedge::set_planar_periodicity(int flag)
+{
+  periodicity[iphi_] = flag;
+  xperiodic = periodicity[0];
+  yperiodic = periodicity[1];
+  zperiodic = periodicity[2];
+}
+
+/* ----------------------------------------------------------------------
+   rotate atoms that left the sector through one of its faces back in,
+   then remap periodically along the axis
+------------------------------------------------------------------------- */
+
+void DomainWedge::pbc()
+{
+  if(!domain_set_)
+  {
+    Domain::pbc();
+    return;
+  }
+
+  double **x = atom->x;
+  const int nlocal = atom->nlocal;
+  const int nmax = static_cast<int>(2.*M_PI/angle_) + 1;
+  int s, n;
+
+  for(int i = 0; i < nlocal; i++)
+  {
+    n = 0;
+    while((s = side(x[i])) != 0 && n++ < nmax)
+      rotate_atom(i,s);
+  }
+
+  set_planar_periodicity(0);
+  Domain::pbc();
+  set_planar_periodicity(1);
+}
+
+/* ---------------------------------------------------------------------- */
+
+void DomainWedge::remap(double *x, tagint &image)
+{
+  if(!domain_set_)
+  {
+    Domain::remap(x,image);
+    return;
+  }
+
+  rotate_into_wedge(x);
+  set_planar_periodicity(0);
+  Domain::remap(x,image);
+  set_planar_periodicity(1);
+}
+
+/* ---------------------------------------------------------------------- */
+
+void DomainWedge::remap(double *x)
+{
+  if(!domain_set_)
+  {
+    Domain::remap(x);
+    return;
+  }
+
+  rotate_into_wedge(x);
+  set_planar_periodicity(0);
+  Domain::remap(x);
+  set_planar_periodicity(1);
+}
+
+/* ----------------------------------------------------------------------
+   domain checks, see domain_I.h
+------------------------------------------------------------------------- */
+
+int DomainWedge::is_in_domain_wedge(double* pos)
+{
+  if(pos[iaxis_] < boxlo[iaxis_] || pos[iaxis_] > boxhi[iaxis_])
+    return 0;
+
+  double d[2];
+  d[0] = pos[iphi_] - c_[0];
+  d[1] = pos[iplane_] - c_[1];
+  if(vectorDot2D(d,d) > radius_*radius_)
+    return 0;
+
+  if(vectorDot2D(n1_,d) > 0. || vectorDot2D(n2_,d) > 0.)
+    return 0;
+  return 1;
+}
+
+/* ---------------------------------------------------------------------- */
+
+int DomainWedge::is_in_subdomain_wedge(double* pos)
+{
+  double d[2];
+  d[0] = pos[iphi_] - c_[0];
+  d[1] = pos[iplane_] - c_[1];
+  if(vectorDot2D(n1_,d) > 0. || vectorDot2D(n2_,d) > 0.)
+    return 0;
+
+  // the wedge is only decomposed along its axis
+
+  const double checklo = sublo[iaxis_] -
+    (MathExtraLiggghts::compDouble(sublo[iaxis_],boxlo[iaxis_]) ? SMALL_DMBRDR : 0.0);
+  const double checkhi = subhi[iaxis_] +
+    (MathExtraLiggghts::compDouble(subhi[iaxis_],boxhi[iaxis_]) ? SMALL_DMBRDR : 0.0);
+
+  if(pos[iaxis_] >= checklo && pos[iaxis_] < checkhi)
+    return 1;
+  return 0;
+}
+
+/* ---------------------------------------------------------------------- */
+
+int DomainWedge::is_in_extended_subdomain_wedge(double* pos)
+{
+  if(is_in_subdomain_wedge(pos))
+    return 1;
+
+  double d[2];
+  d[0] = pos[iphi_] - c_[0];
+  d[1] = pos[iplane_] - c_[1];
+  if(vectorDot2D(n1_,d) > 0. || vectorDot2D(n2_,d) > 0.)
+    return 0;
+
+  if(comm->procgrid[iaxis_] == 1)
+    return 1;
+  if(comm->myloc[iaxis_] == comm->procgrid[iaxis_]-1)
+    return pos[iaxis_] >= sublo[iaxis_];
+  if(comm->myloc[iaxis_] == 0)
+    return pos[iaxis_] <= subhi[iaxis_];
+  return 0;
+}
+
+/* ---------------------------------------------------------------------- */
+
+double DomainWedge::dist_subbox_borders_wedge(double* pos)
+{
+  double d[2];
+  d[0] = pos[iphi_] - c_[0];
+  d[1] = pos[iplane_] - c_[1];
+
+  return MathExtraLiggghts::min(fabs(vectorDot2D(n1_,d)),
+                                fabs(vectorDot2D(n2_,d)),
+                                fabs(pos[iaxis_]-sublo[iaxis_]),
+                                fabs(subhi[iaxis_]-pos[iaxis_]));
+}
+
+/* ---------------------------------------------------------------------- */
+
+int DomainWedge::is_periodic_ghost_wedge(int i)
+{
+  double *x = atom->x[i];
+  const double cutneighmax = neighbor->cutneighmax;
+
+  double d[2];
+  d[0] = x[iphi_] - c_[0];
+  d[1] = x[iplane_] - c_[1];
+  if(vectorDot2D(n1_,d) > -cutneighmax || vectorDot2D(n2_,d) > -cutneighmax)
+    return 1;
+
+  if(periodicity[iaxis_] &&
+     (x[iaxis_] < boxlo[iaxis_]+cutneighmax || x[iaxis_] > boxhi[iaxis_]-cutneighmax))
+    return 1;
+  return 0;
+}
@@ -1 +1,183 @@
-#include "domain_wedge_dummy.h"
+/* ----------------------------------------------------------------------
+    This is the
+
+    ██╗     ██╗ ██████╗  ██████╗  ██████╗ ██╗  ██╗████████╗███████╗
+    ██║     ██║██╔════╝ ██╔════╝ ██╔════╝ ██║  ██║╚══██╔══╝██╔════╝
+    ██║     ██║██║  ███╗██║  ███╗██║  ███╗███████║   ██║   ███████╗
+    ██║     ██║██║   ██║██║   ██║██║   ██║██╔══██║   ██║   ╚════██║
+    ███████╗██║╚██████╔╝╚██████╔╝╚██████╔╝██║  ██║   ██║   ███████║
+    ╚══════╝╚═╝ ╚═════╝  ╚═════╝  ╚═════╝ ╚═╝  ╚═╝   ╚═╝   ╚══════╝®
+
+    DEM simulation engine, released by
+    DCS Computing Gmbh, Linz, Austria
+    http://www.dcs-computing.com, office@dcs-computing.com
+
+    LIGGGHTS® is part of CFDEM®project:
+    http://www.liggghts.com | http://www.cfdem.com
+
+    Core developer and main author:
+    Christoph Kloss, christoph.kloss@dcs-computing.com
+
+    LIGGGHTS® is open-source, distributed under the terms of the GNU Public
+    License, version 2 or later. It is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+    of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. You should have
+    received a copy of the GNU General Public License along with LIGGGHTS®.
+    If not, see http://www.gnu.org/licenses . See also top-level README
+    and LICENSE files.
+
+    LIGGGHTS® and CFDEM® are registered trade marks of DCS Computing GmbH,
+    the producer of the LIGGGHTS® software and the CFDEM®coupling software
+    See http://www.cfdem.com/terms-trademark-policy for details.
+
+-------------------------------------------------------------------------
+    Contributing author and copyright for this file:
+
+    Christoph Kloss (DCS Computing GmbH, Linz)
+    Christoph Kloss (JKU Linz)
+    Stefan Amberger (JKU Linz)
+
+    Copyright 2012-     DCS Computing GmbH, Linz
+    Copyright 2009-2012 JKU Linz
+------------------------------------------------------------------------- */
+
+#ifndef DOMAIN_WEDGE_H
+#define DOMAIN_WEDGE_H
+
+#include "domain.h"
+
+namespace LAMMPS_NS {
+
+/* ----------------------------------------------------------------------
+   rotationally periodic simulation domain
+   the box is a wedge (angular sector of a cylinder), created via
+   create_box from a wedge region when started with '-domain wedge'
+   the two flat faces of the wedge are coupled by a rotation about
+   the wedge axis: ghost atoms are rotated across the faces in
+   Comm::borders(), atoms leaving the sector are rotated back in pbc()
+   the sector lies in the plane of the dimensions iphi and (iphi+1)%3,
+   the axis is dimension iaxis; periodicity in the plane is handled
+   via dimension iphi, dimension (iphi+1)%3 is treated as fixed
+------------------------------------------------------------------------- */
+
+class DomainWedge : public Domain
+{
+
+  public:
+
+    DomainWedge(class LAMMPS *lmp);
+    ~DomainWedge();
+
+    void init();
+    void set_domain(class RegWedge *rw);
+
+    void pbc();
+    void remap(double *x, tagint &image);
+    void remap(double *x);
+
+    inline int index_axis()
+    { return iaxis_; }
+
+    inline int index_phi()
+    { return iphi_; }
+
+    inline void n1(double *_n1)
+    { vectorCopy2D(n1_,_n1); }
+
+    inline void n2(double *_n2)
+    { vectorCopy2D(n2_,_n2); }
+
+    inline void center(double *_c)
+    { vectorCopy2D(c_,_c); }
+
+    // rotate a point about the wedge axis or a vector about the axis
+    // direction by sign * wedge angle; sign = +1 maps the first face
+    // of the wedge onto the second one, sign = -1 vice versa
+
+    inline void rotate_point(double *x, int sign)
+    {
+        double d[2];
+        d[0] = x[iphi_] - c_[0];
+        d[1] = x[iplane_] - c_[1];
+        x[iphi_]   = c_[0] + cos_*d[0] - sign*sin_*d[1];
+        x[iplane_] = c_[1] + sign*sin_*d[0] + cos_*d[1];
+    }
+
+    inline void rotate_vector(double *v, int sign)
+    {
+        const double v0 = v[iphi_];
+        const double v1 = v[iplane_];
+        v[iphi_]   = cos_*v0 - sign*sin_*v1;
+        v[iplane_] = sign*sin_*v0 + cos_*v1;
+    }
+
+    int is_in_domain_wedge(double* pos);
+    int is_in_subdomain_wedge(double* pos);
+    int is_in_extended_subdomain_wedge(double* pos);
+    double dist_subbox_borders_wedge(double* pos);
+    int is_periodic_ghost_wedge(int i);
+
+  private:
+
+    int side(const double *pos);
+    int rotate_into_wedge(double *x);
+    void rotate_atom(int i, int sign);
+    void set_planar_periodicity(int flag);
+
+    bool domain_set_;
+
+    // dimension of the axis, of the periodic in-plane direction
+    // and of the second in-plane direction
+    int iaxis_, iphi_, iplane_;
+
+    // center of the wedge in the plane, outward normals of the
+    // two faces, opening angle
+    double c_[2], n1_[2], n2_[2];
+    double radius_;
+    double angle1_, angle_;
+    double cos_, sin_;
+
+    // rotation matrices for sign = +1 / -1, used for contact history
+    double rotp_[3][3], rotm_[3][3];
+
+    int nfix_history_;
+    class FixContactHistory **fix_history_;
+
+    // primitive walls keep their contact history in a per-atom property
+    int nfix_wall_history_;
+    class FixWallGran **fix_wall_history_;
+};
+
+}
+
+#endif
+
+/* ERROR/WARNING messages:
+
+E: Domain wedge requires a wedge region passed to create_box
+
+Self-explanatory.
+
+E: Domain wedge requires atom_style sphere
+
+Rotated ghost velocities and angular velocities are only implemented
+for atom_style sphere.
+
+E: Domain wedge requires ghost atoms to store velocity
+
+Use the comm_modify vel yes command.
+
+E: Domain wedge requires newton off
+
+Forces on rotated ghost atoms are not reverse communicated.
+
+E: Domain wedge requires 1 processor in the plane of the wedge
+
+The wedge may only be decomposed along its axis. Use the processors
+command to set the processor grid accordingly.
+
+E: Domain wedge is not compatible with fix deform
+
+Self-explanatory.
+
+*/
@@ -0,0 +1,660 @@
+/* ----------------------------------------------------------------------
+    This is the
+
+    ██╗     ██╗ ██████╗  ██████╗  ██████╗ ██╗  ██╗████████╗███████╗
+    ██║     ██║██╔════╝ ██╔════╝ ██╔════╝ ██║  ██║╚══██╔══╝██╔════╝
+    ██║     ██║██║  ███╗██║  ███╗██║  ███╗███████║   ██║   ███████╗
+    ██║     ██║██║   ██║██║   ██║██║   ██║██╔══██║   ██║   ╚════██║
+    ███████╗██║╚██████╔╝╚██████╔╝╚██████╔╝██║  ██║   ██║   ███████║
+    ╚══════╝╚═╝ ╚═════╝  ╚═════╝  ╚═════╝ ╚═╝  ╚═╝   ╚═╝   ╚══════╝®
+
+    DEM simulation engine, released by
+    DCS Computing Gmbh, Linz, Austria
+    http://www.dcs-computing.com, office@dcs-computing.com
+
+    LIGGGHTS® is part of CFDEM®project:
+    http://www.liggghts.com | http://www.cfdem.com
+
+    Core developer and main author:
+    Christoph Kloss, christoph.kloss@dcs-computing.com
+
+    LIGGGHTS® is open-source, distributed under the terms of the GNU Public
+    License, version 2 or later. It is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+    of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. You should have
+    received a copy of the GNU General Public License along with LIGGGHTS®.
+    If not, see http://www.gnu.org/licenses . See also top-level README
+    and LICENSE files.
+
+    LIGGGHTS® and CFDEM® are registered trade marks of DCS Computing GmbH,
+    the producer of the LIGGGHTS® software and the CFDEM®coupling software
+    See http://www.cfdem.com/terms-trademark-policy for details.
+
+-------------------------------------------------------------------------
+    Contributing author and copyright for this file:
+    (if not contributing author is listed, this file has been contributed
+    by the core developer)
+
+    Copyright 2012-     DCS Computing GmbH, Linz
+------------------------------------------------------------------------- */
+
+#include <string.h>
+#include <stdint.h>
+#include <algorithm>
+#include "dump_mesh_ensight.h"
+#include "tri_mesh.h"
+#include "update.h"
+#include "error.h"
+#include "fix_mesh_surface.h"
+#include "modify.h"
+#include "comm.h"
+#include "memory.h"
+
+using namespace LAMMPS_NS;
+
+#define MAXFRAMES 1000000
+
+enum
+{
+    DUMP_STRESS = 1,
+    DUMP_STRESSCOMPONENTS = 2,
+    DUMP_WEAR = 4,
+    DUMP_TEMP = 8,
+    DUMP_OWNER = 16,
+    DUMP_AREA = 32
+};
+
+namespace
+{
+    // orders gathered rows by element id (first value of each row)
+    struct IdLess
+    {
+        IdLess(const double *buf, int size_row) : buf_(buf), size_row_(size_row) {}
+        bool operator()(int a, int b) const
+        { return buf_[a*size_row_] < buf_[b*size_row_]; }
+        const double *buf_;
+        int size_row_;
+    };
+}
+
+/* ---------------------------------------------------------------------- */
+
+DumpMeshEnSight::DumpMeshEnSight(LAMMPS *lmp, int narg, char **arg) : Dump(lmp, narg, arg),
+  nMesh_(0),
+  meshList_(0),
+  dump_what_(0),
+  geometry_always_(0),
+  nvalues_(0),
+  nFrames_(0),
+  last_geometry_(-1),
+  maxsend_(0),
+  maxrecv_(0),
+  sendbuf_(NULL),
+  recvbuf_(NULL),
+  recvcounts_(NULL),
+  displs_(NULL)
+{
+  if (narg < 5)
+    error->all(FLERR,"Illegal dump mesh/ensight command");
+
+  // proc 0 writes all files, the case file references the other files
+  // so one file name is all that is needed
+
+  if (multiproc || multifile || compressed)
+    error->all(FLERR,"Illegal dump mesh/ensight command, file name must not contain '%' or '*' and must not end with '.gz'");
+
+  std::string fname(filename);
+  const size_t len = fname.length();
+  if (len < 6 || fname.compare(len-5,5,".case") != 0)
+    error->all(FLERR,"Illegal dump mesh/ensight command, file name must end with '.case'");
+
+  const size_t slash = fname.find_last_of('/');
+  if (slash == std::string::npos)
+    base_ = fname.substr(0,len-5);
+  else
+  {
+    path_ = fname.substr(0,slash+1);
+    base_ = fname.substr(slash+1,len-5-(slash+1));
+  }
+
+  format_default = NULL;
+  binary = 0;
+
+  int iarg = 5;
+
+  while(iarg < narg){
+    if(strcmp(arg[iarg],"binary") == 0){
+      binary = 1;
+      iarg++;
+    } else if(strcmp(arg[iarg],"geometry") == 0){
+      if (narg < iarg+2)
+        error->all(FLERR,"Illegal dump mesh/ensight command, not enough arguments");
+      if(strcmp(arg[iarg+1],"changed") == 0)
+        geometry_always_ = 0;
+      else if(strcmp(arg[iarg+1],"always") == 0)
+        geometry_always_ = 1;
+      else
+        error->all(FLERR,"Illegal dump mesh/ensight command, expecting 'changed' or 'always' after 'geometry'");
+      iarg += 2;
+    } else if(strcmp(arg[iarg],"stress") == 0){
+      dump_what_ |= DUMP_STRESS;
+      iarg++;
+    } else if(strcmp(arg[iarg],"stresscomponents") == 0){
+      dump_what_ |= DUMP_STRESSCOMPONENTS;
+      iarg++;
+    } else if(strcmp(arg[iarg],"wear") == 0){
+      dump_what_ |= DUMP_WEAR;
+      iarg++;
+    } else if(strcmp(arg[iarg],"temp") == 0){
+      dump_what_ |= DUMP_TEMP;
+      iarg++;
+    } else if(strcmp(arg[iarg],"owner") == 0){
+      dump_what_ |= DUMP_OWNER;
+      iarg++;
+    } else if(strcmp(arg[iarg],"area") == 0){
+      dump_what_ |= DUMP_AREA;
+      iarg++;
+    } else {
+
+      // assume it's a mesh
+      int ifix = modify->find_fix(arg[iarg]);
+      FixMeshSurface *fms = ifix >= 0 ? dynamic_cast<FixMeshSurface*>(modify->fix[ifix]) : NULL;
+      if(!fms)
+        error->all(FLERR,"Illegal dump mesh/ensight command, unknown keyword or mesh");
+
+      TriMesh **meshListNew = new TriMesh*[nMesh_+1];
+      for(int i = 0; i < nMesh_; i++)
+        meshListNew[i] = meshList_[i];
+      delete[] meshList_;
+      meshList_ = meshListNew;
+
+      meshList_[nMesh_] = fms->triMesh();
+      fms->dumpAdd();
+      iarg++;
+      nMesh_++;
+    }
+  }
+
+  // in case meshes not specified explicitly, take all meshes
+  if (nMesh_ == 0)
+  {
+      nMesh_ = modify->n_fixes_style("mesh/surface");
+
+      meshList_ = new TriMesh*[nMesh_];
+      for (int iMesh = 0; iMesh < nMesh_; iMesh++)
+      {
+          meshList_[iMesh] = static_cast<FixMeshSurface*>(modify->find_fix_style("mesh/surface",iMesh))->triMesh();
+          static_cast<FixMeshSurface*>(modify->find_fix_style("mesh/surface",iMesh))->dumpAdd();
+      }
+
+      if (nMesh_ == 0)
+          error->warning(FLERR,"Dump mesh/ensight cannot find any fix of type 'mesh/surface' to dump");
+  }
+
+  nElemGeometry_.assign(nMesh_,-1);
+
+  memory->create(recvcounts_,comm->nprocs,"dump:recvcounts");
+  memory->create(displs_,comm->nprocs,"dump:displs");
+
+  setup_variables();
+}
+
+/* ---------------------------------------------------------------------- */
+
+DumpMeshEnSight::~DumpMeshEnSight()
+{
+  for (int iMesh = 0; iMesh < nMesh_; iMesh++)
+  {
+      if(meshList_[iMesh]->mesh_id())
+      {
+          Fix *f = modify->find_fix_id(meshList_[iMesh]->mesh_id());
+          if(f)
+            static_cast<FixMeshSurface*>(f)->dumpRemove();
+      }
+  }
+
+  delete[] meshList_;
+
+  memory->destroy(sendbuf_);
+  memory->destroy(recvbuf_);
+  memory->destroy(recvcounts_);
+  memory->destroy(displs_);
+}
+
+/* ---------------------------------------------------------------------- */
+
+void DumpMeshEnSight::init_style()
+{
+  // files are opened in write(), nothing to do here
+}
+
+/* ----------------------------------------------------------------------
+   per-element variables, order must match the packing in gather()
+------------------------------------------------------------------------- */
+
+void DumpMeshEnSight::setup_variables()
+{
+  if(dump_what_ & DUMP_STRESS)
+  {
+      var_names_.push_back("normal_stress_average");
+      var_ncomp_.push_back(1);
+      var_names_.push_back("shear_stress_average");
+      var_ncomp_.push_back(1);
+  }
+  if(dump_what_ & DUMP_STRESSCOMPONENTS)
+  {
+      var_names_.push_back("stress");
+      var_ncomp_.push_back(3);
+  }
+  if(dump_what_ & DUMP_WEAR)
+  {
+      var_names_.push_back("wear");
+      var_ncomp_.push_back(1);
+  }
+  if(dump_what_ & DUMP_TEMP)
+  {
+      var_names_.push_back("Temp");
+      var_ncomp_.push_back(1);
+  }
+  if(dump_what_ & DUMP_OWNER)
+  {
+      var_names_.push_back("owner");
+      var_ncomp_.push_back(1);
+  }
+  if(dump_what_ & DUMP_AREA)
+  {
+      var_names_.push_back("area");
+      var_ncomp_.push_back(1);
+  }
+
+  nvalues_ = 0;
+  for(size_t ivar = 0; ivar < var_ncomp_.size(); ivar++)
+      nvalues_ += var_ncomp_[ivar];
+}
+
+/* ----------------------------------------------------------------------
+   geometry needs to be written on the first dump, for moving or
+   deforming meshes and if elements were added or removed
+------------------------------------------------------------------------- */
+
+bool DumpMeshEnSight::geometry_changed(std::vector<bigint> &nElem)
+{
+  bool changed = geometry_always_ || nFrames_ == 0;
+
+  nElem.resize(nMesh_);
+  for(int iMesh = 0; iMesh < nMesh_; iMesh++)
+  {
+      TriMesh *mesh = meshList_[iMesh];
+      bigint nlocal = (mesh->isParallel() || 0 == comm->me) ? mesh->sizeLocal() : 0;
+      MPI_Allreduce(&nlocal,&nElem[iMesh],1,MPI_LMP_BIGINT,MPI_SUM,world);
+
+      if(mesh->isMoving() || mesh->isDeforming() || nElem[iMesh] != nElemGeometry_[iMesh])
+          changed = true;
+  }
+
+  return changed;
+}
+
+/* ---------------------------------------------------------------------- */
+
+void DumpMeshEnSight::write()
+{
+  std::vector<bigint> nElem;
+  const int writeGeometry = geometry_changed(nElem) ? 1 : 0;
+  const int size_row = 1 + (writeGeometry ? 9 : 0) + nvalues_;
+
+  for(int iMesh = 0; iMesh < nMesh_; iMesh++)
+      if(nElem[iMesh]*size_row > MAXSMALLINT)
+          error->all(FLERR,"Too much per-proc info for dump");
+
+  if(nFrames_ >= MAXFRAMES)
+      error->all(FLERR,"Dump mesh/ensight can write at most 1000000 dump steps");
+
+  if(writeGeometry)
+  {
+      last_geometry_ = nFrames_;
+      nElemGeometry_ = nElem;
+  }
+  time_values_.push_back(update->get_cur_time());
+  geometry_file_.push_back(last_geometry_);
+
+  const int nvar = var_names_.size();
+  FILE *geo = NULL;
+  std::vector<FILE*> var(nvar,static_cast<FILE*>(NULL));
+  char desc[80];
+
+  if(0 == comm->me)
+  {
+      if(writeGeometry)
+      {
+          geo = open_ensight_file("geo",nFrames_);
+          if(binary)
+            write_string(geo,"C Binary");
+          write_string(geo,"LIGGGHTS mesh geometry");
+          sprintf(desc,"timestep " BIGINT_FORMAT,update->ntimestep);
+          write_string(geo,desc);
+          write_string(geo,"node id off");
+          write_string(geo,"element id off");
+      }
+
+      for(int ivar = 0; ivar < nvar; ivar++)
+      {
+          var[ivar] = open_ensight_file(var_names_[ivar].c_str(),nFrames_);
+          sprintf(desc,"%s timestep " BIGINT_FORMAT,var_names_[ivar].c_str(),update->ntimestep);
+          write_string(var[ivar],desc);
+      }
+  }
+
+  for(int iMesh = 0; iMesh < nMesh_; iMesh++)
+  {
+      const int n = gather(iMesh,writeGeometry);
+
+      // empty parts are skipped in all files
+      if(0 != comm->me || 0 == n)
+          continue;
+
+      if(writeGeometry)
+          write_geometry_part(geo,iMesh,n,size_row);
+
+      int offset = 1 + (writeGeometry ? 9 : 0);
+      for(int ivar = 0; ivar < nvar; ivar++)
+      {
+          write_variable_part(var[ivar],iMesh,ivar,offset,n,size_row);
+          offset += var_ncomp_[ivar];
+      }
+  }
+
+  if(0 == comm->me)
+  {
+      if(geo)
+          fclose(geo);
+      for(int ivar = 0; ivar < nvar; ivar++)
+          fclose(var[ivar]);
+      write_case();
+  }
+
+  nFrames_++;
+}
+
+/* ----------------------------------------------------------------------
+   gather one row per element to proc 0, rows are
+   id, 3 nodes (only if geometry is written), variables
+   returns # of elements on proc 0, 0 on other procs
+------------------------------------------------------------------------- */
+
+int DumpMeshEnSight::gather(int imesh, int writeGeometry)
+{
+  TriMesh *mesh = meshList_[imesh];
+  const int size_row = 1 + (writeGeometry ? 9 : 0) + nvalues_;
+  const int nlocal = (mesh->isParallel() || 0 == comm->me) ? mesh->sizeLocal() : 0;
+
+  if(nlocal*size_row > maxsend_)
+  {
+      maxsend_ = nlocal*size_row;
+      memory->grow(sendbuf_,maxsend_,"dump:sendbuf");
+  }
+
+  // references to properties - some may stay NULL, '0' is dumped then
+
+  ScalarContainer<double> *sigma_n = NULL, *sigma_t = NULL, *wear = NULL, *T = NULL;
+  VectorContainer<double,3> *f = NULL;
+  bool T_per_element = true;
+
+  if(dump_what_ & DUMP_STRESS)
+  {
+      sigma_n = mesh->prop().getElementProperty<ScalarContainer<double> >("sigma_n");
+      sigma_t = mesh->prop().getElementProperty<ScalarContainer<double> >("sigma_t");
+  }
+  if(dump_what_ & DUMP_STRESSCOMPONENTS)
+      f = mesh->prop().getElementProperty<VectorContainer<double,3> >("f");
+  if(dump_what_ & DUMP_WEAR)
+      wear = mesh->prop().getElementProperty<ScalarContainer<double> >("wear");
+  if(dump_what_ & DUMP_TEMP)
+  {
+      T = mesh->prop().getElementProperty<ScalarContainer<double> >("Temp");
+      if(!T)
+      {
+          T = mesh->prop().getGlobalProperty<ScalarContainer<double> >("Temp");
+          T_per_element = false;
+      }
+  }
+
+  int m = 0;
+  double node[3];
+  for(int i = 0; i < nlocal; i++)
+  {
+      sendbuf_[m++] = static_cast<double>(mesh->id(i));
+
+      if(writeGeometry)
+      {
+          for(int j = 0; j < 3; j++)
+          {
+              mesh->node(i,j,node);
+              for(int k = 0; k < 3; k++)
+                  sendbuf_[m++] = node[k];
+          }
+      }
+
+      if(dump_what_ & DUMP_STRESS)
+      {
+          sendbuf_[m++] = sigma_n ? sigma_n->get(i) : 0.;
+          sendbuf_[m++] = sigma_t ? sigma_t->get(i) : 0.;
+      }
+      if(dump_what_ & DUMP_STRESSCOMPONENTS)
+      {
+          double fi[3] = {0.,0.,0.};
+          if(f)
+          {
+              const double invArea = 1./mesh->areaElem(i);
+              f->get(i,fi);
+              for(int k = 0; k < 3; k++)
+                  fi[k] *= invArea;
+          }
+          for(int k = 0; k < 3; k++)
+              sendbuf_[m++] = fi[k];
+      }
+      if(dump_what_ & DUMP_WEAR)
+          sendbuf_[m++] = wear ? wear->get(i) : 0.;
+      if(dump_what_ & DUMP_TEMP)
+          sendbuf_[m++] = T ? T->get(T_per_element ? i : 0) : 0.;
+      if(dump_what_ & DUMP_OWNER)
+          sendbuf_[m++] = static_cast<double>(comm->me);
+      if(dump_what_ & DUMP_AREA)
+          sendbuf_[m++] = mesh->areaElem(i);
+  }
+
+  int nrecv = 0;
+  MPI_Gather(&m,1,MPI_INT,recvcounts_,1,MPI_INT,0,world);
+  if(0 == comm->me)
+  {
+      for(int iproc = 0; iproc < comm->nprocs; iproc++)
+      {
+          displs_[iproc] = nrecv;
+          nrecv += recvcounts_[iproc];
+      }
+      if(nrecv > maxrecv_)
+      {
+          maxrecv_ = nrecv;
+          memory->grow(recvbuf_,maxrecv_,"dump:recvbuf");
+      }
+  }
+  MPI_Gatherv(sendbuf_,m,MPI_DOUBLE,recvbuf_,recvcounts_,displs_,MPI_DOUBLE,0,world);
+
+  if(0 != comm->me)
+      return 0;
+
+  // sort by element id so that all files list the elements
+  // in the same order as the geometry file, independent of
+  // the parallel decomposition
+
+  const int n = nrecv/size_row;
+  order_.resize(n);
+  for(int i = 0; i < n; i++)
+      order_[i] = i;
+  std::sort(order_.begin(),order_.end(),IdLess(recvbuf_,size_row));
+
+  return n;
+}
+
+/* ---------------------------------------------------------------------- */
+
+void DumpMeshEnSight::write_geometry_part(FILE *fp, int imesh, int n, int size_row)
+{
+  write_string(fp,"part");
+  write_int(fp,imesh+1);
+  write_string(fp,meshList_[imesh]->mesh_id() ? meshList_[imesh]->mesh_id() : "mesh");
+
+  // nodes are not shared among elements, 3 nodes per element
+
+  write_string(fp,"coordinates");
+  write_int(fp,3*n);
+  for(int k = 0; k < 3; k++)
+      for(int i = 0; i < n; i++)
+      {
+          const double *row = &recvbuf_[order_[i]*size_row];
+          for(int j = 0; j < 3; j++)
+              write_float(fp,row[1+3*j+k]);
+      }
+
+  write_string(fp,"tria3");
+  write_int(fp,n);
+  for(int i = 0; i < n; i++)
+  {
+      if(binary)
+      {
+          write_int(fp,3*i+1);
+          write_int(fp,3*i+2);
+          write_int(fp,3*i+3);
+      }
+      else
+          fprintf(fp,"%10d%10d%10d\n",3*i+1,3*i+2,3*i+3);
+  }
+}
+
+/* ---------------------------------------------------------------------- */
+
+void DumpMeshEnSight::write_variable_part(FILE *fp, int imesh, int ivar, int offset, int n, int size_row)
+{
+  write_string(fp,"part");
+  write_int(fp,imesh+1);
+  write_string(fp,"tria3");
+  for(int k = 0; k < var_ncomp_[ivar]; k++)
+      for(int i = 0; i < n; i++)
+          write_float(fp,recvbuf_[order_[i]*size_row+offset+k]);
+}
+
+/* ----------------------------------------------------------------------
+   case file is re-written every dump step so that it is valid
+   even if the simulation stops early
+   time set 1 is used by the variables, time set 2 by the geometry
+   if it has been written more than once
+------------------------------------------------------------------------- */
+
+void DumpMeshEnSight::write_case()
+{
+  std::string casename = path_ + base_ + ".case";
+  FILE *fp = fopen(casename.c_str(),"w");
+  if (fp == NULL)
+      error->one(FLERR,"Cannot open dump file");
+
+  const int nsteps = time_values_.size();
+  bool transient_geometry = false;
+  for(int i = 1; i < nsteps; i++)
+      if(geometry_file_[i] != geometry_file_[0])
+          transient_geometry = true;
+
+  fprintf(fp,"FORMAT\n");
+  fprintf(fp,"type: ensight gold\n\n");
+
+  fprintf(fp,"GEOMETRY\n");
+  if(transient_geometry)
+      fprintf(fp,"model: 2 %s.geo******\n",base_.c_str());
+  else
+      fprintf(fp,"model: %s.geo%06d\n",base_.c_str(),geometry_file_[0]);
+
+  if(!var_names_.empty())
+  {
+      fprintf(fp,"\nVARIABLE\n");
+      for(size_t ivar = 0; ivar < var_names_.size(); ivar++)
+          fprintf(fp,"%s per element: 1 %s %s.%s******\n",
+                  var_ncomp_[ivar] == 3 ? "vector" : "scalar",
+                  var_names_[ivar].c_str(),base_.c_str(),var_names_[ivar].c_str());
+  }
+
+  fprintf(fp,"\nTIME\n");
+  fprintf(fp,"time set: 1\n");
+  fprintf(fp,"number of steps: %d\n",nsteps);
+  fprintf(fp,"filename start number: 0\n");
+  fprintf(fp,"filename increment: 1\n");
+  fprintf(fp,"time values:\n");
+  for(int i = 0; i < nsteps; i++)
+      fprintf(fp,"%.12g\n",time_values_[i]);
+
+  if(transient_geometry)
+  {
+      fprintf(fp,"\ntime set: 2\n");
+      fprintf(fp,"number of steps: %d\n",nsteps);
+      fprintf(fp,"filename numbers:\n");
+      for(int i = 0; i < nsteps; i++)
+          fprintf(fp,"%d\n",geometry_file_[i]);
+      fprintf(fp,"time values:\n");
+      for(int i = 0; i < nsteps; i++)
+          fprintf(fp,"%.12g\n",time_values_[i]);
+  }
+
+  fclose(fp);
+}
+
+/* ---------------------------------------------------------------------- */
+
+FILE* DumpMeshEnSight::open_ensight_file(const char *suffix, int frame)
+{
+  char num[16];
+  sprintf(num,"%06d",frame);
+  std::string name = path_ + base_ + "." + suffix + num;
+
+  FILE *fp = fopen(name.c_str(),binary ? "wb" : "w");
+  if (fp == NULL)
+      error->one(FLERR,"Cannot open dump file");
+  return fp;
+}
+
+/* ----------------------------------------------------------------------
+   EnSight Gold ASCII uses one entry per line, C Binary uses
+   80 character strings, 32 bit integers and 32 bit floats
+------------------------------------------------------------------------- */
+
+void DumpMeshEnSight::write_string(FILE *fp, const char *str)
+{
+  if(binary)
+  {
+      char line[80];
+      memset(line,0,80);
+      strncpy(line,str,79);
+      fwrite(line,1,80,fp);
+  }
+  else
+      fprintf(fp,"%s\n",str);
+}
+
+void DumpMeshEnSight::write_int(FILE *fp, int i)
+{
+  if(binary)
+  {
+      int32_t i32 = i;
+      fwrite(&i32,4,1,fp);
+  }
+  else
+      fprintf(fp,"%10d\n",i);
+}
+
+void DumpMeshEnSight::write_float(FILE *fp, double d)
+{
+  if(binary)
+  {
+      float f = static_cast<float>(d);
+      fwrite(&f,4,1,fp);
+  }
+  else
+      fprintf(fp,"%12.5e\n",d);
+}
@@ -0,0 +1,126 @@
+/* ----------------------------------------------------------------------
+    This is the
+
+    ██╗     ██╗ ██████╗  ██████╗  ██████╗ ██╗  ██╗████████╗███████╗
+    ██║     ██║██╔════╝ ██╔════╝ ██╔════╝ ██║  ██║╚══██╔══╝██╔════╝
+    ██║     ██║██║  ███╗██║  ███╗██║  ███╗███████║   ██║   ███████╗
+    ██║     ██║██║   ██║██║   ██║██║   ██║██╔══██║   ██║   ╚════██║
+    ███████╗██║╚██████╔╝╚██████╔╝╚██████╔╝██║  ██║   ██║   ███████║
+    ╚══════╝╚═╝ ╚═════╝  ╚═════╝  ╚═════╝ ╚═╝  ╚═╝   ╚═╝   ╚══════╝®
+
+    DEM simulation engine, released by
+    DCS Computing Gmbh, Linz, Austria
+    http://www.dcs-computing.com, office@dcs-computing.com
+
+    LIGGGHTS® is part of CFDEM®project:
+    http://www.liggghts.com | http://www.cfdem.com
+
+    Core developer and main author:
+    Christoph Kloss, christoph.kloss@dcs-computing.com
+
+    LIGGGHTS® is open-source, distributed under the terms of the GNU Public
+    License, version 2 or later. It is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+    of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. You should have
+    received a copy of the GNU General Public License along with LIGGGHTS®.
+    If not, see http://www.gnu.org/licenses . See also top-level README
+    and LICENSE files.
+
+    LIGGGHTS® and CFDEM® are registered trade marks of DCS Computing GmbH,
+    the producer of the LIGGGHTS® software and the CFDEM®coupling software
+    See http://www.cfdem.com/terms-trademark-policy for details.
+
+-------------------------------------------------------------------------
+    Contributing author and copyright for this file:
+    (if not contributing author is listed, this file has been contributed
+    by the core developer)
+
+    Copyright 2012-     DCS Computing GmbH, Linz
+------------------------------------------------------------------------- */
+
+#ifdef DUMP_CLASS
+
+DumpStyle(mesh/ensight,DumpMeshEnSight)
+
+#else
+
+#ifndef LMP_DUMP_MESH_ENSIGHT_H
+#define LMP_DUMP_MESH_ENSIGHT_H
+
+#include <stdio.h>
+#include <vector>
+#include <string>
+#include "dump.h"
+
+namespace LAMMPS_NS {
+
+/* ----------------------------------------------------------------------
+   dump of mesh geometries and per-element data in EnSight Gold format
+   the geometry is written to its own file and only re-written if one of
+   the dumped meshes moves, deforms or changes its number of elements,
+   each dump step only adds one small file per dumped property
+------------------------------------------------------------------------- */
+
+class DumpMeshEnSight : public Dump {
+ public:
+  DumpMeshEnSight(LAMMPS *, int, char**);
+  virtual ~DumpMeshEnSight();
+  void init_style();
+  void write();
+
+ private:
+
+  int nMesh_;
+  class TriMesh **meshList_;
+  int dump_what_;
+
+  // 1 if the geometry is written every dump step
+  int geometry_always_;
+
+  // names and # of components of the per-element variables
+  std::vector<std::string> var_names_;
+  std::vector<int> var_ncomp_;
+  int nvalues_;
+
+  // file names without path (as referenced from the case file)
+  // and path prefix
+  std::string path_;
+  std::string base_;
+
+  // dump history, only kept on proc 0
+  int nFrames_;
+  std::vector<double> time_values_;
+  std::vector<int> geometry_file_;
+  int last_geometry_;
+
+  // # of elements per mesh at last geometry output
+  std::vector<bigint> nElemGeometry_;
+
+  // communication buffers
+  int maxsend_, maxrecv_;
+  double *sendbuf_, *recvbuf_;
+  int *recvcounts_, *displs_;
+  std::vector<int> order_;
+
+  void write_header(bigint) {}
+  void pack(int *) {}
+  void write_data(int, double *) {}
+
+  void setup_variables();
+  bool geometry_changed(std::vector<bigint> &nElem);
+  int gather(int imesh, int writeGeometry);
+
+  void write_geometry_part(FILE *fp, int imesh, int n, int size_row);
+  void write_variable_part(FILE *fp, int imesh, int ivar, int offset, int n, int size_row);
+  void write_case();
+
+  FILE* open_ensight_file(const char *suffix, int frame);
+  void write_string(FILE *fp, const char *str);
+  void write_int(FILE *fp, int i);
+  void write_float(FILE *fp, double d);
+};
+
+}
+
+#endif
+#endif
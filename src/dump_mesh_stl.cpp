@@ -71,6 +71,8 @@ enum
 DumpMeshSTL::DumpMeshSTL(LAMMPS *lmp, int narg, char **arg) : Dump(lmp, narg, arg),
   nMesh_(0),
   meshList_(0),
+  geometry_always_(1),
+  n_files_(0),
   iregion_(-1)
 {
   if (narg < 5)
@@ -95,6 +97,16 @@ DumpMeshSTL::DumpMeshSTL(LAMMPS *lmp, int narg, char **arg) : Dump(lmp, narg, ar
       if (iregion_ == -1)
         error->all(FLERR,"Illegal dump mesh/stl command, region ID does not exist");
       iarg += 2;
+    } else if(strcmp(arg[iarg],"geometry") == 0){
+      if (narg < iarg+2)
+        error->all(FLERR,"Illegal dump mesh/stl command, not enough arguments");
+      if(strcmp(arg[iarg+1],"changed") == 0)
+        geometry_always_ = 0;
+      else if(strcmp(arg[iarg+1],"always") == 0)
+        geometry_always_ = 1;
+      else
+        error->all(FLERR,"Illegal dump mesh/stl command, expecting 'changed' or 'always' after 'geometry'");
+      iarg += 2;
     } else if(strcmp(arg[iarg],"all") == 0){
       dump_what_ = NALL;
       iarg++;
@@ -202,6 +214,27 @@ void DumpMeshSTL::init_style()
   strcat(format,"  endfacet\n");
 }
 
+/* ----------------------------------------------------------------------
+   with 'geometry changed' a file is only written for the first dump
+   and while any of the meshes is moving or deforming
+------------------------------------------------------------------------- */
+
+void DumpMeshSTL::write()
+{
+  if(!geometry_always_ && n_files_ > 0)
+  {
+      bool changed = false;
+      for(int iMesh = 0; iMesh < nMesh_; iMesh++)
+          if(meshList_[iMesh]->isMoving() || meshList_[iMesh]->isDeforming())
+              changed = true;
+      if(!changed)
+          return;
+  }
+
+  n_files_++;
+  Dump::write();
+}
+
 /* ---------------------------------------------------------------------- */
 
 int DumpMeshSTL::modify_param(int narg, char **arg)
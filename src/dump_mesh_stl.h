@@ -60,6 +60,7 @@ class DumpMeshSTL : public Dump {
   DumpMeshSTL(LAMMPS *, int, char**);
   virtual ~DumpMeshSTL();
   void init_style();
+  void write();
 
  private:            // column labels
 
@@ -69,6 +70,10 @@ class DumpMeshSTL : public Dump {
 
   int n_calls_;
 
+  // 0 if files are only written if the geometry changes
+  int geometry_always_;
+  int n_files_;
+
   // region filter
   int iregion_;
 
@@ -50,6 +50,7 @@
 #include <time.h>
 #include "finish.h"
 #include "timer.h"
+#include "perf_events.h"
 #include "universe.h"
 #include "atom.h"
 #include "comm.h"
@@ -64,6 +65,7 @@
 #include "memory.h"
 #include "modify.h"
 #include "fix.h"
+#include "my_page_pool.h"
 
 using namespace LAMMPS_NS;
 
@@ -519,6 +521,32 @@ void Finish::end(int flag)
       }
     }
 
+    if(modify->timing) {
+      time = timer->array[TIME_MESH_NEIGHBOR];
+      MPI_Allreduce(&time,&tmp,1,MPI_DOUBLE,MPI_SUM,world);
+      time = tmp/nprocs;
+      if (me == 0 && time > 0.0) {
+        if (screen)
+          fprintf(screen,"  Mesh neigh time (%%) = %g (%g)\n",
+                  time,time/time_loop*100.0);
+        if (logfile)
+          fprintf(logfile,"  Mesh neigh time (%%) = %g (%g)\n",
+                  time,time/time_loop*100.0);
+      }
+
+      time = timer->array[TIME_WALL_CONTACT];
+      MPI_Allreduce(&time,&tmp,1,MPI_DOUBLE,MPI_SUM,world);
+      time = tmp/nprocs;
+      if (me == 0 && time > 0.0) {
+        if (screen)
+          fprintf(screen,"  Wall contact time (%%) = %g (%g)\n",
+                  time,time/time_loop*100.0);
+        if (logfile)
+          fprintf(logfile,"  Wall contact time (%%) = %g (%g)\n",
+                  time,time/time_loop*100.0);
+      }
+    }
+
     time = time_other;
     MPI_Allreduce(&time,&tmp,1,MPI_DOUBLE,MPI_SUM,world);
     time = tmp/nprocs;
@@ -551,6 +579,26 @@ void Finish::end(int flag)
                   fix->id, fix->style, time,time/time_loop*100.0);
         }
 
+        // breakdown by timestep stage, stages not used by the fix are skipped
+
+        double stage_time[FIX_TIME_N],stage_tmp[FIX_TIME_N];
+        for (int j = 0; j < FIX_TIME_N; j++)
+          stage_time[j] = fix->get_recorded_time(j);
+        MPI_Allreduce(stage_time,stage_tmp,FIX_TIME_N,MPI_DOUBLE,MPI_SUM,world);
+
+        if (me == 0) {
+          for (int j = 0; j < FIX_TIME_N; j++) {
+            if (stage_tmp[j] == 0.0) continue;
+            time = stage_tmp[j]/nprocs;
+            if (screen)
+              fprintf(screen,"  %s time (%%) = %g (%g)\n",
+                  modify->time_stage_name(j),time,time/time_loop*100.0);
+            if (logfile)
+              fprintf(logfile,"  %s time (%%) = %g (%g)\n",
+                  modify->time_stage_name(j),time,time/time_loop*100.0);
+          }
+        }
+
         if(modify->timing > 1) {
           time = fix->get_recorded_time();
           MPI_Gather(&time, 1, MPI_DOUBLE, fix_times, 1, MPI_DOUBLE, 0, MPI_COMM_WORLD);
@@ -567,6 +615,10 @@ void Finish::end(int flag)
       }
       delete [] fix_times;
     }
+
+    // hardware counters of hot regions, if compiled in and enabled
+
+    if(modify->timing) timer->perf->print(screen,logfile);
   }
 
   // FFT timing statistics
@@ -766,6 +818,13 @@ void Finish::end(int flag)
       MPI_Allreduce(&tmp,&nspec_all,1,MPI_DOUBLE,MPI_SUM,world);
     }
 
+    // pages of neighbor lists and contact history, max across procs
+
+    double pool[2],pool_all[2];
+    pool[0] = MyPagePool::bytes_peak()/1024.0/1024.0;
+    pool[1] = MyPagePool::bytes_cached()/1024.0/1024.0;
+    MPI_Allreduce(pool,pool_all,2,MPI_DOUBLE,MPI_MAX,world);
+
     if (me == 0) {
       if (screen) {
         if (nall < 2.0e9)
@@ -781,6 +840,8 @@ void Finish::end(int flag)
                 neighbor->ncalls);
         fprintf(screen,"Dangerous builds = " BIGINT_FORMAT "\n",
                 neighbor->ndanger);
+        fprintf(screen,"Neighbor pages = %g Mbytes peak, %g Mbytes cached "
+                "(max per proc)\n",pool_all[0],pool_all[1]);
       }
       if (logfile) {
         if (nall < 2.0e9)
@@ -796,6 +857,8 @@ void Finish::end(int flag)
                 neighbor->ncalls);
         fprintf(logfile,"Dangerous builds = " BIGINT_FORMAT "\n",
                 neighbor->ndanger);
+        fprintf(logfile,"Neighbor pages = %g Mbytes peak, %g Mbytes cached "
+                "(max per proc)\n",pool_all[0],pool_all[1]);
       }
     }
   }
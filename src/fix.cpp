@@ -105,6 +105,7 @@ Fix::Fix(LAMMPS *lmp, int narg, char **arg) :
   wd_header = wd_section = 0;
   dynamic_group_allow = 0;
   cudable_comm = 0;
+  pre_force_overlap = 0;
   rad_mass_vary_flag = 0; 
   just_created = 1; 
   recent_restart = 0; 
@@ -130,7 +131,7 @@ Fix::Fix(LAMMPS *lmp, int narg, char **arg) :
   maxvatom = 0;
   vatom = NULL;
 
-  recorded_time = 0.0;
+  reset_time_recording();
 
   datamask = ALL_MASK;
   datamask_ext = ALL_MASK;
@@ -56,6 +56,12 @@
 
 namespace LAMMPS_NS {
 
+// stages of a timestep for which fix timings are recorded
+
+enum{FIX_TIME_INTEGRATE,FIX_TIME_PRE_EXCHANGE,FIX_TIME_PRE_NEIGHBOR,
+     FIX_TIME_PRE_FORCE,FIX_TIME_POST_FORCE,FIX_TIME_END_OF_STEP,
+     FIX_TIME_OTHER,FIX_TIME_N};
+
 class Fix : protected Pointers {
  public:
   char *id,*style;
@@ -85,6 +91,9 @@ class Fix : protected Pointers {
   int wd_section;                // # of sections fix writes to data file
   int dynamic_group_allow;       // 1 if can be used with dynamic group, else 0
   int cudable_comm;              // 1 if fix has CUDA-enabled communication
+  int pre_force_overlap;         // 1 if pre_force() does not change data
+                                 //   read by pair compute, so it can follow
+                                 //   pair compute of interior atoms
 
   int rad_mass_vary_flag;        // 1 if particle radius or mass varied by fix 
   int just_created;              // 1 if fix was just created
@@ -279,24 +288,31 @@ class Fix : protected Pointers {
  private:
   // add timing functionality to all fixes
   double recorded_time;
+  double recorded_time_stage[FIX_TIME_N];
   double previous_time;
 
  public:
   inline void reset_time_recording() {
     recorded_time = 0.0;
+    for (int i = 0; i < FIX_TIME_N; i++) recorded_time_stage[i] = 0.0;
   }
 
   inline double get_recorded_time() const {
     return recorded_time;
   }
 
+  inline double get_recorded_time(int stage) const {
+    return recorded_time_stage[stage];
+  }
+
   inline void begin_time_recording() {
     previous_time = MPI_Wtime();
   }
 
-  inline void end_time_recording() {
+  inline void end_time_recording(int stage = FIX_TIME_OTHER) {
     double delta_time = MPI_Wtime() - previous_time;
     recorded_time += delta_time;
+    recorded_time_stage[stage] += delta_time;
   }
 
   union ubuf {  
@@ -75,9 +75,12 @@ FixAveEuler::FixAveEuler(LAMMPS *lmp, int narg, char **arg) :
   cell_size_ideal_(0.),
   ncells_(0),
   ncells_max_(0),
-  ncellptr_max_(0),
-  cellhead_(NULL),
-  cellptr_(NULL),
+  ncellatom_max_(0),
+  cellstart_(NULL),
+  cellatom_(NULL),
+  atomcell_(NULL),
+  binned_step_(-1),
+  bin_source_(NULL),
   idregion_(NULL),
   region_(NULL),
   center_(NULL),
@@ -154,8 +157,9 @@ FixAveEuler::FixAveEuler(LAMMPS *lmp, int narg, char **arg) :
 
 FixAveEuler::~FixAveEuler()
 {
-  memory->destroy(cellhead_);
-  memory->destroy(cellptr_);
+  memory->destroy(cellstart_);
+  memory->destroy(cellatom_);
+  memory->destroy(atomcell_);
   if(idregion_) delete []idregion_;
   memory->destroy(center_);
   memory->destroy(v_av_);
@@ -173,6 +177,7 @@ FixAveEuler::~FixAveEuler()
 void FixAveEuler::post_create()
 {
   //  stress computation, just for pairwise contribution
+  //  shared by all fix ave/euler
   if(!compute_stress_)
   {
         const char* arg[4];
@@ -181,7 +186,8 @@ void FixAveEuler::post_create()
         arg[2]="stress/atom";
         arg[3]="pair";
 
-        modify->add_compute(4,(char**)arg);
+        if(modify->find_compute(arg[0]) < 0)
+            modify->add_compute(4,(char**)arg);
         compute_stress_ = static_cast<ComputeStressAtom*>(modify->compute[modify->find_compute(arg[0])]);
   }
 
@@ -233,6 +239,23 @@ void FixAveEuler::init()
 
   if (!parallel_ && 1 == domain->triclinic)
     error->fix_error(FLERR,this,"triclinic boxes only support 'parallel=yes'");
+
+  // re-use binning of a preceding fix ave/euler with the same grid and group
+  // it is binned before this fix on time-steps where both are invoked
+
+  bin_source_ = NULL;
+  for(int ifix = 0; ifix < modify->nfix && modify->fix[ifix] != this; ifix++)
+  {
+    if(strncmp(modify->fix[ifix]->style,"ave/euler",9))
+        continue;
+    FixAveEuler *other = static_cast<FixAveEuler*>(modify->fix[ifix]);
+    if(other->groupbit == groupbit && other->parallel_ == parallel_ &&
+       other->cell_size_ideal_rel_ == cell_size_ideal_rel_)
+    {
+        bin_source_ = other;
+        break;
+    }
+  }
 }
 
 /* ----------------------------------------------------------------------
@@ -317,7 +340,7 @@ void FixAveEuler::setup_bins()
     if (ncells_ > ncells_max_)
     {
         ncells_max_ = ncells_;
-        memory->grow(cellhead_,ncells_max_,"ave/euler:cellhead_");
+        memory->grow(cellstart_,ncells_max_+1,"ave/euler:cellstart_");
         memory->grow(center_,ncells_max_,3,"ave/euler:center_");
         memory->grow(v_av_,  ncells_max_,3,"ave/euler:v_av_");
         memory->grow(vol_fr_,ncells_max_,  "ave/euler:vol_fr_");
@@ -419,11 +442,34 @@ void FixAveEuler::end_of_step()
     }
 
     // bin atoms
-    bin_atoms();
+    // re-use binning of other fix if it has binned this time-step
+    FixAveEuler *bins = this;
+    if(bin_source_ && bin_source_->binned_step_ == update->ntimestep && same_grid(bin_source_))
+        bins = bin_source_;
+    else
+        bin_atoms();
 
     // calculate Eulerian grid properties
     // performs allreduce if necessary
-    calculate_eu();
+    calculate_eu(bins->cellstart_,bins->cellatom_);
+}
+
+/* ----------------------------------------------------------------------
+   true if other fix ave/euler has the identical grid
+------------------------------------------------------------------------- */
+
+bool FixAveEuler::same_grid(FixAveEuler *other)
+{
+    if(other->groupbit != groupbit || other->ncells_ != ncells_)
+        return false;
+
+    for(int dim = 0; dim < 3; dim++)
+    {
+        if(other->ncells_dim_[dim] != ncells_dim_[dim] ||
+           other->lo_[dim] != lo_[dim] || other->cell_size_[dim] != cell_size_[dim])
+            return false;
+    }
+    return true;
 }
 
 /* ---------------------------------------------------------------------- */
@@ -445,6 +491,8 @@ int FixAveEuler::ncells_pack()
    bin owned and ghost atoms
    this also implies we do not need to wrap around PBCs
    bin ghost atoms only if inside my grid
+   atoms are sorted by cell (counting sort), so atoms of a cell are
+   contiguous in cellatom_ and in ascending order
 ------------------------------------------------------------------------- */
 
 void FixAveEuler::bin_atoms()
@@ -452,43 +500,64 @@ void FixAveEuler::bin_atoms()
   int i,ibin;
   double **x = atom->x;
   int *mask = atom->mask;
-  int nall = atom->nlocal + atom->nghost;
+  int nlocal = atom->nlocal;
+  int nall = nlocal + atom->nghost;
+
+  // ghost atoms can only be inside my grid if they have moved into my
+  // subdomain since atoms were last exchanged
+  // no need to look at ghosts if re-neighboring was done this time-step
 
-  for (i = 0; i < ncells_max_; i++)
-    cellhead_[i] = -1;
+  if(0 == neighbor->ago)
+    nall = nlocal;
 
-  // re-alloc cellptr_ if necessary
-  if(nall > ncellptr_max_)
+  // re-alloc cellatom_, atomcell_ if necessary
+  if(nall > ncellatom_max_)
   {
-      ncellptr_max_ = nall;
-      memory->grow(cellptr_,ncellptr_max_,"ave/pic:cellptr_");
+      ncellatom_max_ = nall;
+      memory->grow(cellatom_,ncellatom_max_,"ave/euler:cellatom_");
+      memory->grow(atomcell_,ncellatom_max_,"ave/euler:atomcell_");
   }
 
-  // bin in reverse order so linked list will be in forward order
-  // also use ghost atoms
-  // skip if any atom is out of (sub) box
+  // count atoms in each cell
+  // particles outside grid return ibin < 0, these are ignored
 
-  for (i = nall-1; i >= 0; i--)
+  for (i = 0; i <= ncells_; i++)
+    cellstart_[i] = 0;
+
+  for (i = 0; i < nall; i++)
   {
+      atomcell_[i] = -1;
       if(! (mask[i] & groupbit)) continue;
 
       ibin = coord2bin(x[i]);
+      if (ibin < 0) continue;
 
-      // particles outside grid may return values ibin < 0 || ibin >= ncells_
-      // these are ignores
-      
-      if (ibin < 0 || ibin >= ncells_) {
-        
-        continue;
-      }
+      atomcell_[i] = ibin;
+      cellstart_[ibin+1]++;
+  }
+
+  for (i = 0; i < ncells_; i++)
+    cellstart_[i+1] += cellstart_[i];
+
+  // fill cells in ascending atom order
+  // this advances cellstart_ of each cell to the start of the next one
 
-      cellptr_[i] = cellhead_[ibin];
-      cellhead_[ibin] = i;
+  for (i = 0; i < nall; i++)
+  {
+      ibin = atomcell_[i];
+      if (ibin >= 0)
+        cellatom_[cellstart_[ibin]++] = i;
   }
+
+  for (i = ncells_; i > 0; i--)
+    cellstart_[i] = cellstart_[i-1];
+  cellstart_[0] = 0;
+
+  binned_step_ = update->ntimestep;
 }
 
 /* ----------------------------------------------------------------------
-   map coord to grid, also return ix,iy,iz indices in each dim
+   map coord to grid, return -1 if outside my grid
 ------------------------------------------------------------------------- */
 
 inline int FixAveEuler::coord2bin(double *x)
@@ -497,11 +566,24 @@ inline int FixAveEuler::coord2bin(double *x)
   double float_iCell[3];
 
   if (triclinic_) {
-    double tmp_x[3];
-    domain->x2lamda(x,tmp_x);
+
+    // same as Domain::x2lamda()
+    double delta[3],tmp_x[3];
+    const double * const h_inv = domain->h_inv;
+    delta[0] = x[0] - domain->boxlo[0];
+    delta[1] = x[1] - domain->boxlo[1];
+    delta[2] = x[2] - domain->boxlo[2];
+    tmp_x[0] = h_inv[0]*delta[0] + h_inv[5]*delta[1] + h_inv[4]*delta[2];
+    tmp_x[1] = h_inv[1]*delta[1] + h_inv[3]*delta[2];
+    tmp_x[2] = h_inv[2]*delta[2];
+
     for (i=0;i<3;i++) {
       float_iCell[i] = (tmp_x[i]-lo_lamda_[i])*cell_size_lamda_inv_[i];
-      iCell[i] = static_cast<int> (float_iCell[i] >= 0 ? float_iCell[i] : float_iCell[i]-1);
+      if(float_iCell[i] < 0.)
+        return -1;
+      iCell[i] = static_cast<int> (float_iCell[i]);
+      if(iCell[i] >= ncells_dim_[i])
+        return -1;
     }
   } else {
     for (i=0;i<3;i++) {
@@ -512,6 +594,10 @@ inline int FixAveEuler::coord2bin(double *x)
         return -1;
       float_iCell[i] = (x[i]-lo_[i])*cell_size_inv_[i];
       iCell[i] = static_cast<int> (float_iCell[i]);
+
+      // guard against round-off at upper bound of grid
+      if(iCell[i] >= ncells_dim_[i])
+        iCell[i] = ncells_dim_[i]-1;
     }
   }
 
@@ -522,7 +608,7 @@ inline int FixAveEuler::coord2bin(double *x)
    calculate Eulerian data, use interpolation function
 ------------------------------------------------------------------------- */
 
-void FixAveEuler::calculate_eu()
+void FixAveEuler::calculate_eu(const int *cellstart, const int *cellatom)
 {
     //int ncount;
     double * const * const v = atom->v;
@@ -541,11 +627,13 @@ void FixAveEuler::calculate_eu()
     modify->clearstep_compute();
 
     // invoke compute if not previously invoked
+    // check time-step since the compute is shared by all fix ave/euler,
+    // and clearstep_compute() resets invoked_flag
+    // flag as invoked in any case so addstep_compute() below is applied
     
-    if (!(compute_stress_->invoked_flag & INVOKED_PERATOM)) {
+    if (compute_stress_->invoked_peratom != update->ntimestep)
         compute_stress_->compute_peratom();
-        compute_stress_->invoked_flag |= INVOKED_PERATOM;
-    }
+    compute_stress_->invoked_flag |= INVOKED_PERATOM;
 
     // forward comm per-particle stress from compute so neighs have it
     comm->forward_comm_compute(compute_stress_);
@@ -568,15 +656,19 @@ void FixAveEuler::calculate_eu()
 
         // skip if no particles in cell
         
-        if(-1 == cellhead_[icell])
+        if(cellstart[icell] == cellstart[icell+1])
             continue;
 
         // add contributions of particle - v and volume fraction
         // v is favre-averaged (mass-averaged)
         // radius is number-averaged
 
-        for(int iatom = cellhead_[icell/*+stencil*/]; iatom >= 0; iatom = cellptr_[iatom])
+        // atoms of a cell are contiguous, so sum up locally
+
+        double vol_fr = 0., rad = 0., mass = 0.;
+        for(int k = cellstart[icell]; k < cellstart[icell+1]; k++)
         {
+            const int iatom = cellatom[k];
             vectorScalarMult3D(v[iatom],rmass[iatom],vel_x_mass);
             vectorAdd3D(v_av_[icell],vel_x_mass,v_av_[icell]);
             double r = radius[iatom];
@@ -584,11 +676,14 @@ void FixAveEuler::calculate_eu()
             if(superquadric_flag)
                 r = cbrt(0.75 * volume[iatom] / M_PI);
             #endif
-            vol_fr_[icell] += r*r*r;
-            radius_[icell] += r;
-            mass_[icell] += rmass[iatom];
-            ncount_[icell]++;
+            vol_fr += r*r*r;
+            rad += r;
+            mass += rmass[iatom];
         }
+        vol_fr_[icell] = vol_fr;
+        radius_[icell] = rad;
+        mass_[icell] = mass;
+        ncount_[icell] = cellstart[icell+1] - cellstart[icell];
 
     }
 
@@ -624,14 +719,20 @@ void FixAveEuler::calculate_eu()
         // need v before can calculate stress
         // stress is molecular diffusion + contact forces
 
-        for(int iatom = cellhead_[icell/*+stencil*/]; iatom >= 0; iatom = cellptr_[iatom])
+        const double * const vav = v_av_[icell];
+        double * const stress = stress_[icell];
+        for(int k = cellstart[icell]; k < cellstart[icell+1]; k++)
         {
-            stress_[icell][1] += -rmass[iatom]*(v[iatom][0]-v_av_[icell][0])*(v[iatom][0]-v_av_[icell][0]) + stress_atom[iatom][0];
-            stress_[icell][2] += -rmass[iatom]*(v[iatom][1]-v_av_[icell][1])*(v[iatom][1]-v_av_[icell][1]) + stress_atom[iatom][1];
-            stress_[icell][3] += -rmass[iatom]*(v[iatom][2]-v_av_[icell][2])*(v[iatom][2]-v_av_[icell][2]) + stress_atom[iatom][2];
-            stress_[icell][4] += -rmass[iatom]*(v[iatom][0]-v_av_[icell][0])*(v[iatom][1]-v_av_[icell][1]) + stress_atom[iatom][3];
-            stress_[icell][5] += -rmass[iatom]*(v[iatom][0]-v_av_[icell][0])*(v[iatom][2]-v_av_[icell][2]) + stress_atom[iatom][4];
-            stress_[icell][6] += -rmass[iatom]*(v[iatom][1]-v_av_[icell][1])*(v[iatom][2]-v_av_[icell][2]) + stress_atom[iatom][5]; 
+            const int iatom = cellatom[k];
+            const double dv0 = v[iatom][0]-vav[0];
+            const double dv1 = v[iatom][1]-vav[1];
+            const double dv2 = v[iatom][2]-vav[2];
+            stress[1] += -rmass[iatom]*dv0*dv0 + stress_atom[iatom][0];
+            stress[2] += -rmass[iatom]*dv1*dv1 + stress_atom[iatom][1];
+            stress[3] += -rmass[iatom]*dv2*dv2 + stress_atom[iatom][2];
+            stress[4] += -rmass[iatom]*dv0*dv1 + stress_atom[iatom][3];
+            stress[5] += -rmass[iatom]*dv0*dv2 + stress_atom[iatom][4];
+            stress[6] += -rmass[iatom]*dv1*dv2 + stress_atom[iatom][5];
         }
         stress_[icell][0] = -0.333333333333333*(stress_[icell][1]+stress_[icell][2]+stress_[icell][3]);
         if(weight_[icell] < eps_ntry)
@@ -73,6 +73,14 @@ class FixAveEuler : public Fix {
 
   int ncells_pack();
 
+  inline bool is_parallel() const
+  { return parallel_; }
+
+  // # of cells, local to this proc in parallel mode
+
+  inline int ncells() const
+  { return ncells_; }
+
   // inline access functions for cell based values
 
   inline double cell_center(int i, int j)
@@ -100,7 +108,8 @@ class FixAveEuler : public Fix {
 
   void setup_bins();
   void bin_atoms();
-  void calculate_eu();
+  bool same_grid(FixAveEuler *other);
+  void calculate_eu(const int *cellstart, const int *cellatom);
   void allreduce();
   inline int coord2bin(double *x); 
 
@@ -131,15 +140,22 @@ class FixAveEuler : public Fix {
   double cell_size_lamda_[3]; 
   double cell_size_lamda_inv_[3]; 
 
-  // length of cellhead_, center_, v_av_, vol_fr_ arrays
+  // length of center_, v_av_, vol_fr_ arrays
   int ncells_max_;
 
-  // length of cellptr_ array
-  int ncellptr_max_;
+  // length of cellatom_, atomcell_ arrays
+  int ncellatom_max_;
+
+  // atom - cell mapping, compressed sparse row layout
+  int *cellstart_;     // index of 1st atom of each cell in cellatom_, ncells_+1
+  int *cellatom_;      // binned atoms, sorted by cell
+  int *atomcell_;      // cell of each atom, -1 if not binned
+
+  // time-step of last binning
+  bigint binned_step_;
 
-  // atom - cell mapping
-  int *cellhead_;    // ptr to 1st atom in each cell
-  int *cellptr_;       // ptr to next atom in each bin
+  // fix ave/euler with identical grid whose binning is re-used, NULL if none
+  FixAveEuler *bin_source_;
 
   // region
   char *idregion_;
@@ -48,6 +48,7 @@
 #include "memory.h"
 #include "modify.h"
 #include "comm.h"
+#include "force.h"
 #include <cmath>
 #include "vector_liggghts.h"
 #include "mpi_liggghts.h"
@@ -66,6 +67,7 @@ FixCfdCouplingForce::FixCfdCouplingForce(LAMMPS *lmp, int narg, char **arg) : Fi
     fix_dispersionTime_(0),
     fix_dispersionVel_(0),
     fix_UrelOld_(0),
+    fix_cg_(0),
     use_force_(true),
     use_torque_(true),
     use_dens_(false),
@@ -316,6 +318,22 @@ void FixCfdCouplingForce::post_create()
         fix_dispersionVel_ = modify->add_fix_property_atom(11,const_cast<char**>(fixarg),style);
     }
 
+    // register coarsegraining factor so the CFD side can scale drag
+    if(!fix_cg_ && force->cg_active())
+    {
+        const char* fixarg[9];
+        fixarg[0]="cg";
+        fixarg[1]="all";
+        fixarg[2]="property/atom";
+        fixarg[3]="cg";
+        fixarg[4]="scalar"; // 1 scalar per particle to be registered
+        fixarg[5]="no";     // restart
+        fixarg[6]="no";     // communicate ghost
+        fixarg[7]="no";     // communicate rev
+        fixarg[8]="1.";
+        fix_cg_ = modify->add_fix_property_atom(9,const_cast<char**>(fixarg),style);
+    }
+
     if(use_fiber_topo_)
     {
         const char *fixarg[] = {
@@ -333,6 +351,7 @@ void FixCfdCouplingForce::pre_delete(bool unfixflag)
 {
     if(unfixflag && fix_dragforce_) modify->delete_fix("dragforce");
     if(unfixflag && fix_hdtorque_) modify->delete_fix("hdtorque");
+    if(unfixflag && fix_cg_) modify->delete_fix("cg");
 }
 
 /* ---------------------------------------------------------------------- */
@@ -375,6 +394,7 @@ void FixCfdCouplingForce::init()
     if(use_id_) fix_coupling_->add_push_property("id","scalar-atom");
 
     if(use_property_) fix_coupling_->add_push_property(property_name,property_type);
+    if(fix_cg_) fix_coupling_->add_push_property("cg","scalar-atom");
 
     // values to come from OF
     if(use_force_) fix_coupling_->add_pull_property("dragforce","vector-atom");
@@ -424,6 +444,8 @@ void FixCfdCouplingForce::post_force(int)
   vectorZeroize3D(dragforce_total);
   vectorZeroize3D(hdtorque_total);
 
+  update_cg();
+
   // add dragforce to force vector
   
   for (int i = 0; i < nlocal; i++)
@@ -444,6 +466,23 @@ void FixCfdCouplingForce::post_force(int)
   }
 }
 
+/* ----------------------------------------------------------------------
+   fill per-particle cg factor, particles may have been inserted since
+   the last coupling step
+------------------------------------------------------------------------- */
+
+void FixCfdCouplingForce::update_cg()
+{
+  if(!fix_cg_) return;
+
+  double *cg = fix_cg_->vector_atom;
+  int *type = atom->type;
+  int nlocal = atom->nlocal;
+
+  for (int i = 0; i < nlocal; i++)
+    cg[i] = force->cg(type[i]);
+}
+
 /* ----------------------------------------------------------------------
    return components of total force on fix group
 ------------------------------------------------------------------------- */
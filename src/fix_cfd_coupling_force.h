@@ -84,6 +84,10 @@ class FixCfdCouplingForce : public Fix  {
 
   class FixPropertyAtom* fix_UrelOld_;
 
+  // per-particle coarsegraining factor pushed to CFD if cg is active
+  class FixPropertyAtom* fix_cg_;
+  void update_cg();
+
   bool use_force_, use_torque_, use_dens_, use_type_;
   bool use_stochastic_;
   bool use_virtualMass_;
@@ -260,6 +260,8 @@ void FixCfdCouplingForceImplicit::post_force(int)
   vectorZeroize3D(dragforce_total);
   vectorZeroize3D(hdtorque_total);
 
+  update_cg();
+
   // add dragforce to force vector
   for (int i = 0; i < nlocal; i++)
   {
@@ -55,6 +55,7 @@
 #include "modify.h"
 #include "fix_wall_gran.h"
 #include "fix_mesh_surface.h"
+#include "fix_multirate_gran.h"
 #include "neighbor.h"
 #include "mpi_liggghts.h"
 #include "property_registry.h"
@@ -164,6 +165,10 @@ void FixCheckTimestepGran::init()
       if(static_cast<FixWallGran*>(modify->find_fix_style("wall/gran",i))->is_mesh_wall())
         fwg = static_cast<FixWallGran*>(modify->find_fix_style("wall/gran",i));
 
+  // contacts in the coarse class of fix multirate/gran use a larger time-step
+
+  fmr = static_cast<FixMultirateGran*>(modify->find_fix_style_strict("multirate/gran",0));
+
   Y = static_cast<FixPropertyGlobal*>(modify->find_fix_property("youngsModulus","property/global","peratomtype",max_type,0,style));
   nu = static_cast<FixPropertyGlobal*>(modify->find_fix_property("poissonsRatio","property/global","peratomtype",max_type,0,style));
 
@@ -260,6 +265,7 @@ void FixCheckTimestepGran::calc_rayleigh_hertz_estims()
 
         double shear_mod = Y->get_values()[type[i]-1]/(2.*(nu->get_values()[type[i]-1]+1.));
         rayleigh_time_i = M_PI*rad*sqrt(density[i]/shear_mod)/(0.1631*nu->get_values()[type[i]-1]+0.8766);
+        if(fmr && fmr->coarse(mask[i],r[i])) rayleigh_time_i /= fmr->every();
         if(rayleigh_time_i < rayleigh_time) rayleigh_time = rayleigh_time_i;
 
         vmag_sqr = vectorMag3DSquared(v[i]);
@@ -346,6 +352,7 @@ void FixCheckTimestepGran::calc_rayleigh_hertz_estims()
                     }    
                     #endif
                     hertz_time_i = 2.87*pow(meff*meff/(reff*Eeff*Eeff*v_rel_max_simulation),0.2);
+                    if(fmr && fmr->coarse(mask[i],r[i])) hertz_time_i /= fmr->every();
                     if(hertz_time_i<hertz_time_min)
                         hertz_time_min=hertz_time_i;
                 }
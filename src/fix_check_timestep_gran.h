@@ -64,6 +64,7 @@ class FixCheckTimestepGran : public Fix {
   class Properties* properties;
   class PairGran* pg;
   class FixWallGran* fwg;
+  class FixMultirateGran* fmr;
   class FixPropertyGlobal* Y;
   class FixPropertyGlobal* nu;
   void calc_rayleigh_hertz_estims();
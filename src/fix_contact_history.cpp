@@ -64,6 +64,7 @@
 #include "update.h"
 #include "modify.h"
 #include "memory.h"
+#include "math_extra.h"
 #include "math_extra_liggghts.h"
 #include "error.h"
 
@@ -79,6 +80,8 @@ FixContactHistory::FixContactHistory(LAMMPS *lmp, int narg, char **arg) :
   newtonflag_(0),
   history_id_(0),
   index_decide_noncontacting_(-1),
+  nvector_(0),
+  vector_offset_(0),
   npartner_(0),
   partner_(0),
   contacthistory_(0),
@@ -161,6 +164,41 @@ FixContactHistory::FixContactHistory(LAMMPS *lmp, int narg, char **arg) :
         error->fix_error(FLERR,this,"newtonflag must be either 0 or 1");
 
   }
+
+  // detect vector-valued history, i.e. three consecutive ids which only
+  // differ in one character being x/y/z or 0/1/2 (e.g. shearx/y/z)
+
+  vector_offset_ = new int[dnum_/3+1];
+  for(int i = 0; i+2 < dnum_; i++)
+  {
+    if(is_vector_triple(&history_id_[i]))
+    {
+        vector_offset_[nvector_++] = i;
+        i += 2;
+    }
+  }
+}
+
+/* ---------------------------------------------------------------------- */
+
+bool FixContactHistory::is_vector_triple(char **ids)
+{
+  const size_t len = strlen(ids[0]);
+  if(strlen(ids[1]) != len || strlen(ids[2]) != len)
+    return false;
+
+  int ndiff = 0;
+  for(size_t c = 0; c < len; c++)
+  {
+    if(ids[0][c] == ids[1][c] && ids[0][c] == ids[2][c])
+        continue;
+    if(++ndiff > 1)
+        return false;
+    if(!(ids[0][c] == 'x' && ids[1][c] == 'y' && ids[2][c] == 'z') &&
+       !(ids[0][c] == '0' && ids[1][c] == '1' && ids[2][c] == '2'))
+        return false;
+  }
+  return ndiff == 1;
 }
 
 /* ---------------------------------------------------------------------- */
@@ -182,6 +220,7 @@ FixContactHistory::~FixContactHistory()
 
   if(variablename_) delete [] variablename_;
   if(newtonflag_) delete [] newtonflag_;
+  if(vector_offset_) delete [] vector_offset_;
 
   if(history_id_)
   {
@@ -440,6 +479,26 @@ void FixContactHistory::min_pre_exchange()
   pre_exchange();
 }
 
+/* ----------------------------------------------------------------------
+   rotate vector-valued history of all partners of atom i
+------------------------------------------------------------------------- */
+
+void FixContactHistory::rotate_history(int i, const double rot[3][3])
+{
+  double tmp[3];
+
+  for(int ipartner = 0; ipartner < npartner_[i]; ipartner++)
+  {
+    double *h = &contacthistory_[i][ipartner*dnum_];
+    for(int ivec = 0; ivec < nvector_; ivec++)
+    {
+        double *hv = &h[vector_offset_[ivec]];
+        MathExtra::matvec(rot,hv,tmp);
+        vectorCopy3D(tmp,hv);
+    }
+  }
+}
+
 /* ----------------------------------------------------------------------
    memory usage of local atom-based arrays
 ------------------------------------------------------------------------- */
@@ -109,6 +109,13 @@ class FixContactHistory : public Fix {
   inline int get_dnum()
   { return dnum_; }
 
+  // rotate vector-valued history of atom i, used by rotationally
+  // periodic domains when an atom is mapped across a wedge face
+  void rotate_history(int i, const double rot[3][3]);
+
+  // true if ids[0..2] only differ in one character being x/y/z or 0/1/2
+  static bool is_vector_triple(char **ids);
+
  protected:
 
   int iarg_;
@@ -119,6 +126,10 @@ class FixContactHistory : public Fix {
   char **history_id_;
   int index_decide_noncontacting_;
 
+  // offsets of history values that form x/y/z vector triples
+  int nvector_;
+  int *vector_offset_;
+
   int *npartner_;                // # of touching partners of each atom
   int **partner_;                // tags for the partners
   double **contacthistory_;     // contact history values with the partner
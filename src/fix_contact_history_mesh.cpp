@@ -76,6 +76,10 @@ FixContactHistoryMesh::FixContactHistoryMesh(LAMMPS *lmp, int narg, char **arg)
   intersectpage_(0),
   keepflag_(0),
   intersectflag_(0),
+  hash_(0),
+  hash_size_(0),
+  hash_part_(0),
+  hash_nmax_(0),
   mesh_(0),
   fix_neighlist_mesh_(0),
   fix_nneighs_(0),
@@ -92,6 +96,10 @@ FixContactHistoryMesh::FixContactHistoryMesh(LAMMPS *lmp, int narg, char **arg)
 
   swap_ = new double[dnum_];
 
+  // pre_force() only rebuilds mesh contact history of owned atoms
+
+  pre_force_overlap = 1;
+
   // initial allocation of keepflag
   keepflag_ = (bool **) memory->srealloc(keepflag_,atom->nmax*sizeof(bool *),
                                       "contact_history:keepflag");
@@ -135,6 +143,9 @@ FixContactHistoryMesh::~FixContactHistoryMesh()
 
   if(keepflag_) memory->sfree(keepflag_);
   if(intersectflag_) memory->sfree(intersectflag_);
+
+  memory->destroy(hash_);
+  memory->destroy(hash_part_);
 }
 
 /* ---------------------------------------------------------------------- */
@@ -423,6 +434,54 @@ void FixContactHistoryMesh::markAllContacts()
       if (!keepflag_[i] || !intersectflag_[i])
         error->one(FLERR,"mesh contact history overflow, boost neigh_modify one");
     }
+
+    hash_rebuild();
+}
+
+/* ----------------------------------------------------------------------
+   build per-particle lookup tables from partner_
+------------------------------------------------------------------------- */
+
+void FixContactHistoryMesh::hash_rebuild()
+{
+    const int nlocal = atom->nlocal;
+
+    if(nlocal > hash_nmax_)
+    {
+      hash_nmax_ = atom->nmax;
+      memory->destroy(hash_part_);
+      memory->create(hash_part_,hash_nmax_,3,"contact_history:hash_part");
+    }
+
+    int size = 0;
+    for(int i = 0; i < nlocal; i++)
+    {
+      const int nneighs = fix_nneighs_->get_vector_atom_int(i);
+      int isize = 2;
+      while(isize < 2*nneighs)
+        isize *= 2;
+      hash_part_[i][0] = size;
+      hash_part_[i][1] = isize-1;
+      hash_part_[i][2] = -1;
+      size += isize;
+    }
+
+    if(size > hash_size_)
+    {
+      hash_size_ = size;
+      memory->destroy(hash_);
+      memory->create(hash_,hash_size_,3,"contact_history:hash");
+    }
+    for(int e = 0; e < size; e++)
+      hash_[e][0] = -1;
+
+    for(int i = 0; i < nlocal; i++)
+    {
+      const int nneighs = fix_nneighs_->get_vector_atom_int(i);
+      for(int j = 0; j < nneighs; j++)
+        if(partner_[i][j] >= 0)
+          hash_insert(i,partner_[i][j],j);
+    }
 }
 
 /* ---------------------------------------------------------------------- */
@@ -677,6 +736,9 @@ double FixContactHistoryMesh::memory_usage()
     bytes += intersectpage_[i]->size();
   }
 
+  bytes += 3*hash_size_ * sizeof(int);
+  bytes += 3*hash_nmax_ * sizeof(int);
+
   return bytes;
 }
 
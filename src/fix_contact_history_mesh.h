@@ -137,6 +137,26 @@ class FixContactHistoryMesh : public FixContactHistory {
   void checkCoplanarContactHistory(int indexPart, int idTri, double *&history);
   void addNewTriContactToExistingParticle(int indexPart, int idTri, double *&history, bool intersectflag);
 
+  // open-addressing tables triangle ID -> slot in partner_, one per
+  // particle, rebuilt in markAllContacts(), so contact lookups do not have
+  // to scan all neighbor triangles of a particle
+  // each table has at least 2*nneighs entries, so inserts never have to
+  // grow it, and it is only touched by its own particle, so
+  // different particles may be handled concurrently
+  // hash_ columns: triangle ID, slot, next entry touched this step
+  // hash_part_ columns: offset, mask and head of the chain of entries
+  // handled in this step, i.e. the ones with keepflag set
+
+  int **hash_;
+  int hash_size_;
+  int **hash_part_;
+  int hash_nmax_;
+
+  void hash_rebuild();
+  inline int hash_find(int iP, int idTri) const;
+  inline int hash_insert(int iP, int idTri, int slot);
+  inline void touch(int iP, int entry);
+
   class TriMesh *mesh_;
   class FixNeighlistMesh *fix_neighlist_mesh_;
   class FixPropertyAtom* fix_nneighs_;
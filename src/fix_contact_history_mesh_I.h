@@ -110,39 +110,77 @@
 
   /* ---------------------------------------------------------------------- */
 
+  inline int FixContactHistoryMesh::hash_find(int iP, int idTri) const
+  {
+    const int offset = hash_part_[iP][0];
+    const int mask = hash_part_[iP][1];
+    int e = static_cast<int>((unsigned int)idTri*2654435761u & (unsigned int)mask);
+    while(hash_[offset+e][0] >= 0)
+    {
+        if(hash_[offset+e][0] == idTri)
+            return offset+e;
+        e = (e+1) & mask;
+    }
+    return -1;
+  }
+
+  /* ---------------------------------------------------------------------- */
+
+  inline int FixContactHistoryMesh::hash_insert(int iP, int idTri, int slot)
+  {
+    const int offset = hash_part_[iP][0];
+    const int mask = hash_part_[iP][1];
+    int e = static_cast<int>((unsigned int)idTri*2654435761u & (unsigned int)mask);
+    while(hash_[offset+e][0] >= 0)
+        e = (e+1) & mask;
+
+    hash_[offset+e][0] = idTri;
+    hash_[offset+e][1] = slot;
+    hash_[offset+e][2] = -1;
+    return offset+e;
+  }
+
+  /* ---------------------------------------------------------------------- */
+
+  inline void FixContactHistoryMesh::touch(int iP, int entry)
+  {
+    hash_[entry][2] = hash_part_[iP][2];
+    hash_part_[iP][2] = entry;
+  }
+
+  /* ---------------------------------------------------------------------- */
+
   inline bool FixContactHistoryMesh::haveContact(int iP, int idTri, double *&history,bool intersect)
   {
-    int *tri = partner_[iP];
-    const int nneighs = fix_nneighs_->get_vector_atom_int(iP);
+    const int e = hash_find(iP,idTri);
+    if(e < 0)
+        return false;
 
-    for(int i = 0; i < nneighs; i++)
+    const int i = hash_[e][1];
+    if(dnum_ > 0) history = &(contacthistory_[iP][i*dnum_]);
+    if(!keepflag_[iP][i])
     {
-        if(tri[i] == idTri)
-        {
-            if(dnum_ > 0) history = &(contacthistory_[iP][i*dnum_]);
-            keepflag_[iP][i] = true;
-            intersectflag_[iP][i] = intersect;
-            return true;
-        }
+        keepflag_[iP][i] = true;
+        touch(iP,e);
     }
-    return false;
+    intersectflag_[iP][i] = intersect;
+    return true;
   }
 
   /* ---------------------------------------------------------------------- */
 
   inline bool FixContactHistoryMesh::coplanarContactAlready(int iP, int idTri)
   {
-    const int nneighs = fix_nneighs_->get_vector_atom_int(iP);
-    for(int i = 0; i < nneighs; i++)
+    // only contacts handled in this step are candidates
+
+    for(int e = hash_part_[iP][2]; e >= 0; e = hash_[e][2])
     {
-      
-      int idPartnerTri = partner_[iP][i];
+      const int idPartnerTri = hash_[e][0];
 
-      if(idPartnerTri >= 0 && idPartnerTri != idTri && mesh_->map(idPartnerTri, 0) >= 0 && mesh_->areCoplanarNodeNeighs(idPartnerTri,idTri))
+      if(idPartnerTri != idTri && mesh_->map(idPartnerTri, 0) >= 0 && mesh_->areCoplanarNodeNeighs(idPartnerTri,idTri))
       {
-        
         // other coplanar contact handled already - do not handle this contact
-        if(keepflag_[iP][i]) return true;
+        return true;
       }
     }
 
@@ -202,6 +240,7 @@
       partner_[iP][iContact] = idTri;
       keepflag_[iP][iContact] = true;
       intersectflag_[iP][iContact] = intersect;
+      touch(iP,hash_insert(iP,idTri,iContact));
 
       if(dnum_ > 0)
       {
@@ -51,6 +51,7 @@
 #include "modify.h"
 #include "neigh_list.h"
 #include "pair_gran.h"
+#include "fix_multirate_gran.h"
 #include <cmath>
 #include <algorithm>
 
@@ -313,9 +314,6 @@ void FixHeatGranCond::init()
   }
 
   updatePtrs();
-
-  // error checks on coarsegraining
-  
 }
 
 /* ---------------------------------------------------------------------- */
@@ -334,21 +332,24 @@ void FixHeatGranCond::pre_force(int vflag)
 
 void FixHeatGranCond::post_force(int vflag)
 {
+  // also fill compute pair/gran/local if it captures data on this step
+
+  const int cpl_flag = (cpl && cpl->rewind_for_heat()) ? 2 : 0;
 
   if(history_flag == 0 && CONDUCTION_CONTACT_AREA_OVERLAP == area_calculation_mode_)
-    post_force_eval<0,CONDUCTION_CONTACT_AREA_OVERLAP>(vflag,0);
+    post_force_eval<0,CONDUCTION_CONTACT_AREA_OVERLAP>(vflag,cpl_flag);
   if(history_flag == 1 && CONDUCTION_CONTACT_AREA_OVERLAP == area_calculation_mode_)
-    post_force_eval<1,CONDUCTION_CONTACT_AREA_OVERLAP>(vflag,0);
+    post_force_eval<1,CONDUCTION_CONTACT_AREA_OVERLAP>(vflag,cpl_flag);
 
   if(history_flag == 0 && CONDUCTION_CONTACT_AREA_CONSTANT == area_calculation_mode_)
-    post_force_eval<0,CONDUCTION_CONTACT_AREA_CONSTANT>(vflag,0);
+    post_force_eval<0,CONDUCTION_CONTACT_AREA_CONSTANT>(vflag,cpl_flag);
   if(history_flag == 1 && CONDUCTION_CONTACT_AREA_CONSTANT == area_calculation_mode_)
-    post_force_eval<1,CONDUCTION_CONTACT_AREA_CONSTANT>(vflag,0);
+    post_force_eval<1,CONDUCTION_CONTACT_AREA_CONSTANT>(vflag,cpl_flag);
 
   if(history_flag == 0 && CONDUCTION_CONTACT_AREA_PROJECTION == area_calculation_mode_)
-    post_force_eval<0,CONDUCTION_CONTACT_AREA_PROJECTION>(vflag,0);
+    post_force_eval<0,CONDUCTION_CONTACT_AREA_PROJECTION>(vflag,cpl_flag);
   if(history_flag == 1 && CONDUCTION_CONTACT_AREA_PROJECTION == area_calculation_mode_)
-    post_force_eval<1,CONDUCTION_CONTACT_AREA_PROJECTION>(vflag,0);
+    post_force_eval<1,CONDUCTION_CONTACT_AREA_PROJECTION>(vflag,cpl_flag);
 }
 
 /* ---------------------------------------------------------------------- */
@@ -373,7 +374,11 @@ void FixHeatGranCond::cpl_evaluate(ComputePairGranLocal *caller)
     post_force_eval<1,CONDUCTION_CONTACT_AREA_PROJECTION>(0,1);
 }
 
-/* ---------------------------------------------------------------------- */
+/* ----------------------------------------------------------------------
+   cpl_flag = 0: regular pass
+   cpl_flag = 1: only add heat flux to compute pair/gran/local
+   cpl_flag = 2: regular pass, also add heat flux to compute
+------------------------------------------------------------------------- */
 
 template <int HISTFLAG,int CONTACTAREA>
 void FixHeatGranCond::post_force_eval(int vflag,int cpl_flag)
@@ -406,6 +411,13 @@ void FixHeatGranCond::post_force_eval(int vflag,int cpl_flag)
 
   updatePtrs();
 
+  // fix multirate/gran: pairs within the coarse class are not evaluated by
+  // the pair style on every step, so compute pair/gran/local has no row
+  // for them to put the heat flux in
+
+  FixMultirateGran * const fix_multirate = pair_gran->fix_multirate();
+  const bool mr_skip = cpl_flag && fix_multirate && !fix_multirate->coarse_step();
+
   if(store_contact_data_)
   {
     fix_conduction_contact_area_->set_all(0.);
@@ -475,7 +487,13 @@ void FixHeatGranCond::post_force_eval(int vflag,int cpl_flag)
                 contactArea = - M_PI/4.0 * ( (r-radi-radj)*(r+radi-radj)*(r-radi+radj)*(r+radi+radj) )/(r*r);
         }
         else if (CONTACTAREA == CONDUCTION_CONTACT_AREA_CONSTANT)
+        {
+            // coarsegraining: a fixed area does not grow with the particles,
+            // scale it so the bulk conductivity stays independent of cg
             contactArea = fixed_contact_area_;
+            if(force->cg_active())
+              contactArea *= force->cg(type[i])*force->cg(type[j]);
+        }
         else if (CONTACTAREA == CONDUCTION_CONTACT_AREA_PROJECTION)
         {
             double rmax = std::max(radi,radj);
@@ -492,7 +510,7 @@ void FixHeatGranCond::post_force_eval(int vflag,int cpl_flag)
         dirFlux[0] = flux*delx;
         dirFlux[1] = flux*dely;
         dirFlux[2] = flux*delz;
-        if(!cpl_flag)
+        if(cpl_flag != 1)
         {
           //Add half of the flux (located at the contact) to each particle in contact
           heatFlux[i] += flux;
@@ -520,7 +538,9 @@ void FixHeatGranCond::post_force_eval(int vflag,int cpl_flag)
           }
         }
 
-        if(cpl_flag && cpl) cpl->add_heat(i,j,flux);
+        if(cpl_flag && cpl &&
+           !(mr_skip && fix_multirate->coarse(mask[i],radius[i]) && fix_multirate->coarse(mask[j],radius[j])))
+          cpl->add_heat(i,j,flux);
       }
     }
   }
@@ -533,7 +553,7 @@ void FixHeatGranCond::post_force_eval(int vflag,int cpl_flag)
     fix_n_conduction_contacts_->do_reverse_comm();
   }
 
-  if(!cpl_flag && store_contact_data_)
+  if(cpl_flag != 1 && store_contact_data_)
   for(int i = 0; i < nlocal; i++)
   {
      if(n_conduction_contacts_[i] > 0.5)
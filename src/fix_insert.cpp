@@ -367,6 +367,16 @@ void FixInsert::setup(int vflag)
   if(setup_flag) return;
   else setup_flag = true;
 
+  // coarsegraining: particle counts and rates given by the user refer to
+  // original particles, convert them to coarse grained parcels
+  if(force->cg_active())
+  {
+      const double scale = cg_count_scale();
+      if(ninsert > 0)
+        ninsert = std::max(1,static_cast<int>(static_cast<double>(ninsert)*scale+0.5));
+      nflowrate *= scale;
+  }
+
   // calculate ninsert, insert_every, ninsert_per
   calc_insertion_properties();
 
@@ -394,6 +404,26 @@ void FixInsert::setup(int vflag)
 
 }
 
+/* ----------------------------------------------------------------------
+   factor converting a number of original particles to a number of
+   coarse grained parcels, 1/cg^3
+   only defined if all inserted types share the same cg factor
+------------------------------------------------------------------------- */
+
+double FixInsert::cg_count_scale()
+{
+  if(!force->cg_active())
+    return 1.;
+
+  const double cg = force->cg(type_min);
+  for(int itype = type_min+1; itype <= type_max; itype++)
+    if(fabs(force->cg(itype)-cg) > 1e-10*cg)
+      error->fix_error(FLERR,this,"particle numbers and rates with type-specific coarsegraining factors are "
+                                  "ambiguous. Please use 'mass', 'massrate' or 'mass_in_region' instead");
+
+  return 1./(cg*cg*cg);
+}
+
 /* ---------------------------------------------------------------------- */
 
 void FixInsert::init_defaults()
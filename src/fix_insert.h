@@ -201,6 +201,7 @@ class FixInsert : public Fix {
   virtual void init_defaults();
   virtual void sanity_check();
   virtual void calc_insertion_properties() = 0;
+  double cg_count_scale();
 
   virtual bool pre_insert() { return true; }
   virtual int calc_ninsert_this();
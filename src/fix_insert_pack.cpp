@@ -41,6 +41,7 @@
 ------------------------------------------------------------------------- */
 
 #include <cmath>
+#include <algorithm>
 #include <stdlib.h>
 #include <string.h>
 #include "fix_insert_pack.h"
@@ -231,6 +232,10 @@ void FixInsertPack::calc_insertion_properties()
     if(n_defined != 1)
         error->fix_error(FLERR,this,"must define exactly one keyword out of 'volumefraction_region', 'particles_in_region', and 'mass_in_region'");
 
+    // coarsegraining: particles_in_region refers to original particles
+    if(ntotal_region > 0 && force->cg_active())
+        ntotal_region = std::max(1,static_cast<int>(static_cast<double>(ntotal_region)*cg_count_scale()+0.5));
+
 }
 
 /* ----------------------------------------------------------------------
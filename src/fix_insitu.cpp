@@ -0,0 +1,780 @@
+/* ----------------------------------------------------------------------
+    This is the
+
+    ██╗     ██╗ ██████╗  ██████╗  ██████╗ ██╗  ██╗████████╗███████╗
+    ██║     ██║██╔════╝ ██╔════╝ ██╔════╝ ██║  ██║╚══██╔══╝██╔════╝
+    ██║     ██║██║  ███╗██║  ███╗██║  ███╗███████║   ██║   ███████╗
+    ██║     ██║██║   ██║██║   ██║██║   ██║██╔══██║   ██║   ╚════██║
+    ███████╗██║╚██████╔╝╚██████╔╝╚██████╔╝██║  ██║   ██║   ███████║
+    ╚══════╝╚═╝ ╚═════╝  ╚═════╝  ╚═════╝ ╚═╝  ╚═╝   ╚═╝   ╚══════╝®
+
+    DEM simulation engine, released by
+    DCS Computing Gmbh, Linz, Austria
+    http://www.dcs-computing.com, office@dcs-computing.com
+
+    LIGGGHTS® is part of CFDEM®project:
+    http://www.liggghts.com | http://www.cfdem.com
+
+    Core developer and main author:
+    Christoph Kloss, christoph.kloss@dcs-computing.com
+
+    LIGGGHTS® is open-source, distributed under the terms of the GNU Public
+    License, version 2 or later. It is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+    of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. You should have
+    received a copy of the GNU General Public License along with LIGGGHTS®.
+    If not, see http://www.gnu.org/licenses . See also top-level README
+    and LICENSE files.
+
+    LIGGGHTS® and CFDEM® are registered trade marks of DCS Computing GmbH,
+    the producer of the LIGGGHTS® software and the CFDEM®coupling software
+    See http://www.cfdem.com/terms-trademark-policy for details.
+
+-------------------------------------------------------------------------
+    Contributing author and copyright for this file:
+    (if not contributing author is listed, this file has been contributed
+    by the core developer)
+
+    Copyright 2012-     DCS Computing GmbH, Linz
+------------------------------------------------------------------------- */
+
+
+#include <string.h>
+#include <stdlib.h>
+#include <cmath>
+#include <algorithm>
+#include "fix_insitu.h"
+#include "fix_ave_euler.h"
+#include "atom.h"
+#include "update.h"
+#include "modify.h"
+#include "compute.h"
+#include "input.h"
+#include "variable.h"
+#include "domain.h"
+#include "region.h"
+#include "force.h"
+#include "comm.h"
+#include "memory.h"
+#include "error.h"
+
+using namespace LAMMPS_NS;
+using namespace FixConst;
+
+// # of bins per refinement level of the percentile search
+
+#define NBINS_PERCENTILE 1024
+
+#define BIG 1.0e20
+
+/* ---------------------------------------------------------------------- */
+
+FixInsitu::FixInsitu(LAMMPS *lmp, int narg, char **arg) :
+  Fix(lmp, narg, arg),
+  prefix_(NULL),
+  nwriters_(1),
+  me_(comm->me),
+  maxatom_(0),
+  vbuf_(NULL)
+{
+  if (narg < 6) error->fix_error(FLERR,this,"not enough arguments");
+
+  nevery = force->inumeric(FLERR,arg[3]);
+  if (nevery <= 0) error->fix_error(FLERR,this,"N > 0 required");
+
+  int n = strlen(arg[4]) + 1;
+  prefix_ = new char[n];
+  strcpy(prefix_,arg[4]);
+
+  int iarg = 5;
+  while (iarg < narg) {
+    Product p;
+    p.fp = NULL;
+    p.writer = 0;
+    p.which = p.argindex = p.index = -1;
+    p.lo = p.hi = 0.;
+    p.nbins = 0;
+    p.dim = -1;
+    p.pending = p.nrequest = p.count = 0;
+    p.step = 0;
+    p.n = p.vmin = p.vmax = 0.;
+
+    if (strcmp(arg[iarg],"ranks") == 0) {
+      if (iarg+2 > narg) error->fix_error(FLERR,this,"not enough arguments for 'ranks'");
+      nwriters_ = force->inumeric(FLERR,arg[iarg+1]);
+      if (nwriters_ < 1) error->fix_error(FLERR,this,"'ranks' > 0 required");
+      nwriters_ = std::min(nwriters_,comm->nprocs);
+      iarg += 2;
+      continue;
+    } else if (strcmp(arg[iarg],"euler") == 0) {
+      if (iarg+2 > narg) error->fix_error(FLERR,this,"not enough arguments for 'euler'");
+      p.style = EULER;
+      p.id = p.label = arg[iarg+1];
+      iarg += 2;
+    } else if (strcmp(arg[iarg],"histo") == 0) {
+      if (iarg+5 > narg) error->fix_error(FLERR,this,"not enough arguments for 'histo'");
+      p.style = HISTO;
+      parse_source(p,arg[iarg+1]);
+      p.lo = force->numeric(FLERR,arg[iarg+2]);
+      p.hi = force->numeric(FLERR,arg[iarg+3]);
+      p.nbins = force->inumeric(FLERR,arg[iarg+4]);
+      if (p.hi <= p.lo || p.nbins <= 0)
+        error->fix_error(FLERR,this,"'histo' requires lo < hi and nbins > 0");
+      iarg += 5;
+    } else if (strcmp(arg[iarg],"percentile") == 0) {
+      if (iarg+3 > narg) error->fix_error(FLERR,this,"not enough arguments for 'percentile'");
+      p.style = PERCENTILE;
+      parse_source(p,arg[iarg+1]);
+      iarg += 2;
+      while (iarg < narg) {
+        char *end;
+        const double pct = strtod(arg[iarg],&end);
+        if (end == arg[iarg] || *end != '\0') break;
+        if (pct < 0. || pct > 100.)
+          error->fix_error(FLERR,this,"percentiles must be between 0 and 100");
+        p.percent.push_back(pct);
+        iarg++;
+      }
+      if (p.percent.empty())
+        error->fix_error(FLERR,this,"'percentile' requires at least one value");
+    } else if (strcmp(arg[iarg],"massflow") == 0) {
+      if (iarg+3 > narg) error->fix_error(FLERR,this,"not enough arguments for 'massflow'");
+      p.style = MASSFLOW;
+      p.id = p.label = arg[iarg+1];
+      if (domain->find_region(arg[iarg+1]) < 0)
+        error->fix_error(FLERR,this,"region ID for 'massflow' does not exist");
+      if (strcmp(arg[iarg+2],"x") == 0) p.dim = 0;
+      else if (strcmp(arg[iarg+2],"y") == 0) p.dim = 1;
+      else if (strcmp(arg[iarg+2],"z") == 0) p.dim = 2;
+      else error->fix_error(FLERR,this,"expecting 'x', 'y' or 'z' after 'massflow' region ID");
+      iarg += 3;
+    } else {
+      char errstr[512];
+      sprintf(errstr,"unknown keyword %s",arg[iarg]);
+      error->fix_error(FLERR,this,errstr);
+    }
+
+    products_.push_back(p);
+  }
+
+  if (products_.empty())
+    error->fix_error(FLERR,this,"no products specified");
+
+  // writers are spread evenly over the ranks
+
+  for (size_t k = 0; k < products_.size(); k++)
+    products_[k].writer = (k % nwriters_) * (comm->nprocs / nwriters_);
+
+  MPI_Comm_dup(world,&comm_insitu_);
+
+  // one file per product, opened by its writer
+
+  int count[4] = {0,0,0,0};
+  for (size_t k = 0; k < products_.size(); k++) {
+    Product &p = products_[k];
+    const int style = p.style;
+    count[style]++;
+    if (style == EULER) open_file(p,"euler",count[style]);
+    else if (style == HISTO) open_file(p,"histo",count[style]);
+    else if (style == PERCENTILE) open_file(p,"percentile",count[style]);
+    else open_file(p,"massflow",count[style]);
+
+    if (!p.fp) continue;
+
+    if (style == EULER) {
+      fprintf(p.fp,"# Cell-averaged data of fix %s\n",p.id.c_str());
+      fprintf(p.fp,"# Timestep Number-of-cells\n");
+      fprintf(p.fp,"# Cell x y z vol_fr vx vy vz pressure radius\n");
+    } else if (style == HISTO) {
+      fprintf(p.fp,"# Histogram of %s\n",p.label.c_str());
+      fprintf(p.fp,"# Timestep Number-of-bins Total Below Above\n");
+      fprintf(p.fp,"# Bin Coord Count Count/Total\n");
+    } else if (style == PERCENTILE) {
+      fprintf(p.fp,"# Percentiles of %s\n",p.label.c_str());
+      fprintf(p.fp,"# Timestep Count Min");
+      for (size_t m = 0; m < p.percent.size(); m++)
+        fprintf(p.fp," p%g",p.percent[m]);
+      fprintf(p.fp," Max\n");
+    } else {
+      fprintf(p.fp,"# Mass flow through region %s in %c direction\n",p.id.c_str(),'x'+p.dim);
+      fprintf(p.fp,"# Timestep Mass Massflowrate\n");
+    }
+    fflush(p.fp);
+  }
+
+  // ensure computes are invoked on the first output step
+
+  modify->addstep_compute_all((update->ntimestep/nevery)*nevery + nevery);
+}
+
+/* ---------------------------------------------------------------------- */
+
+FixInsitu::~FixInsitu()
+{
+  for (size_t k = 0; k < products_.size(); k++)
+    if (products_[k].fp) fclose(products_[k].fp);
+  delete [] prefix_;
+  memory->destroy(vbuf_);
+  MPI_Comm_free(&comm_insitu_);
+}
+
+/* ----------------------------------------------------------------------
+   per-atom source c_ID, c_ID[N], f_ID, f_ID[N] or v_name
+------------------------------------------------------------------------- */
+
+void FixInsitu::parse_source(Product &p, const char *arg)
+{
+  if (strncmp(arg,"c_",2) == 0) p.which = COMPUTE;
+  else if (strncmp(arg,"f_",2) == 0) p.which = FIX;
+  else if (strncmp(arg,"v_",2) == 0) p.which = VARIABLE;
+  else error->fix_error(FLERR,this,"per-atom source has to be c_ID, f_ID or v_name");
+
+  std::string name(&arg[2]);
+  p.label = arg;
+  p.argindex = 0;
+
+  const size_t bracket = name.find('[');
+  if (bracket != std::string::npos) {
+    if (p.which == VARIABLE || name[name.size()-1] != ']')
+      error->fix_error(FLERR,this,"illegal per-atom source");
+    p.argindex = atoi(name.substr(bracket+1).c_str());
+    if (p.argindex <= 0) error->fix_error(FLERR,this,"illegal per-atom source");
+    name = name.substr(0,bracket);
+  }
+
+  p.id = name;
+}
+
+/* ---------------------------------------------------------------------- */
+
+void FixInsitu::open_file(Product &p, const char *suffix, int k)
+{
+  if (me_ != p.writer) return;
+
+  char fname[512];
+  sprintf(fname,"%s.%s%d",prefix_,suffix,k);
+  p.fp = fopen(fname,"w");
+  if (!p.fp) {
+    char errstr[600];
+    sprintf(errstr,"Cannot open fix insitu file %s",fname);
+    error->one(FLERR,errstr);
+  }
+}
+
+/* ---------------------------------------------------------------------- */
+
+int FixInsitu::setmask()
+{
+  int mask = 0;
+  mask |= END_OF_STEP;
+  return mask;
+}
+
+/* ---------------------------------------------------------------------- */
+
+void FixInsitu::init()
+{
+  const int ifix_this = modify->find_fix(id);
+
+  for (size_t k = 0; k < products_.size(); k++) {
+    Product &p = products_[k];
+
+    if (p.style == EULER) {
+      p.index = modify->find_fix(p.id.c_str());
+      if (p.index < 0)
+        error->fix_error(FLERR,this,"fix ID for 'euler' does not exist");
+      if (strncmp(modify->fix[p.index]->style,"ave/euler",9) != 0)
+        error->fix_error(FLERR,this,"fix for 'euler' has to be of style ave/euler");
+      if (nevery % modify->fix[p.index]->nevery)
+        error->fix_error(FLERR,this,"N has to be a multiple of nevery of fix ave/euler");
+      if (p.index > ifix_this)
+        error->fix_error(FLERR,this,"fix ave/euler has to be defined before this fix");
+
+    } else if (p.style == MASSFLOW) {
+      p.index = domain->find_region(p.id.c_str());
+      if (p.index < 0)
+        error->fix_error(FLERR,this,"region ID for 'massflow' does not exist");
+      if (!domain->regions[p.index]->bboxflag)
+        error->fix_error(FLERR,this,"region for 'massflow' has to have a bounding box");
+
+    } else if (p.which == COMPUTE) {
+      p.index = modify->find_compute(p.id.c_str());
+      if (p.index < 0)
+        error->fix_error(FLERR,this,"compute ID for per-atom source does not exist");
+      Compute *compute = modify->compute[p.index];
+      if (!compute->peratom_flag)
+        error->fix_error(FLERR,this,"compute does not calculate per-atom values");
+      if (p.argindex == 0 && compute->size_peratom_cols != 0)
+        error->fix_error(FLERR,this,"compute does not calculate a per-atom vector");
+      if (p.argindex && (compute->size_peratom_cols == 0 || p.argindex > compute->size_peratom_cols))
+        error->fix_error(FLERR,this,"compute per-atom array is accessed out-of-range");
+
+    } else if (p.which == FIX) {
+      p.index = modify->find_fix(p.id.c_str());
+      if (p.index < 0)
+        error->fix_error(FLERR,this,"fix ID for per-atom source does not exist");
+      Fix *fix = modify->fix[p.index];
+      if (!fix->peratom_flag)
+        error->fix_error(FLERR,this,"fix does not calculate per-atom values");
+      if (p.argindex == 0 && fix->size_peratom_cols != 0)
+        error->fix_error(FLERR,this,"fix does not calculate a per-atom vector");
+      if (p.argindex && (fix->size_peratom_cols == 0 || p.argindex > fix->size_peratom_cols))
+        error->fix_error(FLERR,this,"fix per-atom array is accessed out-of-range");
+      if (nevery % fix->peratom_freq)
+        error->fix_error(FLERR,this,"fix for per-atom source not computed at compatible time");
+
+    } else if (p.which == VARIABLE) {
+      p.index = input->variable->find(const_cast<char*>(p.id.c_str()));
+      if (p.index < 0)
+        error->fix_error(FLERR,this,"variable name for per-atom source does not exist");
+      if (!input->variable->atomstyle(p.index))
+        error->fix_error(FLERR,this,"variable for per-atom source has to be atom-style");
+    }
+  }
+
+  modify->addstep_compute_all((update->ntimestep/nevery)*nevery + nevery);
+}
+
+/* ----------------------------------------------------------------------
+   evaluate all products, called every N steps
+   the reductions of the previous output step are completed and written
+   first, so they have had N steps to progress in the background
+------------------------------------------------------------------------- */
+
+void FixInsitu::end_of_step()
+{
+  finish_all();
+
+  // sources may invoke computes so wrap with clear/add
+
+  modify->clearstep_compute();
+
+  for (size_t k = 0; k < products_.size(); k++) {
+    Product &p = products_[k];
+    if (p.style == EULER) reduce_euler(p,k);
+    else if (p.style == HISTO) reduce_histo(p);
+    else if (p.style == PERCENTILE) reduce_percentile(p);
+    else reduce_massflow(p);
+  }
+
+  modify->addstep_compute(update->ntimestep + nevery);
+}
+
+/* ----------------------------------------------------------------------
+   write the products of the last output step of the run
+------------------------------------------------------------------------- */
+
+void FixInsitu::post_run()
+{
+  finish_all();
+}
+
+/* ---------------------------------------------------------------------- */
+
+void FixInsitu::finish_all()
+{
+  for (size_t k = 0; k < products_.size(); k++)
+    finish(products_[k],k);
+}
+
+/* ----------------------------------------------------------------------
+   complete the reduction of a product and write it on its writer
+------------------------------------------------------------------------- */
+
+void FixInsitu::finish(Product &p, int k)
+{
+  if (!p.pending) return;
+  p.pending = 0;
+
+  if (p.nrequest && comm->nprocs > 1) {
+    MPI_Status status[2];
+    MPI_Waitall(p.nrequest,p.request,status);
+  }
+  p.nrequest = 0;
+
+  if (me_ != p.writer) return;
+
+  if (p.style == EULER) {
+
+    // cells of the other procs, in the order of the procs
+
+    const bool gather = static_cast<FixAveEuler*>(modify->fix[p.index])->is_parallel() &&
+                        comm->nprocs > 1;
+    p.recvbuf.clear();
+    for (int iproc = 0; iproc < comm->nprocs; iproc++) {
+      if (iproc == me_) {
+        p.recvbuf.insert(p.recvbuf.end(),p.sendbuf.begin(),p.sendbuf.begin()+p.count);
+        continue;
+      }
+      if (!gather) continue;
+      MPI_Status status;
+      int count;
+      MPI_Recv(&count,1,MPI_INT,iproc,2*k,comm_insitu_,&status);
+      if (count == 0) continue;
+      const size_t offset = p.recvbuf.size();
+      p.recvbuf.resize(offset+count);
+      MPI_Recv(&p.recvbuf[offset],count,MPI_DOUBLE,iproc,2*k+1,comm_insitu_,&status);
+    }
+    write_euler(p);
+  }
+  else if (p.style == HISTO) write_histo(p);
+  else if (p.style == PERCENTILE) write_percentile(p);
+  else write_massflow(p);
+}
+
+/* ----------------------------------------------------------------------
+   per-atom values of a source, values of atom i are at i*stride
+------------------------------------------------------------------------- */
+
+const double *FixInsitu::peratom_values(Product &p, int &stride)
+{
+  stride = 1;
+
+  if (p.which == COMPUTE) {
+    Compute *compute = modify->compute[p.index];
+    if (!(compute->invoked_flag & INVOKED_PERATOM)) {
+      compute->compute_peratom();
+      compute->invoked_flag |= INVOKED_PERATOM;
+    }
+    if (p.argindex == 0) return compute->vector_atom;
+    stride = compute->size_peratom_cols;
+    return compute->array_atom ? &compute->array_atom[0][p.argindex-1] : NULL;
+
+  } else if (p.which == FIX) {
+    Fix *fix = modify->fix[p.index];
+    if (p.argindex == 0) return fix->vector_atom;
+    stride = fix->size_peratom_cols;
+    return fix->array_atom ? &fix->array_atom[0][p.argindex-1] : NULL;
+  }
+
+  if (atom->nmax > maxatom_) {
+    memory->destroy(vbuf_);
+    maxatom_ = atom->nmax;
+    memory->create(vbuf_,maxatom_,"insitu:vbuf");
+  }
+  input->variable->compute_atom(p.index,igroup,vbuf_,1,0);
+  return vbuf_;
+}
+
+/* ----------------------------------------------------------------------
+   cell data of fix ave/euler
+   in parallel mode the cells of all procs are sent to the writer, which
+   receives them when the reduction is completed. otherwise every proc
+   holds the complete grid already
+------------------------------------------------------------------------- */
+
+void FixInsitu::reduce_euler(Product &p, int k)
+{
+  FixAveEuler *fae = static_cast<FixAveEuler*>(modify->fix[p.index]);
+  const int ncol = 9;
+  const bool gather = fae->is_parallel() && comm->nprocs > 1;
+
+  if (!gather && me_ != p.writer) return;
+
+  const int nlocal_cells = fae->ncells();
+  p.count = ncol*nlocal_cells;
+  p.sendbuf.resize(p.count);
+
+  for (int i = 0; i < nlocal_cells; i++) {
+    double *row = &p.sendbuf[ncol*i];
+    row[0] = fae->cell_center(i,0);
+    row[1] = fae->cell_center(i,1);
+    row[2] = fae->cell_center(i,2);
+    row[3] = fae->cell_vol_fr(i);
+    row[4] = fae->cell_v_av(i,0);
+    row[5] = fae->cell_v_av(i,1);
+    row[6] = fae->cell_v_av(i,2);
+    row[7] = fae->cell_pressure(i);
+    row[8] = fae->cell_radius(i);
+  }
+
+  p.step = update->ntimestep;
+  p.pending = 1;
+  p.nrequest = 0;
+
+  // the count is sent ahead of the cells so the writer can size its buffer
+
+  if (gather && me_ != p.writer) {
+    MPI_Isend(&p.count,1,MPI_INT,p.writer,2*k,comm_insitu_,&p.request[p.nrequest++]);
+    if (p.count)
+      MPI_Isend(&p.sendbuf[0],p.count,MPI_DOUBLE,p.writer,2*k+1,comm_insitu_,
+                &p.request[p.nrequest++]);
+  }
+}
+
+/* ---------------------------------------------------------------------- */
+
+void FixInsitu::write_euler(Product &p)
+{
+  const int ncol = 9;
+  const int ncells = p.recvbuf.size()/ncol;
+
+  fprintf(p.fp,BIGINT_FORMAT " %d\n",p.step,ncells);
+  for (int i = 0; i < ncells; i++) {
+    const double *row = &p.recvbuf[ncol*i];
+    fprintf(p.fp,"%d %g %g %g %g %g %g %g %g %g\n",i+1,
+            row[0],row[1],row[2],row[3],row[4],row[5],row[6],row[7],row[8]);
+  }
+  fflush(p.fp);
+}
+
+/* ----------------------------------------------------------------------
+   histogram of a per-atom quantity, counts out of range kept separately
+------------------------------------------------------------------------- */
+
+void FixInsitu::reduce_histo(Product &p)
+{
+  int stride;
+  const double *values = peratom_values(p,stride);
+  const int *mask = atom->mask;
+  const int nlocal = atom->nlocal;
+  const int nbins = p.nbins;
+  const double binsize = (p.hi-p.lo)/nbins;
+  const double bininv = 1./binsize;
+
+  // bins 0 and nbins+1 hold counts below and above the range
+
+  p.sendbuf.assign(nbins+2,0.);
+  p.recvbuf.assign(me_ == p.writer ? nbins+2 : 0,0.);
+  double *counts = &p.sendbuf[0];
+
+  if (values)
+    for (int i = 0; i < nlocal; i++) {
+      if (!(mask[i] & groupbit)) continue;
+      const double value = values[i*stride];
+      int ibin;
+      if (value < p.lo) ibin = 0;
+      else if (value > p.hi) ibin = nbins+1;
+      else ibin = std::min(static_cast<int>((value-p.lo)*bininv),nbins-1) + 1;
+      counts[ibin] += 1.;
+    }
+
+  p.step = update->ntimestep;
+  p.pending = 1;
+  p.nrequest = 1;
+  MPI_Ireduce(counts,me_ == p.writer ? &p.recvbuf[0] : NULL,nbins+2,MPI_DOUBLE,
+              MPI_SUM,p.writer,comm_insitu_,&p.request[0]);
+}
+
+/* ---------------------------------------------------------------------- */
+
+void FixInsitu::write_histo(Product &p)
+{
+  const int nbins = p.nbins;
+  const double binsize = (p.hi-p.lo)/nbins;
+  const double *counts_all = &p.recvbuf[0];
+
+  double total = 0.;
+  for (int ibin = 0; ibin < nbins+2; ibin++) total += counts_all[ibin];
+  const double totalinv = total > 0. ? 1./total : 0.;
+
+  fprintf(p.fp,BIGINT_FORMAT " %d %g %g %g\n",p.step,nbins,
+          total,counts_all[0],counts_all[nbins+1]);
+  for (int ibin = 0; ibin < nbins; ibin++)
+    fprintf(p.fp,"%d %g %g %g\n",ibin+1,p.lo+(ibin+0.5)*binsize,
+            counts_all[ibin+1],counts_all[ibin+1]*totalinv);
+  fflush(p.fp);
+}
+
+/* ----------------------------------------------------------------------
+   percentiles of a per-atom quantity without gathering the values
+   a percentile interpolates linearly between the order statistics k and
+   k+1 with k = floor(percent/100*(n-1)). a histogram over [min,max]
+   locates the bin of each of these order statistics, a second histogram
+   within that bin refines it, so they are exact to
+   (max-min)/NBINS_PERCENTILE^2
+   range and coarse histogram are needed on all procs to pick the refined
+   bins, so only the reduction of the refined histograms is non-blocking
+------------------------------------------------------------------------- */
+
+void FixInsitu::reduce_percentile(Product &p)
+{
+  int stride;
+  const double *values = peratom_values(p,stride);
+  const int *mask = atom->mask;
+  const int nlocal = atom->nlocal;
+  const int nb = NBINS_PERCENTILE;
+  const int npct = p.percent.size();
+  const int ntarget = 2*npct;
+
+  // range
+
+  double range[2] = {-BIG,-BIG};
+  if (values)
+    for (int i = 0; i < nlocal; i++) {
+      if (!(mask[i] & groupbit)) continue;
+      const double value = values[i*stride];
+      range[0] = std::max(range[0],-value);
+      range[1] = std::max(range[1],value);
+    }
+  double range_all[2];
+  MPI_Allreduce(range,range_all,2,MPI_DOUBLE,MPI_MAX,world);
+  p.vmin = -range_all[0];
+  p.vmax = range_all[1];
+  const double vmin = p.vmin;
+  const double width = p.vmax - vmin;
+  const double coarse_size = width/nb;
+  const double coarse_inv = width > 0. ? 1./coarse_size : 0.;
+
+  // coarse histogram
+
+  std::vector<double> coarse(nb,0.),coarse_all(nb,0.);
+  if (values)
+    for (int i = 0; i < nlocal; i++) {
+      if (!(mask[i] & groupbit)) continue;
+      const int ibin = std::min(static_cast<int>((values[i*stride]-vmin)*coarse_inv),nb-1);
+      coarse[ibin] += 1.;
+    }
+  MPI_Allreduce(&coarse[0],&coarse_all[0],nb,MPI_DOUBLE,MPI_SUM,world);
+
+  double n = 0.;
+  for (int ibin = 0; ibin < nb; ibin++) n += coarse_all[ibin];
+  p.n = n;
+
+  // coarse bin of the order statistics k and k+1 of each percentile
+  // and # of values in lower bins
+
+  p.order.assign(ntarget,0.);
+  p.below.assign(ntarget,0.);
+  p.target.assign(ntarget,0);
+  for (int m = 0; m < npct; m++) {
+    const double k = floor(0.01*p.percent[m]*std::max(n-1.,0.));
+    p.order[2*m] = k;
+    p.order[2*m+1] = std::min(k+1.,std::max(n-1.,0.));
+  }
+  for (int t = 0; t < ntarget; t++) {
+    double cum = 0.;
+    int ibin = 0;
+    while (ibin < nb-1 && cum + coarse_all[ibin] <= p.order[t]) cum += coarse_all[ibin++];
+    p.target[t] = ibin;
+    p.below[t] = cum;
+  }
+
+  // refined histograms within the target bins
+
+  const double fine_inv = width > 0. ? nb*coarse_inv : 0.;
+  p.sendbuf.assign(nb*ntarget,0.);
+  p.recvbuf.assign(me_ == p.writer ? nb*ntarget : 0,0.);
+  double *fine = &p.sendbuf[0];
+  if (values)
+    for (int i = 0; i < nlocal; i++) {
+      if (!(mask[i] & groupbit)) continue;
+      const double value = values[i*stride];
+      const int ibin = std::min(static_cast<int>((value-vmin)*coarse_inv),nb-1);
+      for (int t = 0; t < ntarget; t++) {
+        if (ibin != p.target[t]) continue;
+        const double off = value - (vmin + ibin*coarse_size);
+        const int jbin = std::max(0,std::min(static_cast<int>(off*fine_inv),nb-1));
+        fine[t*nb+jbin] += 1.;
+      }
+    }
+
+  p.step = update->ntimestep;
+  p.pending = 1;
+  p.nrequest = 1;
+  MPI_Ireduce(fine,me_ == p.writer ? &p.recvbuf[0] : NULL,nb*ntarget,MPI_DOUBLE,
+              MPI_SUM,p.writer,comm_insitu_,&p.request[0]);
+}
+
+/* ---------------------------------------------------------------------- */
+
+void FixInsitu::write_percentile(Product &p)
+{
+  const int nb = NBINS_PERCENTILE;
+  const int npct = p.percent.size();
+  const int ntarget = 2*npct;
+  const double n = p.n;
+
+  fprintf(p.fp,BIGINT_FORMAT " %.0f",p.step,n);
+  if (n < 1.) {
+    for (int m = 0; m < npct+2; m++) fprintf(p.fp," nan");
+    fprintf(p.fp,"\n");
+    fflush(p.fp);
+    return;
+  }
+
+  // order statistics are taken as center of their fine bin
+
+  const double coarse_size = (p.vmax-p.vmin)/nb;
+  const double fine_size = coarse_size/nb;
+  std::vector<double> ostat(ntarget,0.);
+  for (int t = 0; t < ntarget; t++) {
+    double cum = p.below[t];
+    const double *hist = &p.recvbuf[t*nb];
+    int jbin = 0;
+    while (jbin < nb-1 && cum + hist[jbin] <= p.order[t]) cum += hist[jbin++];
+    const double value = p.vmin + p.target[t]*coarse_size + (jbin+0.5)*fine_size;
+    ostat[t] = std::max(p.vmin,std::min(p.vmax,value));
+  }
+
+  fprintf(p.fp," %g",p.vmin);
+  for (int m = 0; m < npct; m++) {
+    const double frac = 0.01*p.percent[m]*(n-1.) - p.order[2*m];
+    fprintf(p.fp," %g",ostat[2*m] + frac*(ostat[2*m+1]-ostat[2*m]));
+  }
+  fprintf(p.fp," %g\n",p.vmax);
+  fflush(p.fp);
+}
+
+/* ----------------------------------------------------------------------
+   mass in a region and mass flow rate through it, estimated as the mass
+   flux sum(m*v) divided by the extent of the region in flow direction
+------------------------------------------------------------------------- */
+
+void FixInsitu::reduce_massflow(Product &p)
+{
+  Region *region = domain->regions[p.index];
+  region->prematch();
+
+  double **x = atom->x;
+  double **v = atom->v;
+  double *rmass = atom->rmass;
+  double *mass = atom->mass;
+  int *type = atom->type;
+  int *mask = atom->mask;
+  const int nlocal = atom->nlocal;
+  const int dim = p.dim;
+
+  p.sendbuf.assign(2,0.);
+  p.recvbuf.assign(2,0.);
+  double *sum = &p.sendbuf[0];
+  for (int i = 0; i < nlocal; i++) {
+    if (!(mask[i] & groupbit) || !region->match(x[i])) continue;
+    const double m = rmass ? rmass[i] : mass[type[i]];
+    sum[0] += m;
+    sum[1] += m*v[i][dim];
+  }
+
+  p.step = update->ntimestep;
+  p.pending = 1;
+  p.nrequest = 1;
+  MPI_Ireduce(sum,&p.recvbuf[0],2,MPI_DOUBLE,MPI_SUM,p.writer,comm_insitu_,&p.request[0]);
+}
+
+/* ---------------------------------------------------------------------- */
+
+void FixInsitu::write_massflow(Product &p)
+{
+  Region *region = domain->regions[p.index];
+  const int dim = p.dim;
+  const double *sum_all = &p.recvbuf[0];
+
+  double extent;
+  if (dim == 0) extent = region->extent_xhi - region->extent_xlo;
+  else if (dim == 1) extent = region->extent_yhi - region->extent_ylo;
+  else extent = region->extent_zhi - region->extent_zlo;
+
+  fprintf(p.fp,BIGINT_FORMAT " %g %g\n",p.step,sum_all[0],
+          extent > 0. ? sum_all[1]/extent : 0.);
+  fflush(p.fp);
+}
+
+/* ---------------------------------------------------------------------- */
+
+double FixInsitu::memory_usage()
+{
+  double bytes = maxatom_ * sizeof(double);
+  for (size_t k = 0; k < products_.size(); k++)
+    bytes += (products_[k].sendbuf.capacity() + products_[k].recvbuf.capacity()) * sizeof(double);
+  return bytes;
+}
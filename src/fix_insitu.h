@@ -0,0 +1,148 @@
+/* ----------------------------------------------------------------------
+    This is the
+
+    ██╗     ██╗ ██████╗  ██████╗  ██████╗ ██╗  ██╗████████╗███████╗
+    ██║     ██║██╔════╝ ██╔════╝ ██╔════╝ ██║  ██║╚══██╔══╝██╔════╝
+    ██║     ██║██║  ███╗██║  ███╗██║  ███╗███████║   ██║   ███████╗
+    ██║     ██║██║   ██║██║   ██║██║   ██║██╔══██║   ██║   ╚════██║
+    ███████╗██║╚██████╔╝╚██████╔╝╚██████╔╝██║  ██║   ██║   ███████║
+    ╚══════╝╚═╝ ╚═════╝  ╚═════╝  ╚═════╝ ╚═╝  ╚═╝   ╚═╝   ╚══════╝®
+
+    DEM simulation engine, released by
+    DCS Computing Gmbh, Linz, Austria
+    http://www.dcs-computing.com, office@dcs-computing.com
+
+    LIGGGHTS® is part of CFDEM®project:
+    http://www.liggghts.com | http://www.cfdem.com
+
+    Core developer and main author:
+    Christoph Kloss, christoph.kloss@dcs-computing.com
+
+    LIGGGHTS® is open-source, distributed under the terms of the GNU Public
+    License, version 2 or later. It is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+    of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. You should have
+    received a copy of the GNU General Public License along with LIGGGHTS®.
+    If not, see http://www.gnu.org/licenses . See also top-level README
+    and LICENSE files.
+
+    LIGGGHTS® and CFDEM® are registered trade marks of DCS Computing GmbH,
+    the producer of the LIGGGHTS® software and the CFDEM®coupling software
+    See http://www.cfdem.com/terms-trademark-policy for details.
+
+-------------------------------------------------------------------------
+    Contributing author and copyright for this file:
+    (if not contributing author is listed, this file has been contributed
+    by the core developer)
+
+    Copyright 2012-     DCS Computing GmbH, Linz
+------------------------------------------------------------------------- */
+
+
+#ifdef FIX_CLASS
+
+FixStyle(insitu,FixInsitu)
+
+#else
+
+#ifndef LMP_FIX_INSITU_H
+#define LMP_FIX_INSITU_H
+
+#include <stdio.h>
+#include <vector>
+#include <string>
+#include "fix.h"
+
+namespace LAMMPS_NS {
+
+/* ----------------------------------------------------------------------
+   in-situ reduction stage
+   evaluates a list of reduced products (Eulerian cell averages of a fix
+   ave/euler, histograms and percentiles of per-atom quantities, mass flow
+   through regions) and writes only these products. each product is
+   reduced onto and written by one of a subset of writer ranks. the
+   reductions are non-blocking: they are started on one output step and
+   completed and written on the next one or at the end of the run
+------------------------------------------------------------------------- */
+
+class FixInsitu : public Fix {
+ public:
+  FixInsitu(class LAMMPS *, int, char **);
+  ~FixInsitu();
+  int setmask();
+  void init();
+  void end_of_step();
+  void post_run();
+  double memory_usage();
+
+ private:
+  enum{EULER,HISTO,PERCENTILE,MASSFLOW};
+  enum{COMPUTE,FIX,VARIABLE};
+
+  struct Product {
+    int style;
+    int writer;                  // rank that reduces and writes this product
+    FILE *fp;
+
+    std::string label;           // argument as given by the user
+    std::string id;              // fix ave/euler, per-atom source or region
+    int which;                   // COMPUTE, FIX or VARIABLE for per-atom source
+    int argindex;                // 0 for vector, 1-N for column of array
+    int index;                   // index of fix, compute, variable or region
+
+    double lo,hi;                // histogram range
+    int nbins;
+    std::vector<double> percent; // requested percentiles
+    int dim;                     // flow direction for mass flow
+
+    // reduction in flight, started on output step 'step'
+
+    int pending;
+    bigint step;
+    int nrequest;
+    MPI_Request request[2];
+    int count;                   // # of values sent by this proc for euler
+    std::vector<double> sendbuf,recvbuf;
+
+    // state of a percentile reduction known before the fine histograms
+    // are reduced
+
+    double n,vmin,vmax;
+    std::vector<double> order,below;
+    std::vector<int> target;
+  };
+
+  void parse_source(Product &p, const char *arg);
+  void open_file(Product &p, const char *suffix, int k);
+
+  const double *peratom_values(Product &p, int &stride);
+  void reduce_euler(Product &p, int k);
+  void reduce_histo(Product &p);
+  void reduce_percentile(Product &p);
+  void reduce_massflow(Product &p);
+
+  void finish_all();
+  void finish(Product &p, int k);
+  void write_euler(Product &p);
+  void write_histo(Product &p);
+  void write_percentile(Product &p);
+  void write_massflow(Product &p);
+
+  char *prefix_;
+  int nwriters_;
+  int me_;
+  std::vector<Product> products_;
+
+  // private communicator, so messages in flight between two output steps
+  // can not be matched by other communication on world
+
+  MPI_Comm comm_insitu_;
+
+  int maxatom_;
+  double *vbuf_;               // per-atom values of atom-style variables
+};
+
+}
+
+#endif
+#endif
@@ -467,7 +467,9 @@ void FixMassflowMesh::post_integrate()
                 {
                     
                     mass_this += (fix_volumeweight_ms_ ? fix_volumeweight_ms_->vector_atom[iPart] : 1.) * rmass[iPart];
-                    nparticles_this += (fix_volumeweight_ms_ ? fix_volumeweight_ms_->vector_atom[iPart] : 1.);
+                    // coarsegraining: a parcel stands for cg^3 original particles
+                    const double cg_iPart = force->cg(atom->type[iPart]);
+                    nparticles_this += (fix_volumeweight_ms_ ? fix_volumeweight_ms_->vector_atom[iPart] : 1.)*cg_iPart*cg_iPart*cg_iPart;
 
                     if(fix_property_)
                     {
@@ -556,7 +558,8 @@ void FixMassflowMesh::pre_exchange()
             int iPart = atom->map(atom_tags_delete_[0]);
 
             mass_deleted_this_ += atom->rmass[iPart];
-            nparticles_deleted_this += (fix_volumeweight_ms_ ? fix_volumeweight_ms_->vector_atom[iPart] : 1.);
+            const double cg_iPart = force->cg(atom->type[iPart]);
+            nparticles_deleted_this += (fix_volumeweight_ms_ ? fix_volumeweight_ms_->vector_atom[iPart] : 1.)*cg_iPart*cg_iPart*cg_iPart;
 
             atom->avec->copy(atom->nlocal-1,iPart,1);
 
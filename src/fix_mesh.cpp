@@ -65,6 +65,7 @@
 #include "comm.h"
 #include "math_extra.h"
 #include "string_liggghts.h"
+#include "tri_mesh_simplify.h"
 
 using namespace LAMMPS_NS;
 using namespace FixConst;
@@ -80,11 +81,14 @@ FixMesh::FixMesh(LAMMPS *lmp, int narg, char **arg)
   mesh_(NULL),
   setupFlag_(false),
   pOpFlag_(false),
+  pOpPending_(false),
   manipulated_(false),
   verbose_(false),
   autoRemoveDuplicates_(false),
   precision_(0.),
   min_feature_length_(-1.),
+  simplify_(false),
+  simplify_angle_(acos(1.-EPSILON_CURVATURE)*180./M_PI),
   element_exclusion_list_(0),
   read_exclusion_list_(false),
   exclusion_list_(0),
@@ -103,6 +107,10 @@ FixMesh::FixMesh(LAMMPS *lmp, int narg, char **arg)
     force_reneighbor = 1;
     next_reneighbor = -1;
 
+    // pre_force() only communicates and updates mesh data
+
+    pre_force_overlap = 1;
+
     // parse args
 
     iarg_ = 3;
@@ -163,6 +171,15 @@ FixMesh::FixMesh(LAMMPS *lmp, int narg, char **arg)
             if(min_feature_length_ <= 0.)
               error->fix_error(FLERR,this,"0 < min_feature_length > 0.0 required");
             hasargs = true;
+        } else if(strcmp(arg[iarg_],"simplify") == 0) {
+            if(narg < iarg_+2)
+                error->fix_error(FLERR,this,"not enough arguments for 'simplify'");
+            if(strcmp(arg[iarg_+1],"yes") == 0)
+                simplify_ = true;
+            else if(strcmp(arg[iarg_+1],"no"))
+                error->fix_error(FLERR,this,"expecting 'yes' or 'no' for 'simplify'");
+            iarg_ += 2;
+            hasargs = true;
         } else if (strcmp(arg[iarg_],"element_exclusion_list") == 0) {
             if (narg < iarg_+3) error->fix_error(FLERR,this,"not enough arguments");
             iarg_++;
@@ -199,6 +216,18 @@ FixMesh::FixMesh(LAMMPS *lmp, int narg, char **arg)
     if(min_feature_length_ > 0. && (!element_exclusion_list_ || read_exclusion_list_))
         error->fix_error(FLERR,this,"'min_feature_length' requires use of 'element_exclusion_list write'");
 
+    // line numbers of simplified elements do not map to the file any more
+    if(simplify_ && element_exclusion_list_ && !read_exclusion_list_)
+        error->fix_error(FLERR,this,"'simplify' can not be used along with 'element_exclusion_list write'");
+    if(simplify_ && is_fix)
+        error->fix_error(FLERR,this,"'simplify' requires a mesh file");
+
+    // simplification is bounded by the curvature, which is a surface
+    // keyword and thus parsed by fix mesh/surface after the mesh is read
+    for(int i = iarg_; simplify_ && i < narg-1; i++)
+        if(strcmp(arg[i],"curvature") == 0)
+            simplify_angle_ = force->numeric(FLERR,arg[i+1]);
+
     // create/handle exclusion list
     handle_exclusion_list();
 
@@ -374,13 +403,22 @@ void FixMesh::create_mesh(char *mesh_fname, bool is_fix)
             // can be from STL file or VTK file
             InputMeshTri *mesh_input = new InputMeshTri(lmp,0,NULL);
 
+            // simplification bounded by mesh precision and curvature
+            TriMeshSimplify *mesh_simplify = NULL;
+            if(simplify_)
+            {
+                const double precision = precision_ > 0. ? precision_ : EPSILON_PRECISION;
+                mesh_simplify = new TriMeshSimplify(lmp,precision,simplify_angle_);
+            }
+
             // case write exlusion list
             if(!read_exclusion_list_ && element_exclusion_list_)
                 mesh_->setElementExclusionList(element_exclusion_list_);
 
             mesh_input->meshtrifile(mesh_fname,static_cast<TriMesh*>(mesh_),verbose_,
-                                    size_exclusion_list_,exclusion_list_,region_);
-            
+                                    size_exclusion_list_,exclusion_list_,region_,mesh_simplify);
+
+            delete mesh_simplify;
             delete mesh_input;
         }
     }
@@ -543,6 +581,12 @@ void FixMesh::pre_exchange()
 {
     
     pOpFlag_ = true;
+
+    // start mesh exchange here so it overlaps with particle exchange,
+    // borders and neighbor list build
+    // not possible if sub-domains can still change before comm->exchange()
+
+    pOpPending_ = !domain->box_change && mesh_->pbcExchangeBordersBegin(0);
 }
 
 /* ----------------------------------------------------------------------
@@ -555,9 +599,13 @@ void FixMesh::pre_force(int vflag)
     if(pOpFlag_)
     {
         
-        mesh_->pbcExchangeBorders(0);
+        if(pOpPending_)
+            mesh_->pbcExchangeBordersEnd(0);
+        else
+            mesh_->pbcExchangeBorders(0);
 
         pOpFlag_ = false;
+        pOpPending_ = false;
     }
     // case regular step
     else
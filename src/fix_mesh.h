@@ -154,6 +154,10 @@ namespace LAMMPS_NS
         // mesh on this time-step
         bool pOpFlag_;
 
+        // flags if parallel operations for the mesh have been started
+        // in pre_exchange() and still need to be completed
+        bool pOpPending_;
+
         bool manipulated_;
 
         // flags and params to be passed to the mesh
@@ -165,6 +169,10 @@ namespace LAMMPS_NS
         // ignore features smaller than this size
         double min_feature_length_;
 
+        // simplify mesh on import, bounded by curvature (degrees)
+        bool simplify_;
+        double simplify_angle_;
+
         // mesh correction
         FILE *element_exclusion_list_;
         bool read_exclusion_list_;
@@ -111,6 +111,8 @@ namespace LAMMPS_NS
         void deleteMeshMulticontactData();
 
         MeshModule* get_module(std::string name);
+        inline int n_mesh_modules() const
+        { return active_mesh_modules.size(); }
         void add_particle_contribution(int ip, double *frc, double *delta, int iTri, double *v_wall);
 
         bool trackStress();
@@ -0,0 +1,319 @@
+/* ----------------------------------------------------------------------
+    This is the
+
+    ██╗     ██╗ ██████╗  ██████╗  ██████╗ ██╗  ██╗████████╗███████╗
+    ██║     ██║██╔════╝ ██╔════╝ ██╔════╝ ██║  ██║╚══██╔══╝██╔════╝
+    ██║     ██║██║  ███╗██║  ███╗██║  ███╗███████║   ██║   ███████╗
+    ██║     ██║██║   ██║██║   ██║██║   ██║██╔══██║   ██║   ╚════██║
+    ███████╗██║╚██████╔╝╚██████╔╝╚██████╔╝██║  ██║   ██║   ███████║
+    ╚══════╝╚═╝ ╚═════╝  ╚═════╝  ╚═════╝ ╚═╝  ╚═╝   ╚═╝   ╚══════╝®
+
+    DEM simulation engine, released by
+    DCS Computing Gmbh, Linz, Austria
+    http://www.dcs-computing.com, office@dcs-computing.com
+
+    LIGGGHTS® is part of CFDEM®project:
+    http://www.liggghts.com | http://www.cfdem.com
+
+    Core developer and main author:
+    Christoph Kloss, christoph.kloss@dcs-computing.com
+
+    LIGGGHTS® is open-source, distributed under the terms of the GNU Public
+    License, version 2 or later. It is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+    of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. You should have
+    received a copy of the GNU General Public License along with LIGGGHTS®.
+    If not, see http://www.gnu.org/licenses . See also top-level README
+    and LICENSE files.
+
+    LIGGGHTS® and CFDEM® are registered trade marks of DCS Computing GmbH,
+    the producer of the LIGGGHTS® software and the CFDEM®coupling software
+    See http://www.cfdem.com/terms-trademark-policy for details.
+
+-------------------------------------------------------------------------
+    Contributing author and copyright for this file:
+    (if not contributing author is listed, this file has been contributed
+    by the core developer)
+
+    Copyright 2012-     DCS Computing GmbH, Linz
+------------------------------------------------------------------------- */
+
+
+#include <string.h>
+#include <cmath>
+#include "fix_multirate_gran.h"
+#include "atom.h"
+#include "update.h"
+#include "force.h"
+#include "modify.h"
+#include "comm.h"
+#include "error.h"
+#include "properties.h"
+#include "fix_property_global.h"
+#include "mpi_liggghts.h"
+
+using namespace LAMMPS_NS;
+using namespace FixConst;
+
+#define BIG 1.0e20
+
+/* ---------------------------------------------------------------------- */
+
+FixMultirateGran::FixMultirateGran(LAMMPS *lmp, int narg, char **arg) :
+  Fix(lmp, narg, arg),
+  every_(1),
+  radius_min_(0.),
+  hold_(false),
+  fix_hold_(NULL)
+{
+  if (narg < 5)
+    error->fix_error(FLERR,this,"not enough arguments");
+
+  int iarg = 3;
+  bool hasargs = true;
+  while (iarg < narg && hasargs)
+  {
+    hasargs = false;
+    if (strcmp(arg[iarg],"every") == 0) {
+      if (narg < iarg+2) error->fix_error(FLERR,this,"not enough arguments for 'every'");
+      every_ = force->inumeric(FLERR,arg[iarg+1]);
+      if (every_ < 1) error->fix_error(FLERR,this,"'every' must be >= 1");
+      iarg += 2;
+      hasargs = true;
+    } else if (strcmp(arg[iarg],"radius") == 0) {
+      if (narg < iarg+2) error->fix_error(FLERR,this,"not enough arguments for 'radius'");
+      radius_min_ = force->numeric(FLERR,arg[iarg+1]);
+      if (radius_min_ < 0.) error->fix_error(FLERR,this,"'radius' must be >= 0");
+      iarg += 2;
+      hasargs = true;
+    } else if (strcmp(arg[iarg],"scheme") == 0) {
+      if (narg < iarg+2) error->fix_error(FLERR,this,"not enough arguments for 'scheme'");
+      if (strcmp(arg[iarg+1],"impulse") == 0)
+        hold_ = false;
+      else if (strcmp(arg[iarg+1],"hold") == 0)
+        hold_ = true;
+      else
+        error->fix_error(FLERR,this,"expecting 'impulse' or 'hold' after 'scheme'");
+      iarg += 2;
+      hasargs = true;
+    } else
+      error->fix_error(FLERR,this,"unknown keyword");
+  }
+
+  scalar_flag = 1;
+  global_freq = 1;
+  extscalar = 0;
+}
+
+/* ---------------------------------------------------------------------- */
+
+void FixMultirateGran::post_create()
+{
+  // force and torque of the coarse class, held between evaluations
+
+  if (hold_ && !fix_hold_)
+  {
+    const char* fixarg[14];
+    fixarg[0]="multirateHold";
+    fixarg[1]="all";
+    fixarg[2]="property/atom";
+    fixarg[3]="multirateHold";
+    fixarg[4]="vector"; // 1 vector per particle to be registered
+    fixarg[5]="yes";    // restart
+    fixarg[6]="no";     // communicate ghost
+    fixarg[7]="no";     // communicate rev
+    fixarg[8]="0.";
+    fixarg[9]="0.";
+    fixarg[10]="0.";
+    fixarg[11]="0.";
+    fixarg[12]="0.";
+    fixarg[13]="0.";
+    fix_hold_ = modify->add_fix_property_atom(14,const_cast<char**>(fixarg),style);
+  }
+}
+
+/* ---------------------------------------------------------------------- */
+
+void FixMultirateGran::pre_delete(bool unfixflag)
+{
+  if (unfixflag && fix_hold_) modify->delete_fix("multirateHold");
+}
+
+/* ---------------------------------------------------------------------- */
+
+int FixMultirateGran::setmask()
+{
+  int mask = 0;
+  if (hold_) {
+    mask |= PRE_FORCE;
+    mask |= POST_FORCE;
+  }
+  return mask;
+}
+
+/* ---------------------------------------------------------------------- */
+
+void FixMultirateGran::init()
+{
+  if (modify->n_fixes_style("multirate/gran") > 1)
+    error->fix_error(FLERR,this,"only one fix multirate/gran may be defined");
+  if (!atom->radius_flag)
+    error->fix_error(FLERR,this,"requires atom style sphere");
+  if (!force->pair_match("gran",0))
+    error->fix_error(FLERR,this,"requires a granular pair style");
+  if (strcmp(update->integrate_style,"verlet") != 0)
+    error->fix_error(FLERR,this,"can only be used with run_style verlet");
+  if (hold_ && force->newton_pair)
+    error->fix_error(FLERR,this,"scheme hold requires newton pair off");
+}
+
+/* ---------------------------------------------------------------------- */
+
+void FixMultirateGran::setup_pre_force(int vflag)
+{
+  pre_force(vflag);
+}
+
+/* ----------------------------------------------------------------------
+   report the Rayleigh time-step estimate of both classes
+------------------------------------------------------------------------- */
+
+void FixMultirateGran::setup(int)
+{
+  double t_fine,t_coarse;
+  bigint ncoarse;
+  rayleigh_estims(t_fine,t_coarse,ncoarse);
+
+  // refuse setups where M*dt resolves the coarse class contacts worse
+  // than dt resolves the fine class, see the doc page for the accuracy
+
+  const double dt = update->dt;
+  if (every_ > 1 && t_fine < BIG && t_coarse < BIG && every_*t_fine > t_coarse*(1.+1.e-6))
+    error->fix_error(FLERR,this,"'every' times time-step resolves the coarse class worse than the time-step "
+                     "resolves the fine class, reduce 'every' to at most the ratio of the rayleigh times");
+
+  if (comm->me != 0) return;
+
+  char msg[512];
+  sprintf(msg,"fix multirate/gran: " BIGINT_FORMAT " particles in coarse class, contacts between them are evaluated every %d steps\n",
+          ncoarse,every_);
+  if (screen) fprintf(screen,"%s",msg);
+  if (logfile) fprintf(logfile,"%s",msg);
+
+  if (t_fine < BIG) {
+    sprintf(msg,"  fine class: time-step is %f %% of rayleigh time\n",100.*dt/t_fine);
+    if (screen) fprintf(screen,"%s",msg);
+    if (logfile) fprintf(logfile,"%s",msg);
+  }
+  if (t_coarse < BIG) {
+    sprintf(msg,"  coarse class: 'every' times time-step is %f %% of rayleigh time\n",100.*every_*dt/t_coarse);
+    if (screen) fprintf(screen,"%s",msg);
+    if (logfile) fprintf(logfile,"%s",msg);
+  }
+}
+
+/* ----------------------------------------------------------------------
+   clear held forces before the pair style evaluates the coarse class
+------------------------------------------------------------------------- */
+
+void FixMultirateGran::pre_force(int)
+{
+  if (!coarse_step()) return;
+
+  const int nlocal = atom->nlocal;
+  for (int i = 0; i < nlocal; i++)
+  {
+    double * const fh = fix_hold_->array_atom[i];
+    for (int k = 0; k < 6; k++) fh[k] = 0.;
+  }
+}
+
+/* ----------------------------------------------------------------------
+   apply held forces on steps without evaluation of the coarse class
+------------------------------------------------------------------------- */
+
+void FixMultirateGran::post_force(int)
+{
+  if (coarse_step()) return;
+
+  double **f = atom->f;
+  double **torque = atom->torque;
+  const int nlocal = atom->nlocal;
+
+  for (int i = 0; i < nlocal; i++)
+  {
+    const double * const fh = fix_hold_->array_atom[i];
+    f[i][0] += fh[0];
+    f[i][1] += fh[1];
+    f[i][2] += fh[2];
+    torque[i][0] += fh[3];
+    torque[i][1] += fh[4];
+    torque[i][2] += fh[5];
+  }
+}
+
+/* ----------------------------------------------------------------------
+   the coarse class is evaluated every M-th step, with scheme hold also
+   during setup so a run can start at any step
+------------------------------------------------------------------------- */
+
+bool FixMultirateGran::coarse_step() const
+{
+  if (hold_ && update->setupflag) return true;
+  return update->ntimestep % every_ == 0;
+}
+
+/* ----------------------------------------------------------------------
+   Rayleigh time of fine and coarse class, same estimate as used by
+   fix check/timestep/gran; BIG if a class is empty or the material
+   properties are not defined
+------------------------------------------------------------------------- */
+
+void FixMultirateGran::rayleigh_estims(double &t_fine, double &t_coarse, bigint &ncoarse)
+{
+  double *radius = atom->radius;
+  double *density = atom->density;
+  int *type = atom->type;
+  int *mask = atom->mask;
+  const int nlocal = atom->nlocal;
+
+  t_fine = t_coarse = BIG;
+  ncoarse = 0;
+
+  const int max_type = atom->get_properties()->max_type();
+  FixPropertyGlobal *Y = static_cast<FixPropertyGlobal*>(modify->find_fix_property("youngsModulus","property/global","peratomtype",max_type,0,style,false));
+  FixPropertyGlobal *nu = static_cast<FixPropertyGlobal*>(modify->find_fix_property("poissonsRatio","property/global","peratomtype",max_type,0,style,false));
+  const bool have_props = Y && nu && density;
+
+  for (int i = 0; i < nlocal; i++)
+  {
+    const bool is_coarse = coarse(mask[i],radius[i]);
+    if (is_coarse) ncoarse++;
+    if (!have_props) continue;
+
+    const double nu_i = nu->get_values()[type[i]-1];
+    const double shear_mod = Y->get_values()[type[i]-1]/(2.*(nu_i+1.));
+    const double rayleigh_time_i = M_PI*radius[i]*sqrt(density[i]/shear_mod)/(0.1631*nu_i+0.8766);
+
+    double &t = is_coarse ? t_coarse : t_fine;
+    if (rayleigh_time_i < t) t = rayleigh_time_i;
+  }
+
+  MPI_Min_Scalar(t_fine,world);
+  MPI_Min_Scalar(t_coarse,world);
+  bigint ncoarse_all;
+  MPI_Allreduce(&ncoarse,&ncoarse_all,1,MPI_LMP_BIGINT,MPI_SUM,world);
+  ncoarse = ncoarse_all;
+}
+
+/* ----------------------------------------------------------------------
+   # of particles in the coarse class
+------------------------------------------------------------------------- */
+
+double FixMultirateGran::compute_scalar()
+{
+  double t_fine,t_coarse;
+  bigint ncoarse;
+  rayleigh_estims(t_fine,t_coarse,ncoarse);
+  return static_cast<double>(ncoarse);
+}
@@ -0,0 +1,110 @@
+/* ----------------------------------------------------------------------
+    This is the
+
+    ██╗     ██╗ ██████╗  ██████╗  ██████╗ ██╗  ██╗████████╗███████╗
+    ██║     ██║██╔════╝ ██╔════╝ ██╔════╝ ██║  ██║╚══██╔══╝██╔════╝
+    ██║     ██║██║  ███╗██║  ███╗██║  ███╗███████║   ██║   ███████╗
+    ██║     ██║██║   ██║██║   ██║██║   ██║██╔══██║   ██║   ╚════██║
+    ███████╗██║╚██████╔╝╚██████╔╝╚██████╔╝██║  ██║   ██║   ███████║
+    ╚══════╝╚═╝ ╚═════╝  ╚═════╝  ╚═════╝ ╚═╝  ╚═╝   ╚═╝   ╚══════╝®
+
+    DEM simulation engine, released by
+    DCS Computing Gmbh, Linz, Austria
+    http://www.dcs-computing.com, office@dcs-computing.com
+
+    LIGGGHTS® is part of CFDEM®project:
+    http://www.liggghts.com | http://www.cfdem.com
+
+    Core developer and main author:
+    Christoph Kloss, christoph.kloss@dcs-computing.com
+
+    LIGGGHTS® is open-source, distributed under the terms of the GNU Public
+    License, version 2 or later. It is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+    of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. You should have
+    received a copy of the GNU General Public License along with LIGGGHTS®.
+    If not, see http://www.gnu.org/licenses . See also top-level README
+    and LICENSE files.
+
+    LIGGGHTS® and CFDEM® are registered trade marks of DCS Computing GmbH,
+    the producer of the LIGGGHTS® software and the CFDEM®coupling software
+    See http://www.cfdem.com/terms-trademark-policy for details.
+
+-------------------------------------------------------------------------
+    Contributing author and copyright for this file:
+    (if not contributing author is listed, this file has been contributed
+    by the core developer)
+
+    Copyright 2012-     DCS Computing GmbH, Linz
+------------------------------------------------------------------------- */
+
+
+#ifdef FIX_CLASS
+
+FixStyle(multirate/gran,FixMultirateGran)
+
+#else
+
+#ifndef LMP_FIX_MULTIRATE_GRAN_H
+#define LMP_FIX_MULTIRATE_GRAN_H
+
+#include "fix.h"
+#include "fix_property_atom.h"
+
+namespace LAMMPS_NS {
+
+/* ----------------------------------------------------------------------
+   force-evaluation skipping for granular size classes
+   particles in the fix group with a radius of at least radius_min form the
+   coarse class. pair contacts between two coarse particles are evaluated
+   only every M-th step, their contact models integrate with M*dt. their
+   force is either applied as an impulse scaled by M (r-RESPA impulse
+   scheme) or held constant until the next evaluation. all other contacts,
+   walls and the integration of all particles stay at the fine time-step,
+   so this is not a multiple time-step integrator and does not conserve
+   energy as well as a run with M = 1
+------------------------------------------------------------------------- */
+
+class FixMultirateGran : public Fix {
+ public:
+  FixMultirateGran(class LAMMPS *, int, char **);
+  void post_create();
+  void pre_delete(bool unfixflag);
+  int setmask();
+  void init();
+  void setup_pre_force(int);
+  void setup(int);
+  void pre_force(int);
+  void post_force(int);
+  double compute_scalar();
+
+  inline int every() const
+  { return every_; }
+
+  inline bool coarse(const int m, const double r) const
+  { return (m & groupbit) && r >= radius_min_; }
+
+  bool coarse_step() const;
+
+  // hold scheme: coarse class force and torque of an owned particle as of
+  // the last evaluation
+
+  inline bool hold() const
+  { return hold_; }
+
+  inline double * hold_force(const int i) const
+  { return fix_hold_->array_atom[i]; }
+
+ private:
+  void rayleigh_estims(double &t_fine, double &t_coarse, bigint &ncoarse);
+
+  int every_;
+  double radius_min_;
+  bool hold_;
+  class FixPropertyAtom *fix_hold_;
+};
+
+}
+
+#endif
+#endif
@@ -43,6 +43,8 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <algorithm>
+#include <utility>
 #include "fix_multisphere.h"
 #include "domain_wedge.h"
 #include "math_extra.h"
@@ -98,6 +100,9 @@ FixMultisphere::FixMultisphere(LAMMPS *lmp, int narg, char **arg) :
   rev_comm_flag_(MS_COMM_UNDEFINED),
   body_(NULL),
   displace_(NULL),
+  origin_(NULL),
+  owner_(NULL),
+  body_atom_list_nbody_(-1),
   ntypes_(0),
   Vclump_(0),
   allow_group_and_set_(false),
@@ -235,6 +240,8 @@ FixMultisphere::~FixMultisphere()
     delete &multisphere_;
 
     memory->destroy(displace_);
+    memory->destroy(origin_);
+    memory->destroy(owner_);
 
     if(accepts_restart_data_from_style)
     {
@@ -805,10 +812,9 @@ void FixMultisphere::set_v_communicate()
 
 void FixMultisphere::comm_correct_force(bool setupflag)
 {
-    // communication and correction before real integration
-    
-    fw_comm_flag_ = MS_COMM_FW_F_TORQUE;
-    forward_comm();
+    // correction before real integration
+    // forces of atoms are reduced onto their bodies by the proc owning
+    // the atom in calc_force(), no ghost forces are needed
     
     if(setupflag)
         fix_volumeweight_ms_->do_forward_comm();
@@ -818,6 +824,125 @@ void FixMultisphere::comm_correct_force(bool setupflag)
         modify_body_forces_torques();
 }
 
+/* ----------------------------------------------------------------------
+   set up owner-computes reduction of atom data onto bodies
+   every proc reduces its owned atoms body by body
+     atoms of bodies owned by this proc go directly into the body
+     atoms of bodies owned by other procs are summed into one entry per
+     (owner proc, body), which is sent to the owner in calc_force()
+   the owner of the body of each atom is found via reverse comm from the
+   ghost copy on the owning proc, the procs sending to this proc via the
+   origin of the ghosts of local bodies, so no global communication
+   and no global map of bodies is needed
+   called by all procs after bodies and ghosts have changed
+------------------------------------------------------------------------- */
+
+void FixMultisphere::build_body_atom_list()
+{
+    const int nlocal = atom->nlocal;
+    const int nall = atom->nlocal + atom->nghost;
+    const int nbody = multisphere_.n_body();
+    const int me = comm->me;
+
+    // owner of the body of each atom
+
+    for (int i = 0; i < nall; i++)
+        owner_[i] = (body_[i] >= 0 && map(body_[i]) >= 0) ? me : -1;
+
+    rev_comm_flag_ = MS_COMM_REV_OWNER;
+    reverse_comm();
+
+    // owned atoms of local bodies, sorted by body via a counting sort
+    // owned atoms of remote bodies, key = (owner, body ID, atom)
+
+    std::vector<int> atom_body(nlocal,-1);
+    std::vector<std::pair<std::pair<int,int>,int> > send;
+
+    body_atom_offset_.assign(nbody+1,0);
+
+    for (int i = 0; i < nlocal; i++)
+    {
+        if(body_[i] < 0 || owner_[i] < 0)
+            continue;
+
+        if(owner_[i] == me)
+        {
+            atom_body[i] = map(body_[i]);
+            body_atom_offset_[atom_body[i]+1]++;
+        }
+        else
+            send.push_back(std::make_pair(std::make_pair(owner_[i],body_[i]),i));
+    }
+
+    for (int ibody = 0; ibody < nbody; ibody++)
+        body_atom_offset_[ibody+1] += body_atom_offset_[ibody];
+
+    std::vector<int> next(body_atom_offset_.begin(),body_atom_offset_.end()-1);
+    body_atom_list_.resize(body_atom_offset_[nbody]);
+
+    for (int i = 0; i < nlocal; i++)
+        if(atom_body[i] >= 0)
+            body_atom_list_[next[atom_body[i]]++] = i;
+
+    // entries sent to other procs
+
+    std::sort(send.begin(),send.end());
+
+    body_send_proc_.clear();
+    body_send_first_.clear();
+    body_send_offset_.clear();
+    body_send_atom_.resize(send.size());
+
+    for (size_t k = 0; k < send.size(); k++)
+    {
+        const int proc = send[k].first.first;
+        if(k == 0 || proc != send[k-1].first.first)
+        {
+            body_send_proc_.push_back(proc);
+            body_send_first_.push_back(body_send_offset_.size());
+        }
+        if(k == 0 || send[k].first != send[k-1].first)
+            body_send_offset_.push_back(k);
+        body_send_atom_[k] = send[k].second;
+    }
+    body_send_first_.push_back(body_send_offset_.size());
+    body_send_offset_.push_back(send.size());
+
+    // entries received from other procs, key = (origin, body ID)
+    // one per body and proc holding atoms of it, in the order used
+    // by the sending proc
+
+    std::vector<std::pair<int,int> > recv;
+    for (int i = nlocal; i < nall; i++)
+        if(body_[i] >= 0 && origin_[i] != me && map(body_[i]) >= 0)
+            recv.push_back(std::make_pair(origin_[i],body_[i]));
+
+    std::sort(recv.begin(),recv.end());
+    recv.erase(std::unique(recv.begin(),recv.end()),recv.end());
+
+    body_recv_proc_.clear();
+    body_recv_first_.clear();
+    body_recv_body_.resize(recv.size());
+
+    for (size_t k = 0; k < recv.size(); k++)
+    {
+        if(k == 0 || recv[k].first != recv[k-1].first)
+        {
+            body_recv_proc_.push_back(recv[k].first);
+            body_recv_first_.push_back(k);
+        }
+        body_recv_body_[k] = map(recv[k].second);
+    }
+    body_recv_first_.push_back(recv.size());
+
+    // max # of datums per entry is 9, see calc_force()
+
+    body_buf_send_.resize(9*(body_send_offset_.size()-1));
+    body_buf_recv_.resize(9*recv.size());
+
+    body_atom_list_nbody_ = nbody;
+}
+
 /* ----------------------------------------------------------------------
    set space-frame coords and velocity of each atom in each rigid body
    set orientation and rotation of extended particles
@@ -832,9 +957,7 @@ void FixMultisphere::calc_force(bool setupflag)
   double **x = atom->x;
   double **f_atom = atom->f;
   double **torque_atom = atom->torque;
-  double f_one[3],torque_one[3];
-  int nlocal = atom->nlocal;
-  int nghost = atom->nghost;
+  double unwrap[3],dx,dy,dz;
 
   double **xcm = multisphere_.xcm_.begin();
   double *masstotal = multisphere_.masstotal_.begin();
@@ -846,48 +969,97 @@ void FixMultisphere::calc_force(bool setupflag)
   double *temp_old = multisphere_.temp_old_.begin();
   int nbody = multisphere_.n_body();
 
-  double unwrap[3],dx,dy,dz;
+  if(body_atom_list_nbody_ != nbody)
+    error->one(FLERR,"Internal error: multisphere body lists out of date");
+
+  const int nsend = body_send_offset_.size()-1;
+  const int nrecv = body_recv_body_.size();
+
+  // partial force and torque of atoms of bodies owned by other procs
+  // torque is taken about the first atom of the entry, which is sent
+  // along, the owner shifts it to xcm
+  // buffer: f (3), torque (3), reference point (3)
 
-  // calculate forces and torques of bodies
-  for (int i = 0; i < nlocal+nghost; i++)
+  for (int k = 0; k < nsend; k++)
   {
-    
-    if(body_[i] < 0) continue;
+    double *buf = &body_buf_send_[9*k];
+    vectorZeroizeN(buf,6);
+    domain->unmap(x[body_send_atom_[body_send_offset_[k]]],
+                  image[body_send_atom_[body_send_offset_[k]]],&buf[6]);
 
-    ibody = map(body_[i]);
+    for (int m = body_send_offset_[k]; m < body_send_offset_[k+1]; m++)
+    {
+      const int i = body_send_atom_[m];
+
+      domain->unmap(x[i],image[i],unwrap);
+      dx = unwrap[0] - buf[6];
+      dy = unwrap[1] - buf[7];
+      dz = unwrap[2] - buf[8];
+
+      buf[0] += f_atom[i][0];
+      buf[1] += f_atom[i][1];
+      buf[2] += f_atom[i][2];
+      buf[3] += dy*f_atom[i][2] - dz*f_atom[i][1] + torque_atom[i][0];
+      buf[4] += dz*f_atom[i][0] - dx*f_atom[i][2] + torque_atom[i][1];
+      buf[5] += dx*f_atom[i][1] - dy*f_atom[i][0] + torque_atom[i][2];
+    }
+  }
 
-    if (ibody < 0) continue;
+  body_comm_begin(9,false);
+
+  // calculate forces and torques of bodies from owned atoms
+  // while partial sums are in flight
 
-    if(!domain->is_owned_or_first_ghost(i))
-        continue;
+  for (ibody = 0; ibody < nbody; ibody++)
+  {
+    for (int k = body_atom_offset_[ibody]; k < body_atom_offset_[ibody+1]; k++)
+    {
+      const int i = body_atom_list_[k];
 
-    vectorCopy3D(f_atom[i],f_one);
-    vectorCopy3D(torque_atom[i],torque_one);
+      fcm[ibody][0] += f_atom[i][0];
+      fcm[ibody][1] += f_atom[i][1];
+      fcm[ibody][2] += f_atom[i][2];
 
-    fcm[ibody][0] += f_one[0];
-    fcm[ibody][1] += f_one[1];
-    fcm[ibody][2] += f_one[2];
+      domain->unmap(x[i],image[i],unwrap);
+      dx = unwrap[0] - xcm[ibody][0];
+      dy = unwrap[1] - xcm[ibody][1];
+      dz = unwrap[2] - xcm[ibody][2];
 
-    domain->unmap(x[i],image[i],unwrap);
-    dx = unwrap[0] - xcm[ibody][0];
-    dy = unwrap[1] - xcm[ibody][1];
-    dz = unwrap[2] - xcm[ibody][2];
+      torquecm[ibody][0] += dy*f_atom[i][2] - dz*f_atom[i][1] + torque_atom[i][0];
+      torquecm[ibody][1] += dz*f_atom[i][0] - dx*f_atom[i][2] + torque_atom[i][1];
+      torquecm[ibody][2] += dx*f_atom[i][1] - dy*f_atom[i][0] + torque_atom[i][2];
+    }
+  }
 
-    if(i >= nlocal)
-        domain->minimum_image(dx,dy,dz);
+  body_comm_end();
 
-    torquecm[ibody][0] += dy*f_one[2] - dz*f_one[1] + torque_one[0];
-    torquecm[ibody][1] += dz*f_one[0] - dx*f_one[2] + torque_one[1];
-    torquecm[ibody][2] += dx*f_one[1] - dy*f_one[0] + torque_one[2];
+  // add partial sums of other procs
 
+  for (int k = 0; k < nrecv; k++)
+  {
+    const double *buf = &body_buf_recv_[9*k];
+    ibody = body_recv_body_[k];
+
+    dx = buf[6] - xcm[ibody][0];
+    dy = buf[7] - xcm[ibody][1];
+    dz = buf[8] - xcm[ibody][2];
+    domain->minimum_image(dx,dy,dz);
+
+    fcm[ibody][0] += buf[0];
+    fcm[ibody][1] += buf[1];
+    fcm[ibody][2] += buf[2];
+    torquecm[ibody][0] += buf[3] + dy*buf[2] - dz*buf[1];
+    torquecm[ibody][1] += buf[4] + dz*buf[0] - dx*buf[2];
+    torquecm[ibody][2] += buf[5] + dx*buf[1] - dy*buf[0];
   }
 
   // heat transfer
+  // same owner-computes scheme, temperature of body is sent back to
+  // the procs owning atoms of it
   
   if (fix_heat_) {
-      // communicate temperature to ghosts
-      fw_comm_flag_ = MS_COMM_FW_TEMP;
-      forward_comm();
+      double *temp_atom = fix_heat_->fix_temp->vector_atom;
+      double *volumeweight = fix_volumeweight_ms_->vector_atom;
 
       // save old temp
       for (ibody = 0; ibody < nbody; ibody++)
@@ -896,48 +1068,64 @@ void FixMultisphere::calc_force(bool setupflag)
       if(setupflag)
         vectorZeroizeN(temp,nbody);
 
-      // caclulate temperature from single particles
-      for (int i = 0; i < nlocal+nghost; i++)
+      // partial sums of other procs, buffer: sum, # of atoms
+      for (int k = 0; k < nsend; k++)
       {
-          // skip if atom not in rigid body
-          if(body_[i] < 0) continue;
-
-          ibody = map(body_[i]);
+          double *buf = &body_buf_send_[2*k];
+          buf[0] = 0.;
+          buf[1] = static_cast<double>(body_send_offset_[k+1]-body_send_offset_[k]);
+          for (int m = body_send_offset_[k]; m < body_send_offset_[k+1]; m++)
+          {
+              const int i = body_send_atom_[m];
+              buf[0] += setupflag ? volumeweight[i]*temp_atom[i] : temp_atom[i];
+          }
+      }
 
-          // skip if body not owned by this proc
-          if (ibody < 0) continue;
+      body_comm_begin(2,false);
 
-          if(!domain->is_owned_or_first_ghost(i))
-              continue;
+      // caclulate temperature from single particles
+      for (ibody = 0; ibody < nbody; ibody++)
+      {
+          for (int k = body_atom_offset_[ibody]; k < body_atom_offset_[ibody+1]; k++)
+          {
+              const int i = body_atom_list_[k];
+
+              if(!setupflag)
+                temp[ibody] += temp_atom[i] - temp_old[ibody]; //fix_heat_->heatFlux[i]*update->dt/(masstotal[ibody]);
+              else
+                temp[ibody] += volumeweight[i] * temp_atom[i];
+          }
+      }
 
-          //if (screen) fprintf(screen, "Update temperature for particle i = %d\n",i);
-          //if (screen) fprintf(screen, "Heat flux of particle %d is %g\n",i,fix_heat_->heatFlux[i]);
+      body_comm_end();
 
+      for (int k = 0; k < nrecv; k++)
+      {
+          ibody = body_recv_body_[k];
+          temp[ibody] += body_buf_recv_[2*k];
           if(!setupflag)
-            temp[ibody] += fix_heat_->fix_temp->vector_atom[i] - temp_old[ibody]; //fix_heat_->heatFlux[i]*update->dt/(masstotal[ibody]);
-          else
-            temp[ibody] += fix_volumeweight_ms_->vector_atom[i] * fix_heat_->fix_temp->vector_atom[i];
+              temp[ibody] -= body_buf_recv_[2*k+1]*temp_old[ibody];
       }
 
       // set temperature of single particles
-      for (int i = 0; i < nlocal+nghost; i++)
-      {
-          // skip if atom not in rigid body
-          if(body_[i] < 0) continue;
-
-          ibody = map(body_[i]);
+      for (int k = 0; k < nrecv; k++)
+          body_buf_recv_[k] = temp[body_recv_body_[k]];
 
-          // skip if body not owned by this proc
-          if (ibody < 0) continue;
+      body_comm_begin(1,true);
 
-          if(!domain->is_owned_or_first_ghost(i))
-              continue;
-
-          fix_heat_->fix_temp->vector_atom[i] = temp[ibody];
+      for (ibody = 0; ibody < nbody; ibody++)
+      {
+          for (int k = body_atom_offset_[ibody]; k < body_atom_offset_[ibody+1]; k++)
+              if(body_[body_atom_list_[k]] >= 0)
+                  temp_atom[body_atom_list_[k]] = temp[ibody];
       }
 
-      rev_comm_flag_ = MS_COMM_REV_TEMP;
-      reverse_comm();
+      body_comm_end();
+
+      for (int k = 0; k < nsend; k++)
+          for (int m = body_send_offset_[k]; m < body_send_offset_[k+1]; m++)
+              if(body_[body_send_atom_[m]] >= 0)
+                  temp_atom[body_send_atom_[m]] = body_buf_send_[k];
   }
 
   // add external forces on bodies, such as gravity, dragforce
@@ -1298,6 +1486,9 @@ void FixMultisphere::pre_neighbor()
     MPI_Max_Scalar(forceNeighbour,world);
     if (forceNeighbour)
         next_reneighbor = update->ntimestep + 5;
+
+    // bodies and ghosts have changed
+    build_body_atom_list();
 }
 
 /* ----------------------------------------------------------------------
@@ -1325,6 +1516,11 @@ double FixMultisphere::memory_usage()
   double bytes = nmax * sizeof(int);
   bytes += nmax*3 * sizeof(double);
   bytes += maxvatom*6 * sizeof(double);
+  bytes += nmax*2 * sizeof(int);
+  bytes += (body_atom_offset_.capacity() + body_atom_list_.capacity()) * sizeof(int);
+  bytes += (body_send_offset_.capacity() + body_send_atom_.capacity() +
+            body_recv_body_.capacity()) * sizeof(int);
+  bytes += (body_buf_send_.capacity() + body_buf_recv_.capacity()) * sizeof(double);
 
   // add Multisphere memory usage
 
@@ -1340,6 +1536,8 @@ void FixMultisphere::grow_arrays(int nmax)
     
     body_ = memory->grow(body_,nmax,"rigid:body_");
     memory->grow(displace_,nmax,3,"rigid:displace");
+    memory->grow(origin_,nmax,"rigid:origin_");
+    memory->grow(owner_,nmax,"rigid:owner_");
     atom->molecule = body_;
 }
 
@@ -73,7 +73,8 @@ enum
     MS_COMM_REV_V_OMEGA,
     MS_COMM_REV_IMAGE,
     MS_COMM_REV_DISPLACE,
-    MS_COMM_REV_TEMP
+    MS_COMM_REV_TEMP,
+    MS_COMM_REV_OWNER
 };
 
 class FixMultisphere : public Fix
@@ -236,6 +237,10 @@ class FixMultisphere : public Fix
       inline int tag(int i)
       { return data().tag(i); }
 
+      void build_body_atom_list();
+      void body_comm_begin(int nvalues, bool reverse);
+      void body_comm_end();
+
       void set_xv();
       void set_xv(int);
       void set_v();
@@ -260,9 +265,35 @@ class FixMultisphere : public Fix
       // per-atom properties handled by this fix
       int *body_;                // which body each atom is part of (-1 if none)
       double **displace_;        // displacement of each atom in body coords
+      int *origin_;              // proc owning each atom, set with MS_COMM_FW_BODY
+      int *owner_;               // proc owning the body of each atom (-1 if none)
 
       double dtv,dtf,dtq;
 
+      // owner-computes reduction of per-atom data onto bodies
+      // rebuilt in pre_neighbor(), only owned atoms are visited
+      // owned atoms of each locally owned body, stored body by body,
+      // atoms of body i are
+      // body_atom_list_[body_atom_offset_[i] ... body_atom_offset_[i+1]-1]
+      std::vector<int> body_atom_offset_;
+      std::vector<int> body_atom_list_;
+      int body_atom_list_nbody_;
+
+      // owned atoms of bodies owned by other procs, grouped into one entry
+      // per (owner proc, body), sorted by proc and body ID
+      // atoms of entry k are
+      // body_send_atom_[body_send_offset_[k] ... body_send_offset_[k+1]-1]
+      // entries for proc body_send_proc_[p] are
+      // body_send_first_[p] ... body_send_first_[p+1]-1
+      // receiving side holds the same entries in the same order, with the
+      // local index of the body in body_recv_body_
+      std::vector<int> body_send_proc_, body_send_first_;
+      std::vector<int> body_send_offset_, body_send_atom_;
+      std::vector<int> body_recv_proc_, body_recv_first_;
+      std::vector<int> body_recv_body_;
+      std::vector<double> body_buf_send_, body_buf_recv_;
+      std::vector<MPI_Request> body_request_;
+
       std::vector<FixRemove*> fix_remove_;
 
       // MS communication
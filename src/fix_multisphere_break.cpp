@@ -273,6 +273,9 @@ void FixMultisphereBreak::pre_neighbor()
     fw_comm_flag_ = MS_COMM_FW_IMAGE_DISPLACE;
     forward_comm();
 
+    // bodies and ghosts have changed
+    build_body_atom_list();
+
     // DO NOT merge delflag and existflag, since we would like to keep atoms that are not in a body
 //    int nlocal = atom->nlocal;
 //    delflag =   fix_delflag_->vector_atom;
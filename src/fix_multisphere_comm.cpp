@@ -42,6 +42,8 @@
 #include "fix_multisphere.h"
 #include "comm.h"
 
+#define TAG_BODY_MS 37
+
 /* ----------------------------------------------------------------------
    pack values in local atom-based arrays for exchange with another proc
 ------------------------------------------------------------------------- */
@@ -86,13 +88,16 @@ inline int FixMultisphere::pack_comm_body(int n, int *list, double *buf, int pbc
 {
     //we dont need to account for pbc here
     int i,j, m = 0;
+    const int nlocal = atom->nlocal;
+    const int me = comm->me;
     for (i = 0; i < n; i++)
     {
         j = list[i];
 
         buf[m++] = static_cast<double>(body_[j]);
+        buf[m++] = static_cast<double>(j < nlocal ? me : origin_[j]);
     }
-    return 1;
+    return 2;
 }
 
 /* ---------------------------------------------------------------------- */
@@ -210,7 +215,7 @@ void FixMultisphere::unpack_comm_body(int n, int first, double *buf)
     for (i = first; i < last; i++)
     {
         body_[i] = static_cast<int>(buf[m++]);
-        
+        origin_[i] = static_cast<int>(buf[m++]);
     }
 }
 
@@ -322,6 +327,8 @@ int FixMultisphere::pack_reverse_comm(int n, int first, double *buf)
         return pack_reverse_comm_displace(n,first,buf);
     else if(rev_comm_flag_ == MS_COMM_REV_TEMP)
         return pack_reverse_comm_temp(n,first,buf);
+    else if(rev_comm_flag_ == MS_COMM_REV_OWNER)
+        return pack_reverse_comm_owner(n,first,buf);
     else error->fix_error(FLERR,this,"FixMultisphere::pack_reverse_comm internal error");
     return 0;
 }
@@ -467,6 +474,19 @@ int FixMultisphere::pack_reverse_comm_temp(int n, int first, double *buf)
     return 2;
 }
 
+/* ---------------------------------------------------------------------- */
+
+int FixMultisphere::pack_reverse_comm_owner(int n, int first, double *buf)
+{
+    int i,m,last;
+
+    m = 0;
+    last = first + n;
+    for (i = first; i < last; i++)
+        buf[m++] = static_cast<double>(owner_[i]);
+    return 1;
+}
+
 /* ----------------------------------------------------------------------
    unpack reverse comm
 ------------------------------------------------------------------------- */
@@ -483,6 +503,8 @@ void FixMultisphere::unpack_reverse_comm(int n, int *list, double *buf)
         unpack_reverse_comm_displace(n,list,buf);
     else if(rev_comm_flag_ == MS_COMM_REV_TEMP)
         unpack_reverse_comm_temp(n,list,buf);
+    else if(rev_comm_flag_ == MS_COMM_REV_OWNER)
+        unpack_reverse_comm_owner(n,list,buf);
     else error->fix_error(FLERR,this,"FixMultisphere::unpack_reverse_comm internal error");
 }
 
@@ -619,6 +641,66 @@ void FixMultisphere::unpack_reverse_comm_temp(int n, int *list, double *buf)
     }
 }
 
+/* ----------------------------------------------------------------------
+   only the proc owning the body sends an owner >= 0, intermediate
+   ghosts pass it on towards the owned atom
+------------------------------------------------------------------------- */
+
+void FixMultisphere::unpack_reverse_comm_owner(int n, int *list, double *buf)
+{
+    int i,owner,m = 0;
+
+    for (i = 0; i < n; i++) {
+        owner = static_cast<int>(buf[m++]);
+        if(owner >= 0)
+            owner_[list[i]] = owner;
+    }
+}
+
+/* ----------------------------------------------------------------------
+   sparse exchange of per-body values between the procs holding atoms of
+   a body and the proc owning it, entries as set up by
+   build_body_atom_list()
+   reverse = false: body_buf_send_ is sent to the body owners and
+     received into body_buf_recv_
+   reverse = true: body_buf_recv_ is sent back from the body owners and
+     received into body_buf_send_
+   nvalues = # of datums per entry
+------------------------------------------------------------------------- */
+
+void FixMultisphere::body_comm_begin(int nvalues, bool reverse)
+{
+    std::vector<int> &to_proc = reverse ? body_recv_proc_ : body_send_proc_;
+    std::vector<int> &to_first = reverse ? body_recv_first_ : body_send_first_;
+    std::vector<int> &from_proc = reverse ? body_send_proc_ : body_recv_proc_;
+    std::vector<int> &from_first = reverse ? body_send_first_ : body_recv_first_;
+    std::vector<double> &buf_to = reverse ? body_buf_recv_ : body_buf_send_;
+    std::vector<double> &buf_from = reverse ? body_buf_send_ : body_buf_recv_;
+
+    body_request_.resize(to_proc.size()+from_proc.size());
+    int nrequest = 0;
+
+    for(size_t p = 0; p < from_proc.size(); p++)
+        MPI_Irecv(&buf_from[nvalues*from_first[p]],nvalues*(from_first[p+1]-from_first[p]),
+                  MPI_DOUBLE,from_proc[p],TAG_BODY_MS,world,&body_request_[nrequest++]);
+
+    for(size_t p = 0; p < to_proc.size(); p++)
+        MPI_Isend(&buf_to[nvalues*to_first[p]],nvalues*(to_first[p+1]-to_first[p]),
+                  MPI_DOUBLE,to_proc[p],TAG_BODY_MS,world,&body_request_[nrequest++]);
+}
+
+/* ---------------------------------------------------------------------- */
+
+void FixMultisphere::body_comm_end()
+{
+    if(!body_request_.empty())
+    {
+        std::vector<MPI_Status> status(body_request_.size());
+        MPI_Waitall(static_cast<int>(body_request_.size()),&body_request_[0],&status[0]);
+    }
+    body_request_.clear();
+}
+
 /* ----------------------------------------------------------------------
    pack comm
 ------------------------------------------------------------------------- */
@@ -73,11 +73,13 @@
       int pack_reverse_comm_image(int n, int first, double *buf);
       int pack_reverse_comm_displace(int n, int first, double *buf);
       int pack_reverse_comm_temp(int n, int first, double *buf);
+      int pack_reverse_comm_owner(int n, int first, double *buf);
       void unpack_reverse_comm(int, int*, double*);
       void unpack_reverse_comm_x_v_omega(int, int*, double*);
       void unpack_reverse_comm_v_omega(int, int*, double*);
       void unpack_reverse_comm_image(int n, int *list, double *buf);
       void unpack_reverse_comm_displace(int n, int *list, double *buf);
       void unpack_reverse_comm_temp(int n, int *list, double *buf);
+      void unpack_reverse_comm_owner(int n, int *list, double *buf);
 
 #endif
@@ -53,6 +53,8 @@
 #include "domain.h"
 #include "vector_liggghts.h"
 #include "update.h"
+#include "timer.h"
+#include "memory.h"
 #include <stdio.h>
 #include <algorithm>
 #include "atom_vec_ellipsoid.h"
@@ -82,6 +84,11 @@ FixNeighlistMesh::FixNeighlistMesh(LAMMPS *lmp, int narg, char **arg)
   changingMesh(false),
   changingDomain(false),
   last_bin_update(-1),
+  particleList_(false),
+  part_first_(NULL),
+  part_tri_(NULL),
+  part_nmax_(0),
+  part_size_(0),
   avec(0),
   otherList_(false)
 {
@@ -91,6 +98,10 @@ FixNeighlistMesh::FixNeighlistMesh(LAMMPS *lmp, int narg, char **arg)
     caller_ = static_cast<FixMeshSurface*>(modify->find_fix_id(arg[3]));
     mesh_ = caller_->triMesh();
 
+    // pre_force() only builds the mesh neighbor list of owned atoms
+
+    pre_force_overlap = 1;
+
     if(5 == narg)
     {
         if(0 == strcmp(arg[4],"other_yes"))
@@ -110,6 +121,9 @@ FixNeighlistMesh::~FixNeighlistMesh()
 {
     delete [] fix_nneighs_name_;
     last_bin_update = -1;
+
+    memory->destroy(part_first_);
+    memory->destroy(part_tri_);
 }
 
 /* ---------------------------------------------------------------------- */
@@ -231,6 +245,8 @@ void FixNeighlistMesh::pre_force(int)
 {
     if(!buildNeighList) return;
 
+    if(modify->timing) timer->start(TIME_MESH_NEIGHBOR);
+
     changingMesh = mesh_->isMoving() || mesh_->isDeforming();
     changingDomain = (domain->nonperiodic == 2) || domain->box_change;
 
@@ -294,10 +310,73 @@ void FixNeighlistMesh::pre_force(int)
       numAllContacts_ += triangle.contacts.size();
     }
 
+    if(particleList_)
+        build_particle_list(nall);
+
     if(globalNumAllContacts_)
         MPI_Sum_Scalar(numAllContacts_,world);
 
     fix_nneighs_->do_forward_comm();
+
+    if(modify->timing) timer->stop(TIME_MESH_NEIGHBOR);
+}
+
+/* ----------------------------------------------------------------------
+   transpose triangle contact lists into particle-major CSR
+   triangles are visited in ascending order, so each particle sees
+   its triangles in the same order as in the triangle-major loop
+------------------------------------------------------------------------- */
+
+void FixNeighlistMesh::build_particle_list(size_t nall)
+{
+    const int nlocal = atom->nlocal;
+
+    if(nlocal+1 > part_nmax_)
+    {
+        part_nmax_ = atom->nmax+1;
+        memory->destroy(part_first_);
+        memory->create(part_first_,part_nmax_,"neighlist_mesh:part_first");
+    }
+
+    for(int i = 0; i <= nlocal; i++)
+        part_first_[i] = 0;
+
+    for(size_t iTri = 0; iTri < nall; iTri++)
+    {
+        const std::vector<int> & contacts = triangles[iTri].contacts;
+        const int ncontacts = contacts.size();
+        for(int iCont = 0; iCont < ncontacts; iCont++)
+            if(contacts[iCont] < nlocal)
+                part_first_[contacts[iCont]+1]++;
+    }
+
+    for(int i = 0; i < nlocal; i++)
+        part_first_[i+1] += part_first_[i];
+
+    if(part_first_[nlocal] > part_size_)
+    {
+        part_size_ = part_first_[nlocal];
+        memory->destroy(part_tri_);
+        memory->create(part_tri_,part_size_,"neighlist_mesh:part_tri");
+    }
+
+    // use part_first_ as fill pointer, shift back afterwards
+
+    for(size_t iTri = 0; iTri < nall; iTri++)
+    {
+        const std::vector<int> & contacts = triangles[iTri].contacts;
+        const int ncontacts = contacts.size();
+        for(int iCont = 0; iCont < ncontacts; iCont++)
+        {
+            const int iPart = contacts[iCont];
+            if(iPart < nlocal)
+                part_tri_[part_first_[iPart]++] = iTri;
+        }
+    }
+
+    for(int i = nlocal; i > 0; i--)
+        part_first_[i] = part_first_[i-1];
+    part_first_[0] = 0;
 }
 
 /* ---------------------------------------------------------------------- */
@@ -112,6 +112,23 @@ class FixNeighlistMesh : public Fix
 
     int getTotalNumContacts() { return numAllContacts_; }
 
+    // particle-major view (CSR) of the contact lists of owned particles
+    // built together with the triangle lists if enabled
+    // triangles of particle i are particle_tris()[particle_first()[i]] ...
+    // particle_tris()[particle_first()[i+1]-1], in ascending order
+
+    void enableParticleList(bool enable)
+    {
+      particleList_ = enable;
+      if(enable) buildNeighList = true;
+    }
+
+    inline const int * particle_first() const
+    { return part_first_; }
+
+    inline const int * particle_tris() const
+    { return part_tri_; }
+
     bool contactInList(int iTri, int iAtom)
     {
       std::vector<int> & neighbors = triangles[iTri].contacts;
@@ -158,6 +175,12 @@ class FixNeighlistMesh : public Fix
 
     void generate_bin_list(size_t nall);
 
+    void build_particle_list(size_t nall);
+
+    bool particleList_;
+    int *part_first_, *part_tri_;
+    int part_nmax_, part_size_;
+
     class AtomVecEllipsoid *avec;
 
     bool otherList_;
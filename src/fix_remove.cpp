@@ -0,0 +1,395 @@
+/* ----------------------------------------------------------------------
+    This is the
+
+    ██╗     ██╗ ██████╗  ██████╗  ██████╗ ██╗  ██╗████████╗███████╗
+    ██║     ██║██╔════╝ ██╔════╝ ██╔════╝ ██║  ██║╚══██╔══╝██╔════╝
+    ██║     ██║██║  ███╗██║  ███╗██║  ███╗███████║   ██║   ███████╗
+    ██║     ██║██║   ██║██║   ██║██║   ██║██╔══██║   ██║   ╚════██║
+    ███████╗██║╚██████╔╝╚██████╔╝╚██████╔╝██║  ██║   ██║   ███████║
+    ╚══════╝╚═╝ ╚═════╝  ╚═════╝  ╚═════╝ ╚═╝  ╚═╝   ╚═╝   ╚══════╝®
+
+    DEM simulation engine, released by
+    DCS Computing Gmbh, Linz, Austria
+    http://www.dcs-computing.com, office@dcs-computing.com
+
+    LIGGGHTS® is part of CFDEM®project:
+    http://www.liggghts.com | http://www.cfdem.com
+
+    Core developer and main author:
+    Christoph Kloss, christoph.kloss@dcs-computing.com
+
+    LIGGGHTS® is open-source, distributed under the terms of the GNU Public
+    License, version 2 or later. It is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+    of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. You should have
+    received a copy of the GNU General Public License along with LIGGGHTS®.
+    If not, see http://www.gnu.org/licenses . See also top-level README
+    and LICENSE files.
+
+    LIGGGHTS® and CFDEM® are registered trade marks of DCS Computing GmbH,
+    the producer of the LIGGGHTS® software and the CFDEM®coupling software
+    See http://www.cfdem.com/terms-trademark-policy for details.
+
+-------------------------------------------------------------------------
+    Contributing author and copyright for this file:
+    (if not contributing author is listed, this file has been contributed
+    by the core developer)
+
+    Copyright 2012-     DCS Computing GmbH, Linz
+------------------------------------------------------------------------- */
+
+#include <stdlib.h>
+#include <string.h>
+#include "fix_remove.h"
+#include "fix_multisphere.h"
+#include "multisphere.h"
+#include "mpi_liggghts.h"
+#include "atom.h"
+#include "atom_vec.h"
+#include "comm.h"
+#include "domain.h"
+#include "force.h"
+#include "modify.h"
+#include "region.h"
+#include "update.h"
+#include "memory.h"
+#include "error.h"
+
+using namespace LAMMPS_NS;
+using namespace FixConst;
+
+/* ---------------------------------------------------------------------- */
+
+FixRemove::FixRemove(LAMMPS *lmp, int narg, char **arg) :
+  Fix(lmp, narg, arg),
+  nevery_(0),
+  idregion_(NULL),
+  region_(NULL),
+  fix_ms_(NULL),
+  remove_bodies_(false),
+  dlist_(NULL),
+  nmax_(0),
+  nremoved_(0.),
+  mass_removed_(0.)
+{
+  int iarg = 3;
+
+  while(iarg < narg)
+  {
+    if(strcmp(arg[iarg],"nevery") == 0) {
+      if(iarg+2 > narg)
+        error->fix_error(FLERR,this,"not enough arguments for 'nevery'");
+      nevery_ = force->inumeric(FLERR,arg[iarg+1]);
+      if(nevery_ < 1)
+        error->fix_error(FLERR,this,"'nevery' > 0 required");
+      iarg += 2;
+    } else if(strcmp(arg[iarg],"region") == 0) {
+      if(iarg+2 > narg)
+        error->fix_error(FLERR,this,"not enough arguments for 'region'");
+      int iregion = domain->find_region(arg[iarg+1]);
+      if(iregion == -1)
+        error->fix_error(FLERR,this,"region ID does not exist");
+      int n = strlen(arg[iarg+1]) + 1;
+      idregion_ = new char[n];
+      strcpy(idregion_,arg[iarg+1]);
+      region_ = domain->regions[iregion];
+      iarg += 2;
+    } else {
+      char *errmsg = new char[strlen(arg[iarg])+50];
+      sprintf(errmsg,"unknown keyword or wrong keyword order: %s", arg[iarg]);
+      error->fix_error(FLERR,this,errmsg);
+      delete []errmsg;
+    }
+  }
+
+  if(!nevery_)
+    error->fix_error(FLERR,this,"expecting keyword 'nevery'");
+  if(!region_)
+    error->fix_error(FLERR,this,"expecting keyword 'region'");
+
+  // deletion is done in pre_exchange() on re-neighboring steps
+
+  force_reneighbor = 1;
+  next_reneighbor = (update->ntimestep/nevery_)*nevery_ + nevery_;
+
+  restart_global = 1;
+
+  vector_flag = 1;
+  size_vector = 2;
+  global_freq = 1;
+  extvector = 1;
+}
+
+/* ---------------------------------------------------------------------- */
+
+FixRemove::~FixRemove()
+{
+  delete []idregion_;
+  memory->destroy(dlist_);
+}
+
+/* ---------------------------------------------------------------------- */
+
+int FixRemove::setmask()
+{
+  int mask = 0;
+  mask |= PRE_EXCHANGE;
+  return mask;
+}
+
+/* ---------------------------------------------------------------------- */
+
+void FixRemove::init()
+{
+  int iregion = domain->find_region(idregion_);
+  if(iregion == -1)
+    error->fix_error(FLERR,this,"regions used by this command must not be deleted");
+  region_ = domain->regions[iregion];
+
+  // removal of whole multisphere bodies, called back by fix multisphere
+  // it clears its callbacks in init(), so has to be defined before this fix
+
+  fix_ms_ = static_cast<FixMultisphere*>(modify->find_fix_style("multisphere",0));
+  if(fix_ms_)
+  {
+    if(modify->find_fix(fix_ms_->id) > modify->find_fix(id))
+      error->fix_error(FLERR,this,"fix multisphere has to be defined before this fix");
+    fix_ms_->add_remove_callback(this);
+  }
+  remove_bodies_ = false;
+
+  if(next_reneighbor <= update->ntimestep)
+    next_reneighbor = (update->ntimestep/nevery_)*nevery_ + nevery_;
+}
+
+/* ----------------------------------------------------------------------
+   remove particles in region
+   done before exchange, borders, reneighbor
+   so that ghost atoms and neighbor lists will be correct
+------------------------------------------------------------------------- */
+
+void FixRemove::pre_exchange()
+{
+  if(next_reneighbor != update->ntimestep)
+    return;
+  next_reneighbor += nevery_;
+
+  mark_atoms();
+  delete_marked();
+
+  // multisphere bodies are removed as a whole after they were
+  // communicated, their atoms are then deleted by fix multisphere
+
+  if(fix_ms_)
+    remove_bodies_ = true;
+}
+
+/* ----------------------------------------------------------------------
+   flag owned atoms of the group inside the region
+------------------------------------------------------------------------- */
+
+void FixRemove::mark_atoms()
+{
+  double **x = atom->x;
+  int *mask = atom->mask;
+  int nlocal = atom->nlocal;
+
+  if(atom->nmax > nmax_)
+  {
+    nmax_ = atom->nmax;
+    memory->destroy(dlist_);
+    memory->create(dlist_,nmax_,"remove:dlist_");
+  }
+
+  for(int i = 0; i < nlocal; i++)
+  {
+    dlist_[i] = 0;
+    if(!(mask[i] & groupbit))
+      continue;
+    if(fix_ms_ && fix_ms_->belongs_to(i) >= 0)
+      continue;
+    if(region_->match(x[i][0],x[i][1],x[i][2]))
+      dlist_[i] = 1;
+  }
+}
+
+/* ----------------------------------------------------------------------
+   delete flagged atoms in one pass
+   each hole is filled with the last owned atom that is kept, so each
+   kept atom is copied at most once and deleted atoms are never copied
+   copy() also copies all per-atom data of fixes, e.g. fix property/atom
+   and contact history
+   ghost atoms are shifted down behind the kept atoms afterwards, so fixes
+   invoked later in pre_exchange, e.g. the overlap check of fix insert,
+   still see the atoms of neighboring procs
+------------------------------------------------------------------------- */
+
+void FixRemove::delete_marked()
+{
+  AtomVec *avec = atom->avec;
+  int *tag = atom->tag;
+  int *type = atom->type;
+  double *rmass = atom->rmass;
+  int nlocal = atom->nlocal;
+
+  int ndelete = 0;
+  for(int i = 0; i < nlocal; i++)
+    ndelete += dlist_[i];
+
+  double data[3] = {0.,0.,0.};
+
+  if(ndelete)
+  {
+    // a map array is updated incrementally if few atoms are deleted
+    // otherwise it is cleared and set again, which is cheaper in this case
+    // so is a hash map, since entries of deleted tags would not be freed
+
+    const int map_style = atom->tag_enable ? atom->map_style : 0;
+    int *map_array = (1 == map_style && 8*ndelete < nlocal) ? atom->get_map_array() : NULL;
+
+    if(map_style && !map_array)
+      atom->map_clear();
+
+    int i = 0;
+    while(i < nlocal)
+    {
+      if(!dlist_[i])
+      {
+        i++;
+        continue;
+      }
+
+      // deleted atoms at the end need not be copied
+
+      while(nlocal-1 > i && dlist_[nlocal-1])
+      {
+        nlocal--;
+        const double cg = force->cg(type[nlocal]);
+        data[1] += cg*cg*cg;
+        if(rmass) data[2] += rmass[nlocal];
+        if(map_array && map_array[tag[nlocal]] == nlocal)
+          map_array[tag[nlocal]] = -1;
+      }
+
+      const double cg = force->cg(type[i]);
+      data[1] += cg*cg*cg;
+      if(rmass) data[2] += rmass[i];
+      if(map_array && map_array[tag[i]] == i)
+        map_array[tag[i]] = -1;
+
+      nlocal--;
+      if(nlocal > i)
+      {
+        avec->copy(nlocal,i,1);
+        if(map_array)
+          map_array[tag[i]] = i;
+      }
+      i++;
+    }
+
+    // ghosts keep their order, so each one is copied to a lower index
+    // that has been read already
+
+    const int nghost = atom->nghost;
+    const int shift = atom->nlocal - nlocal;
+    for(int j = nlocal; j < nlocal + nghost; j++)
+    {
+      avec->copy(j+shift,j,0);
+      if(map_array && map_array[tag[j]] == j+shift)
+        map_array[tag[j]] = j;
+    }
+
+    atom->nlocal = nlocal;
+    if(map_style && !map_array)
+      atom->map_set();
+  }
+
+  data[0] = static_cast<double>(ndelete);
+  MPI_Sum_Vector(data,3,world);
+
+  if(data[0] > 0.)
+  {
+    atom->natoms -= static_cast<bigint>(data[0]);
+    nremoved_ += data[1];
+    mass_removed_ += data[2];
+  }
+}
+
+/* ----------------------------------------------------------------------
+   remove multisphere bodies with their center of mass in region
+   called by fix multisphere in pre_neighbor() after bodies were
+   communicated
+------------------------------------------------------------------------- */
+
+void FixRemove::delete_bodies()
+{
+  if(!remove_bodies_)
+    return;
+  remove_bodies_ = false;
+
+  Multisphere &ms = fix_ms_->data();
+  double xcm[3];
+  double data[2] = {0.,0.};
+
+  int ibody = 0;
+  while(ibody < ms.n_body())
+  {
+    ms.xcm(xcm,ibody);
+    if(region_->match(xcm[0],xcm[1],xcm[2]))
+    {
+      data[0] += 1.;
+      data[1] += ms.mass(ibody);
+      ms.remove_body(ibody);
+    }
+    else ibody++;
+  }
+
+  MPI_Sum_Vector(data,2,world);
+
+  nremoved_ += data[0];
+  mass_removed_ += data[1];
+}
+
+/* ----------------------------------------------------------------------
+   pack entire state of Fix into one write
+------------------------------------------------------------------------- */
+
+void FixRemove::write_restart(FILE *fp)
+{
+  int n = 0;
+  double list[3];
+  list[n++] = nremoved_;
+  list[n++] = mass_removed_;
+  list[n++] = static_cast<double>(next_reneighbor);
+
+  if(comm->me == 0) {
+    int size = n * sizeof(double);
+    fwrite(&size,sizeof(int),1,fp);
+    fwrite(list,sizeof(double),n,fp);
+  }
+}
+
+/* ----------------------------------------------------------------------
+   use state info from restart file to restart the Fix
+------------------------------------------------------------------------- */
+
+void FixRemove::restart(char *buf)
+{
+  int n = 0;
+  double *list = (double *) buf;
+
+  nremoved_ = list[n++];
+  mass_removed_ = list[n++];
+  next_reneighbor = static_cast<bigint>(list[n++]);
+}
+
+/* ----------------------------------------------------------------------
+   output # and mass of removed particles
+------------------------------------------------------------------------- */
+
+double FixRemove::compute_vector(int index)
+{
+  if(0 == index)
+    return nremoved_;
+  return mass_removed_;
+}
@@ -1 +1,99 @@
-namespace LAMMPS_NS {class FixRemove { public: void delete_bodies(){} };}
+/* ----------------------------------------------------------------------
+    This is the
+
+    ██╗     ██╗ ██████╗  ██████╗  ██████╗ ██╗  ██╗████████╗███████╗
+    ██║     ██║██╔════╝ ██╔════╝ ██╔════╝ ██║  ██║╚══██╔══╝██╔════╝
+    ██║     ██║██║  ███╗██║  ███╗██║  ███╗███████║   ██║   ███████╗
+    ██║     ██║██║   ██║██║   ██║██║   ██║██╔══██║   ██║   ╚════██║
+    ███████╗██║╚██████╔╝╚██████╔╝╚██████╔╝██║  ██║   ██║   ███████║
+    ╚══════╝╚═╝ ╚═════╝  ╚═════╝  ╚═════╝ ╚═╝  ╚═╝   ╚═╝   ╚══════╝®
+
+    DEM simulation engine, released by
+    DCS Computing Gmbh, Linz, Austria
+    http://www.dcs-computing.com, office@dcs-computing.com
+
+    LIGGGHTS® is part of CFDEM®project:
+    http://www.liggghts.com | http://www.cfdem.com
+
+    Core developer and main author:
+    Christoph Kloss, christoph.kloss@dcs-computing.com
+
+    LIGGGHTS® is open-source, distributed under the terms of the GNU Public
+    License, version 2 or later. It is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+    of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. You should have
+    received a copy of the GNU General Public License along with LIGGGHTS®.
+    If not, see http://www.gnu.org/licenses . See also top-level README
+    and LICENSE files.
+
+    LIGGGHTS® and CFDEM® are registered trade marks of DCS Computing GmbH,
+    the producer of the LIGGGHTS® software and the CFDEM®coupling software
+    See http://www.cfdem.com/terms-trademark-policy for details.
+
+-------------------------------------------------------------------------
+    Contributing author and copyright for this file:
+    (if not contributing author is listed, this file has been contributed
+    by the core developer)
+
+    Copyright 2012-     DCS Computing GmbH, Linz
+------------------------------------------------------------------------- */
+
+#ifdef FIX_CLASS
+
+FixStyle(remove,FixRemove)
+
+#else
+
+#ifndef LMP_FIX_REMOVE_H
+#define LMP_FIX_REMOVE_H
+
+#include "fix.h"
+
+namespace LAMMPS_NS {
+
+class FixRemove : public Fix {
+
+ public:
+
+  FixRemove(class LAMMPS *lmp, int narg, char ** arg);
+  ~FixRemove();
+
+  int setmask();
+  void init();
+  void pre_exchange();
+
+  // called by fix multisphere in pre_neighbor()
+  void delete_bodies();
+
+  void write_restart(FILE *fp);
+  void restart(char *buf);
+
+  double compute_vector(int index);
+
+ protected:
+
+  void mark_atoms();
+  void delete_marked();
+
+  int nevery_;
+
+  char *idregion_;
+  class Region *region_;
+
+  class FixMultisphere *fix_ms_;
+
+  // true if bodies are to be removed in next call of delete_bodies()
+  bool remove_bodies_;
+
+  // deletion flag for each owned atom
+  int *dlist_;
+  int nmax_;
+
+  // total # and mass of removed particles
+  double nremoved_, mass_removed_;
+};
+
+}
+
+#endif
+#endif
@@ -76,6 +76,8 @@ FixSph::FixSph(LAMMPS *lmp, int narg, char **arg) :
   fppaSlType = NULL;
   sl = NULL;
   slComType = NULL;
+
+  pair_sph_ = NULL;
 }
 
 /* ---------------------------------------------------------------------- */
@@ -111,6 +113,12 @@ void FixSph::init()
   if (strcmp(update->integrate_style,"respa") == 0)
     nlevels_respa = ((Respa *) update->integrate)->nlevels;
 
+  // kernel cache of the pair style can be used unless it is a hybrid style
+  // (skip lists do not contain all pairs)
+  pair_sph_ = NULL;
+  if (force->pair && strncmp(force->pair_style,"sph/",4) == 0)
+    pair_sph_ = static_cast<PairSph*>(force->pair);
+
   // check if kernel id is set
   if (kernel_flag && kernel_id < 0) error->all(FLERR,"No sph kernel for fixes is set.");
   // set kernel_cut
@@ -159,6 +167,16 @@ void FixSph::post_integrate_respa(int ilevel, int iloop)
 
 /* ---------------------------------------------------------------------- */
 
+const SphKernelCache *FixSph::kernel_cache()
+{
+  // per-atom smoothing length (sph/var) keeps the direct evaluation
+
+  if (!pair_sph_ || !kernel_flag || !mass_type) return NULL;
+  return pair_sph_->kernel_cache(kernel_id);
+}
+
+/* ---------------------------------------------------------------------- */
+
 void FixSph::updatePtrs()
 {
   if (fppaSl) sl = fppaSl->vector_atom;
@@ -75,6 +75,12 @@ class FixSph : public Fix {
   class NeighList *list;
   int nlevels_respa;
 
+  // per-pair kernel data shared with the other sph fixes and the pair style
+  // needs current ghost positions, valid until the pair computation
+  // NULL if not available for this fix or for per-atom smoothing length
+  const struct SphKernelCache *kernel_cache();
+  class PairSph *pair_sph_;
+
   int mass_type; // flag defined in atom_vec*
 
 };
@@ -54,6 +54,7 @@
 #include "error.h"
 #include "sph_kernels.h"
 #include "fix_property_atom.h"
+#include "pair_sph.h"
 #include "timer.h"
 
 using namespace LAMMPS_NS;
@@ -171,6 +172,14 @@ void FixSphDensityContinuity::pre_force_eval(int vflag)
 
   if (igroup == atom->firstgroup) nlocal = atom->nfirst;
 
+  // reuse kernel values shared with the other sph fixes and the pair style
+
+  const SphKernelCache *kc = kernel_cache();
+  if (kc) {
+    pre_force_cached<MASSFLAG>(kc);
+    return;
+  }
+
   // need updated ghost positions and self contributions
   timer->stamp();
   
@@ -255,3 +264,64 @@ void FixSphDensityContinuity::pre_force_eval(int vflag)
   }
 
 }
+
+/* ----------------------------------------------------------------------
+   same as pre_force_eval, pair distances and kernel from kernel cache
+------------------------------------------------------------------------- */
+
+template <int MASSFLAG>
+void FixSphDensityContinuity::pre_force_cached(const SphKernelCache *kc)
+{
+  int i,j,ii,k,itype;
+  double rinv,gradWmag,delVDotDelR,imass,jmass;
+
+  double **v = atom->vest;
+  double *drho = atom->drho;
+  int *mask = atom->mask;
+  int nlocal = atom->nlocal;
+
+  int *type = atom->type;       // if MASSFLAG
+  double *mass = atom->mass;    // if MASSFLAG
+  double *rmass = atom->rmass;  // if !MASSFLAG
+
+  int newton_pair = force->newton_pair;
+
+  if (igroup == atom->firstgroup) nlocal = atom->nfirst;
+
+  for (ii = 0; ii < kc->inum; ii++) {
+    i = kc->ilist[ii];
+    if (!(mask[i] & groupbit)) continue;
+
+    if (MASSFLAG) {
+      itype = type[i];
+      imass = mass[itype];
+    } else {
+      imass = rmass[i];
+    }
+
+    for (k = kc->first[ii]; k < kc->first[ii+1]; k++) {
+      j = kc->jlist[k];
+      if (!(mask[j] & groupbit)) continue;
+
+      if (MASSFLAG) jmass = mass[type[j]];
+      else jmass = rmass[j];
+
+      const double *del = kc->del[k];
+      rinv = 1./del[3];
+
+      //    scalar product of delV and delR/R
+      delVDotDelR = rinv * ( del[0]*(v[i][0]-v[j][0]) + del[1]*(v[i][1]-v[j][1]) + del[2]*(v[i][2]-v[j][2]) );
+
+      gradWmag = kc->dw[k];
+
+      // add contribution of neighbor
+      // have a half neigh list, so do it for both if necessary
+
+      drho[i] += jmass*gradWmag*delVDotDelR;
+
+      if (newton_pair || j < nlocal) {
+        drho[j] += imass*gradWmag*delVDotDelR;
+      }
+    }
+  }
+}
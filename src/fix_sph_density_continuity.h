@@ -60,6 +60,7 @@ class FixSphDensityContinuity : public FixSph {
 
  private:
   template <int> void pre_force_eval(int);
+  template <int> void pre_force_cached(const struct SphKernelCache *);
   double calcDensityDer(double, double, double);
 
 };
@@ -54,6 +54,7 @@
 #include "memory.h"
 #include "error.h"
 #include "sph_kernels.h"
+#include "pair_sph.h"
 #include "fix_property_atom.h"
 #include "timer.h"
 
@@ -220,17 +221,25 @@ void FixSphDensityCorr::pre_force_eval()
 
   int newton_pair = force->newton_pair;
 
-  updatePtrs(); // get sl, quantity
-
-  timer->stamp();
-  comm->forward_comm();
-  if (!MASSFLAG) fppaSl->do_forward_comm();
-  timer->stamp(TIME_COMM);
-
   ago++;
   if (ago % every == 0) {
     ago = 0;
 
+    updatePtrs(); // get sl, quantity
+
+    timer->stamp();
+    comm->forward_comm();
+    if (!MASSFLAG) fppaSl->do_forward_comm();
+    timer->stamp(TIME_COMM);
+
+    // reuse kernel values shared with the other sph fixes and the pair style
+
+    const SphKernelCache *kc = kernel_cache();
+    if (kc) {
+      pre_force_cached<MASSFLAG>(kc);
+      return;
+    }
+
     // kernel normalization
 
     for (i = 0; i < nlocal; i++)
@@ -444,3 +453,137 @@ void FixSphDensityCorr::pre_force_eval()
     timer->stamp(TIME_COMM);
   }
 }
+
+/* ----------------------------------------------------------------------
+   same as the correction in pre_force_eval, pair distances and kernel
+   from kernel cache
+------------------------------------------------------------------------- */
+
+template <int MASSFLAG>
+void FixSphDensityCorr::pre_force_cached(const SphKernelCache *kc)
+{
+  int i,j,ii,k,itype;
+  double W,sli,sliInv,imass,jmass;
+
+  int *mask = atom->mask;
+  double *rho = atom->rho;
+  int nlocal = atom->nlocal;
+
+  int *type = atom->type;
+  double *mass = atom->mass;
+  double *rmass = atom->rmass;
+
+  int newton_pair = force->newton_pair;
+
+  // kernel normalization, contribution of self
+
+  for (i = 0; i < nlocal; i++)
+  {
+    if (mask[i] & groupbit) {
+      if (MASSFLAG) {
+        itype = type[i];
+        sli = sl[itype-1];
+        imass = mass[itype];
+      } else {
+        sli = sl[i];
+        imass = rmass[i];
+      }
+
+      sliInv = 1./sli;
+
+      W = SPH_KERNEL_NS::sph_kernel(kernel_id,0.,sli,sliInv);
+      if (W < 0.)
+      {
+        fprintf(screen,"s = %f, W = %f\n",0.,W);
+        error->one(FLERR,"Illegal kernel used, W < 0");
+      }
+
+      quantity[i] = W*imass / rho[i];
+    }
+  }
+
+  // contribution of neighbors, have a half neigh list
+
+  for (ii = 0; ii < kc->inum; ii++) {
+    i = kc->ilist[ii];
+    if (!(mask[i] & groupbit)) continue;
+
+    if (MASSFLAG) imass = mass[type[i]];
+    else imass = rmass[i];
+
+    for (k = kc->first[ii]; k < kc->first[ii+1]; k++) {
+      j = kc->jlist[k];
+      if (!(mask[j] & groupbit)) continue;
+
+      if (MASSFLAG) jmass = mass[type[j]];
+      else jmass = rmass[j];
+
+      W = kc->w[k];
+      if (W < 0.)
+      {
+        fprintf(screen,"r = %f, W = %f\n",kc->del[k][3],W);
+        error->one(FLERR,"Illegal kernel used, W < 0");
+      }
+
+      quantity[i] += W*jmass / rho[j];
+      if (newton_pair || j < nlocal)
+        quantity[j] += W*imass / rho[i];
+    }
+  }
+
+  // reset and add rho contribution of self
+
+  for (i = 0; i < nlocal; i++) {
+    if (mask[i] & groupbit) {
+      if (MASSFLAG) {
+        itype = type[i];
+        sli = sl[itype-1];
+        imass = mass[itype];
+      } else {
+        sli = sl[i];
+        imass = rmass[i];
+      }
+
+      sliInv = 1./sli;
+      rho[i] = SPH_KERNEL_NS::sph_kernel(kernel_id,0.,sli,sliInv)*imass;
+    }
+  }
+
+  // need updated ghost rho
+  timer->stamp();
+  comm->forward_comm();
+  timer->stamp(TIME_COMM);
+
+  for (ii = 0; ii < kc->inum; ii++) {
+    i = kc->ilist[ii];
+    if (!(mask[i] & groupbit)) continue;
+
+    if (MASSFLAG) imass = mass[type[i]];
+    else imass = rmass[i];
+
+    for (k = kc->first[ii]; k < kc->first[ii+1]; k++) {
+      j = kc->jlist[k];
+      if (!(mask[j] & groupbit)) continue;
+
+      if (MASSFLAG) jmass = mass[type[j]];
+      else jmass = rmass[j];
+
+      W = kc->w[k];
+      rho[i] += W*jmass;
+      if (newton_pair || j < nlocal)
+        rho[j] += W*imass;
+    }
+  }
+
+  // normalize rho
+  for (i = 0; i < nlocal; i++) {
+    if (mask[i] & groupbit) {
+      rho[i] = rho[i]/quantity[i];
+    }
+  }
+
+  // rho is now correct, send to ghosts
+  timer->stamp();
+  comm->forward_comm();
+  timer->stamp(TIME_COMM);
+}
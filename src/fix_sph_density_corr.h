@@ -65,6 +65,7 @@ class FixSphDensityCorr : public FixSph {
 
  private:
   template <int> void pre_force_eval();
+  template <int> void pre_force_cached(const struct SphKernelCache *);
 
   class FixPropertyAtom* fix_quantity;
   char *quantity_name;
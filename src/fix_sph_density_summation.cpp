@@ -57,6 +57,7 @@
 #include "error.h"
 #include "sph_kernels.h"
 #include "fix_property_atom.h"
+#include "pair_sph.h"
 #include "timer.h"
 
 using namespace LAMMPS_NS;
@@ -207,6 +208,19 @@ void FixSPHDensitySum::post_integrate_eval()
 
   timer->stamp(TIME_COMM);
 
+  // reuse kernel values shared with the other sph fixes and the pair style
+
+  const SphKernelCache *kc = kernel_cache();
+  if (kc) {
+    post_integrate_cached<MASSFLAG>(kc);
+
+    // rho is now correct, send to ghosts
+    timer->stamp();
+    comm->forward_comm();
+    timer->stamp(TIME_COMM);
+    return;
+  }
+
   // loop over neighbors of my atoms
 
   inum = list->inum;
@@ -287,3 +301,58 @@ void FixSPHDensitySum::post_integrate_eval()
   timer->stamp(TIME_COMM);
 
 }
+
+/* ----------------------------------------------------------------------
+   same as post_integrate_eval, pair distances and kernel from kernel cache
+------------------------------------------------------------------------- */
+
+template <int MASSFLAG>
+void FixSPHDensitySum::post_integrate_cached(const SphKernelCache *kc)
+{
+  int i,j,ii,k,itype;
+  double W,imass,jmass;
+
+  int *mask = atom->mask;
+  double *rho = atom->rho;
+  int newton_pair = force->newton_pair;
+  int nlocal = atom->nlocal;
+
+  int *type = atom->type;
+  double *mass = atom->mass;
+  double *rmass = atom->rmass;
+
+  for (ii = 0; ii < kc->inum; ii++) {
+    i = kc->ilist[ii];
+    if (!(mask[i] & groupbit)) continue;
+
+    if (MASSFLAG) {
+      itype = type[i];
+      imass = mass[itype];
+    } else {
+      imass = rmass[i];
+    }
+
+    for (k = kc->first[ii]; k < kc->first[ii+1]; k++) {
+      j = kc->jlist[k];
+      if (!(mask[j] & groupbit)) continue;
+
+      if (MASSFLAG) jmass = mass[type[j]];
+      else jmass = rmass[j];
+
+      W = kc->w[k];
+      if (W < 0.)
+      {
+        fprintf(screen,"r = %f, W = %f\n",kc->del[k][3],W);
+        error->one(FLERR,"Illegal kernel used, W < 0");
+      }
+
+      // add contribution of neighbor
+      // have a half neigh list, so do it for both if necessary
+
+      rho[i] += W * jmass;
+
+      if (newton_pair || j < nlocal)
+        rho[j] += W * imass;
+    }
+  }
+}
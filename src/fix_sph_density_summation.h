@@ -61,6 +61,7 @@ class FixSPHDensitySum : public FixSph {
 
  private:
   template <int> void post_integrate_eval();
+  template <int> void post_integrate_cached(const struct SphKernelCache *);
 
 };
 
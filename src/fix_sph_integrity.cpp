@@ -75,6 +75,7 @@ FixSphIntegrity::FixSphIntegrity(LAMMPS *lmp, int narg, char **arg) :
   iarg += 3;
 
   every = 1;
+  ago = 0;
 
   while (iarg < narg) {
     // kernel style
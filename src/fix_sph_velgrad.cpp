@@ -57,6 +57,7 @@
 #include "error.h"
 #include "sph_kernels.h"
 #include "fix_property_atom.h"
+#include "pair_sph.h"
 #include "timer.h"
 
 using namespace LAMMPS_NS;
@@ -273,6 +274,15 @@ void FixSphVelgrad::pre_force_eval(int vflag)
     comm->forward_comm();
     timer->stamp(TIME_COMM);
 
+    // reuse kernel values shared with the other sph fixes and the pair style
+    // no forward comm afterwards, dvdx, dvdy, dvdz are only used for owned atoms
+
+    const SphKernelCache *kc = kernel_cache();
+    if (kc) {
+      pre_force_cached<MASSFLAG>(kc);
+      return;
+    }
+
     // loop over neighbors of my atoms
 
     inum = list->inum;
@@ -358,8 +368,91 @@ void FixSphVelgrad::pre_force_eval(int vflag)
         dvdz_[i][1] += m_rhoGradWmag_r * delvy * delz;
         dvdz_[i][2] += m_rhoGradWmag_r * delvz * delz;
 
-        if (newton_pair || j < nlocal)
+        if (newton_pair || j < nlocal) {
           m_rhoGradWmag_r = imass / irho * gradWmag / r;
+          dvdx_[j][0] += m_rhoGradWmag_r * delvx * delx;
+          dvdx_[j][1] += m_rhoGradWmag_r * delvy * delx;
+          dvdx_[j][2] += m_rhoGradWmag_r * delvz * delx;
+          dvdy_[j][0] += m_rhoGradWmag_r * delvx * dely;
+          dvdy_[j][1] += m_rhoGradWmag_r * delvy * dely;
+          dvdy_[j][2] += m_rhoGradWmag_r * delvz * dely;
+          dvdz_[j][0] += m_rhoGradWmag_r * delvx * delz;
+          dvdz_[j][1] += m_rhoGradWmag_r * delvy * delz;
+          dvdz_[j][2] += m_rhoGradWmag_r * delvz * delz;
+        }
+      }
+    }
+
+    // dvdx, dvdy, dvdz are now correct for owned atoms
+    // (atom data did not change, so no forward comm needed)
+  }
+}
+
+/* ----------------------------------------------------------------------
+   same as the loop in pre_force_eval, pair distances and kernel from
+   kernel cache
+------------------------------------------------------------------------- */
+
+template <int MASSFLAG>
+void FixSphVelgrad::pre_force_cached(const SphKernelCache *kc)
+{
+  int i,j,ii,k,itype;
+  double r,gradWmag,m_rhoGradWmag_r,delvx,delvy,delvz,imass,jmass,irho,jrho;
+
+  double **v = atom->vest;
+  int *mask = atom->mask;
+  double *rho = atom->rho;
+  int newton_pair = force->newton_pair;
+
+  int *type = atom->type;
+  double *mass = atom->mass;
+  double *rmass = atom->rmass;
+  int nlocal = atom->nlocal;
+
+  for (ii = 0; ii < kc->inum; ii++) {
+    i = kc->ilist[ii];
+    if (!(mask[i] & groupbit)) continue;
+
+    if (MASSFLAG) {
+      itype = type[i];
+      imass = mass[itype];
+    } else {
+      imass = rmass[i];
+    }
+    irho = rho[i];
+
+    for (k = kc->first[ii]; k < kc->first[ii+1]; k++) {
+      j = kc->jlist[k];
+      if (!(mask[j] & groupbit)) continue;
+
+      if (MASSFLAG) jmass = mass[type[j]];
+      else jmass = rmass[j];
+      jrho = rho[j];
+
+      const double delx = kc->del[k][0];
+      const double dely = kc->del[k][1];
+      const double delz = kc->del[k][2];
+      r = kc->del[k][3];
+      gradWmag = kc->dw[k];
+
+      m_rhoGradWmag_r = jmass / jrho * gradWmag / r;
+
+      delvx = v[j][0] - v[i][0];
+      delvy = v[j][1] - v[i][1];
+      delvz = v[j][2] - v[i][2];
+
+      dvdx_[i][0] += m_rhoGradWmag_r * delvx * delx;
+      dvdx_[i][1] += m_rhoGradWmag_r * delvy * delx;
+      dvdx_[i][2] += m_rhoGradWmag_r * delvz * delx;
+      dvdy_[i][0] += m_rhoGradWmag_r * delvx * dely;
+      dvdy_[i][1] += m_rhoGradWmag_r * delvy * dely;
+      dvdy_[i][2] += m_rhoGradWmag_r * delvz * dely;
+      dvdz_[i][0] += m_rhoGradWmag_r * delvx * delz;
+      dvdz_[i][1] += m_rhoGradWmag_r * delvy * delz;
+      dvdz_[i][2] += m_rhoGradWmag_r * delvz * delz;
+
+      if (newton_pair || j < nlocal) {
+        m_rhoGradWmag_r = imass / irho * gradWmag / r;
         dvdx_[j][0] += m_rhoGradWmag_r * delvx * delx;
         dvdx_[j][1] += m_rhoGradWmag_r * delvy * delx;
         dvdx_[j][2] += m_rhoGradWmag_r * delvz * delx;
@@ -371,10 +464,5 @@ void FixSphVelgrad::pre_force_eval(int vflag)
         dvdz_[j][2] += m_rhoGradWmag_r * delvz * delz;
       }
     }
-
-    // dvdx, dvdy, dvdz are now correct, send to ghosts
-    timer->stamp();
-    comm->forward_comm();
-    timer->stamp(TIME_COMM);
   }
 }
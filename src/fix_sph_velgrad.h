@@ -65,6 +65,7 @@ class FixSphVelgrad : public FixSph {
 
  private:
   template <int> void pre_force_eval(int);
+  template <int> void pre_force_cached(const struct SphKernelCache *);
 
   class FixPropertyAtom* fix_dvdx_;
   class FixPropertyAtom* fix_dvdy_;
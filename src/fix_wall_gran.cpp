@@ -72,6 +72,8 @@
 #include "primitive_wall_definitions.h"
 #include "mpi_liggghts.h"
 #include "neighbor.h"
+#include "timer.h"
+#include "perf_events.h"
 #include "contact_interface.h"
 #include "fix_property_global.h"
 #include "domain_wedge.h"
@@ -108,6 +110,10 @@ FixWallGran::FixWallGran(LAMMPS *lmp, int narg, char **arg) :
     if (strncmp(style,"wall/gran",9) == 0 && (!atom->radius_flag || !atom->omega_flag || !atom->torque_flag))
         error->fix_error(FLERR,this,"requires atom attributes radius, omega, torque");
 
+    // pre_force() only builds the neighbor list of primitive walls
+
+    pre_force_overlap = 1;
+
     // defaults
     store_force_ = false;
     store_force_contact_ = false;
@@ -145,6 +151,11 @@ FixWallGran::FixWallGran(LAMMPS *lmp, int narg, char **arg) :
     computeflag_ = 1;
 
     meshwall_ = -1;
+    particle_major_ = false;
+
+    prim_deltan_ = NULL;
+    prim_delta_ = NULL;
+    prim_nmax_ = 0;
 
     track_energy_ = false;
 
@@ -229,6 +240,14 @@ FixWallGran::FixWallGran(LAMMPS *lmp, int narg, char **arg) :
            hasargs = true;
            meshwall_ = 1;
            iarg_ += 1;
+        } else if (strcmp(arg[iarg_],"traversal") == 0) {
+           if (iarg_+2 > narg)
+              error->fix_error(FLERR,this," not enough arguments");
+           if (strcmp(arg[iarg_+1],"particle") == 0) particle_major_ = true;
+           else if (strcmp(arg[iarg_+1],"triangle") == 0) particle_major_ = false;
+           else error->fix_error(FLERR,this,"expecting 'particle' or 'triangle' after keyword 'traversal'");
+           hasargs = true;
+           iarg_ += 2;
         } else if (strcmp(arg[iarg_],"track_energy") == 0) {
            hasargs = true;
            track_energy_ = true;
@@ -376,7 +395,7 @@ FixWallGran::FixWallGran(LAMMPS *lmp, int narg, char **arg) :
         store_force_contact_stress_ = true;
 
     if (!allow_special_domain_periodic                               &&
-        (domain->triclinic || dynamic_cast<DomainWedge*>(domain))     &&
+        (domain->triclinic || (meshwall_ == 1 && dynamic_cast<DomainWedge*>(domain))) &&
         (domain->xperiodic || domain->yperiodic || domain->zperiodic) )
         error->fix_error(FLERR, this, "Triclinic or wedge domain is not allowed with periodic boundary conditions and meshes. This can be overridden by using the allow_special_domain_periodic option of fix wall/gran. In this case the user must ensure that meshes are sufficiently far away from periodic boundaries");
 }
@@ -487,6 +506,9 @@ void FixWallGran::post_create()
        FixMesh_list_[i]->createWallNeighList(igroup);
        FixMesh_list_[i]->createContactHistory(dnum());
 
+       if(particle_major_)
+         FixMesh_list_[i]->meshNeighlist()->enableParticleList(true);
+
        if(store_force_contact_)
          FixMesh_list_[i]->createMeshforceContact();
 
@@ -519,6 +541,22 @@ void FixWallGran::post_create()
               static_cast<FixPropertyAtom*>(modify->find_fix_property(hist_name,"property/atom","vector",dnum_,0,style));
           delete []fixarg;
           delete []hist_name;
+
+          // vector-valued history is stored in global coordinates
+          // offsets are detected from the names as in fix contacthistory
+
+          history_vector_offset_.clear();
+          for(int i = 0; i+2 < static_cast<int>(history_id_.size()); i++)
+          {
+              char *ids[3];
+              for(int k = 0; k < 3; k++)
+                  ids[k] = const_cast<char*>(history_id_[i+k].c_str());
+              if(FixContactHistory::is_vector_triple(ids))
+              {
+                  history_vector_offset_.push_back(i);
+                  i += 2;
+              }
+          }
    }
 
 }
@@ -565,6 +603,9 @@ FixWallGran::~FixWallGran()
     if(primitiveWall_ != 0) delete primitiveWall_;
     if(FixMesh_list_) delete []FixMesh_list_;
     delete impl;
+
+    memory->destroy(prim_deltan_);
+    memory->destroy(prim_delta_);
 }
 
 /* ---------------------------------------------------------------------- */
@@ -600,6 +641,23 @@ PrimitiveWall* FixWallGran::primitiveWall()
 
 /* ---------------------------------------------------------------------- */
 
+void FixWallGran::rotate_history(int i, const double rot[3][3])
+{
+    if(!fix_history_primitive_)
+        return;
+
+    double *h = fix_history_primitive_->array_atom[i];
+    double tmp[3];
+    for(size_t ivec = 0; ivec < history_vector_offset_.size(); ivec++)
+    {
+        double *hv = &h[history_vector_offset_[ivec]];
+        MathExtra::matvec(rot,hv,tmp);
+        vectorCopy3D(tmp,hv);
+    }
+}
+
+/* ---------------------------------------------------------------------- */
+
 void FixWallGran::init()
 {
     dt_ = update->dt;
@@ -738,10 +796,16 @@ void FixWallGran::post_force(int vflag)
     computeflag_ = 1;
     shearupdate_ = 1;
     if (update->setupflag) shearupdate_ = 0;
-    addflag_ = 0;
+
+    // fill compute wall/gran/local in this pass if it is invoked on this step
+
+    addflag_ = (cwl_ && cwl_->capture_due()) ? 1 : 0;
 
     post_force_wall(vflag);
 
+    if(addflag_)
+        cwl_->pair_finalize();
+    addflag_ = 0;
 }
 
 /* ----------------------------------------------------------------------
@@ -807,11 +871,19 @@ void FixWallGran::post_force_wall(int vflag)
           vectorZeroize3D(wallforce_[i]);
       }
   }
+  if(modify->timing) timer->start(TIME_WALL_CONTACT);
+
   if(meshwall_ == 1)
+  {
+    timer->perf->start(PERF_WALL_MESH);
     post_force_mesh(vflag);
+    timer->perf->stop(PERF_WALL_MESH);
+  }
   else
     post_force_primitive(vflag);
 
+  if(modify->timing) timer->stop(TIME_WALL_CONTACT);
+
   if(meshwall_ == 0 && store_force_contact_)
     fix_wallforce_contact_->do_forward_comm();
 
@@ -844,19 +916,12 @@ void FixWallGran::post_force_respa(int vflag, int ilevel, int iloop)
 
 void FixWallGran::post_force_mesh(int vflag)
 {
-    
-    // contact properties
-    double v_wall[3],bary[3];
-    double delta[3],deltan;
-    MultiVectorContainer<double,3,3> *vMeshC;
-    double *radius = atom->radius;
-    double ***vMesh = 0;
-    int nlocal = atom->nlocal;
-    int nTriAll, barysign = -1;
-    const double contactDistanceMultiplier = neighbor->contactDistanceFactor - 1.0;
+    const int nlocal = atom->nlocal;
+    int nTriAll;
 
     SurfacesIntersectData sidata;
     sidata.is_wall = true;
+    sidata.dt = update->dt;
 
     for(int iMesh = 0; iMesh < n_FixMesh_; iMesh++)
     {
@@ -880,134 +945,53 @@ void FixWallGran::post_force_mesh(int vflag)
       FixNeighlistMesh * meshNeighlist = FixMesh_list_[iMesh]->meshNeighlist();
 
       // moving mesh
-      vectorZeroize3D(v_wall);
-      vMeshC = mesh->prop().getElementProperty<MultiVectorContainer<double,3,3> >("v");
-      if(vMeshC)
-        vMesh = vMeshC->begin();
+      MultiVectorContainer<double,3,3> *vMeshC = mesh->prop().getElementProperty<MultiVectorContainer<double,3,3> >("v");
 
       atom_type_wall_ = FixMesh_list_[iMesh]->atomTypeWall();
 
-      // loop owned and ghost triangles
-      for(int iTri = 0; iTri < nTriAll; iTri++)
+      if(particle_major_)
       {
-          const std::vector<int> & neighborList = meshNeighlist->get_contact_list(iTri);
-          const int numneigh = neighborList.size();
-          for(int iCont = 0; iCont < numneigh; iCont++)
-          {
-            
-            const int iPart = neighborList[iCont];
-
-            // do not handle ghost particles
-            if (iPart >= nlocal) continue;
-
-            int idTri = mesh->id(iTri);
-
-            #ifdef SUPERQUADRIC_ACTIVE_FLAG
-                if(atom->superquadric_flag) {
-                  #ifdef LIGGGHTS_DEBUG
-                    if(std::isnan(vectorMag3D(x_[iPart])))
-                      error->fix_error(FLERR,this,"x_[iPart] is NaN!");
-                    if(std::isnan(vectorMag4D(quat_[iPart])))
-                      error->fix_error(FLERR,this,"quat_[iPart] is NaN!");
-                  #endif
-
-                  Superquadric particle(x_[iPart], quat_[iPart], shape_[iPart], blockiness_[iPart]);
-
-                  if(mesh->sphereTriangleIntersection(iTri, radius_[iPart], x_[iPart])) //check for Bounding Sphere-triangle intersection
-                  {
-                    deltan = mesh->resolveTriSuperquadricContact(iTri, delta, sidata.contact_point, particle, bary);
-                    #ifdef LIGGGHTS_DEBUG
-                        if(std::isnan(deltan))
-                          error->fix_error(FLERR,this,"deltan is NaN!");
-                        if(std::isnan(vectorMag3D(delta)))
-                          error->fix_error(FLERR,this,"delta is NaN!");
-                        if(std::isnan(vectorMag3D(sidata.contact_point)))
-                          error->fix_error(FLERR,this,"sidata.contact_point is NaN!");
-                    #endif
-                  }
-                  else
-                    deltan = LARGE_TRIMESH;
-                  sidata.is_non_spherical = true; //by default it is false
-                } else {
-                  sidata.radi = radius_ ? radius_[iPart] : r0_;
-                  if (fix_store_multicontact_data_)
-                  {
-                      double * deltaData = NULL;
-                      const bool contact = fix_store_multicontact_data_->haveContact(iPart, idTri, deltaData);
-                      if (contact)
-                          sidata.radi += deltaData[3];
-                  }
-                  deltan = mesh->resolveTriSphereContactBary(iPart, iTri, sidata.radi, x_[iPart], delta, bary, barysign, atom->shapetype_flag ? false : true);
-                }
-            #else
-                sidata.radi = radius_ ? radius_[iPart] : r0_;
-                if (fix_store_multicontact_data_)
-                {
-                    double * deltaData = NULL;
-                    const bool contact = fix_store_multicontact_data_->haveContact(iPart, idTri, deltaData);
-                    if (contact)
-                        sidata.radi += deltaData[3];
-                }
-                
-                deltan = mesh->resolveTriSphereContactBary(iPart, iTri, sidata.radi, x_[iPart], delta, bary, barysign, atom->shapetype_flag ? false : true);
-            #endif
-            
-            if(deltan > cutneighmax_) continue;
-
-            sidata.i = iPart;
-
-            bool intersectflag = (deltan <= 0);
+          // loop owned particles and their triangles
+          // all contacts of a particle are handled by the same thread
 
-            sidata.mesh = mesh;
+          const int *first = meshNeighlist->particle_first();
+          const int *tris = meshNeighlist->particle_tris();
 
-            if(atom->shapetype_flag)
-            {
-                
-                sidata.j = iTri;
-                fix_contact->handleContact(iPart,idTri,sidata.contact_history,intersectflag,false);
-                if(vMeshC)
-                {
-                    for(int i = 0; i < 3; i++)
-                        v_wall[i] = (bary[0]*vMesh[iTri][0][i] +
-                                     bary[1]*vMesh[iTri][1][i] +
-                                     bary[2]*vMesh[iTri][2][i] );
-                }
-                sidata.v_i = atom->v[iPart];
-                sidata.omega_i = atom->omega[iPart];
-                sidata.v_j = v_wall;
-                sidata.shearupdate = shearupdate_;
-                sidata.computeflag = computeflag_;
-                intersectflag = impl->checkSurfaceIntersect(sidata);
-                deltan = -sidata.deltan;
-                
-            }
-
-            sidata.fix_mesh = FixMesh_list_[iMesh];
-
-            if(deltan <= 0 || (radius && deltan < contactDistanceMultiplier*radius[iPart]))
-            {
-              
-              if(!atom->shapetype_flag && fix_contact && ! fix_contact->handleContact(iPart,idTri,sidata.contact_history,intersectflag,7 == barysign)) continue;
+#if defined(_OPENMP)
+          const bool threaded = mesh_contacts_threadsafe(FixMesh_list_[iMesh]);
+          #pragma omp parallel if(threaded)
+#endif
+          {
+              SurfacesIntersectData sidata_thread;
+              sidata_thread.is_wall = true;
+              sidata_thread.dt = update->dt;
 
-              if(vMeshC && !atom->shapetype_flag)
+#if defined(_OPENMP)
+              #pragma omp for schedule(dynamic,64)
+#endif
+              for(int iPart = 0; iPart < nlocal; iPart++)
               {
-                for(int i = 0; i < 3; i++)
-                    v_wall[i] = (bary[0]*vMesh[iTri][0][i] + bary[1]*vMesh[iTri][1][i] + bary[2]*vMesh[iTri][2][i]);
+                  for(int k = first[iPart]; k < first[iPart+1]; k++)
+                      post_force_mesh_contact(sidata_thread,iMesh,mesh,fix_contact,vMeshC,iPart,tris[k]);
               }
-
-              if(!sidata.is_non_spherical || atom->superquadric_flag)
-                sidata.deltan   = -deltan;
-              sidata.delta[0] = -delta[0];
-              sidata.delta[1] = -delta[1];
-              sidata.delta[2] = -delta[2];
-              if(impl)
-                impl->compute_force(this, sidata, intersectflag,v_wall,FixMesh_list_[iMesh],iMesh,mesh,iTri);
-              else
+          }
+      }
+      else
+      {
+          // loop owned and ghost triangles
+          for(int iTri = 0; iTri < nTriAll; iTri++)
+          {
+              const std::vector<int> & neighborList = meshNeighlist->get_contact_list(iTri);
+              const int numneigh = neighborList.size();
+              for(int iCont = 0; iCont < numneigh; iCont++)
               {
-                sidata.r =  r0_ - sidata.deltan;
-                compute_force(sidata, v_wall); // LEGACY CODE (SPH)
+                  const int iPart = neighborList[iCont];
+
+                  // do not handle ghost particles
+                  if (iPart >= nlocal) continue;
+
+                  post_force_mesh_contact(sidata,iMesh,mesh,fix_contact,vMeshC,iPart,iTri);
               }
-            }
           }
       }
 
@@ -1017,6 +1001,148 @@ void FixWallGran::post_force_mesh(int vflag)
     }
 }
 
+/* ----------------------------------------------------------------------
+   resolve contact of particle iPart with triangle iTri of mesh iMesh
+------------------------------------------------------------------------- */
+
+void FixWallGran::post_force_mesh_contact(SurfacesIntersectData &sidata, int iMesh, TriMesh *mesh,
+                                          FixContactHistoryMesh *fix_contact,
+                                          MultiVectorContainer<double,3,3> *vMeshC, int iPart, int iTri)
+{
+    // contact properties
+    double v_wall[3],bary[3];
+    double delta[3],deltan;
+    double *radius = atom->radius;
+    double ***vMesh = vMeshC ? vMeshC->begin() : 0;
+    int barysign = -1;
+    const double contactDistanceMultiplier = neighbor->contactDistanceFactor - 1.0;
+
+    vectorZeroize3D(v_wall);
+
+    int idTri = mesh->id(iTri);
+
+    #ifdef SUPERQUADRIC_ACTIVE_FLAG
+        if(atom->superquadric_flag) {
+          #ifdef LIGGGHTS_DEBUG
+            if(std::isnan(vectorMag3D(x_[iPart])))
+              error->fix_error(FLERR,this,"x_[iPart] is NaN!");
+            if(std::isnan(vectorMag4D(quat_[iPart])))
+              error->fix_error(FLERR,this,"quat_[iPart] is NaN!");
+          #endif
+
+          Superquadric particle(x_[iPart], quat_[iPart], shape_[iPart], blockiness_[iPart]);
+
+          if(mesh->sphereTriangleIntersection(iTri, radius_[iPart], x_[iPart])) //check for Bounding Sphere-triangle intersection
+          {
+            deltan = mesh->resolveTriSuperquadricContact(iTri, delta, sidata.contact_point, particle, bary);
+            #ifdef LIGGGHTS_DEBUG
+                if(std::isnan(deltan))
+                  error->fix_error(FLERR,this,"deltan is NaN!");
+                if(std::isnan(vectorMag3D(delta)))
+                  error->fix_error(FLERR,this,"delta is NaN!");
+                if(std::isnan(vectorMag3D(sidata.contact_point)))
+                  error->fix_error(FLERR,this,"sidata.contact_point is NaN!");
+            #endif
+          }
+          else
+            deltan = LARGE_TRIMESH;
+          sidata.is_non_spherical = true; //by default it is false
+        } else {
+          sidata.radi = radius_ ? radius_[iPart] : r0_;
+          if (fix_store_multicontact_data_)
+          {
+              double * deltaData = NULL;
+              const bool contact = fix_store_multicontact_data_->haveContact(iPart, idTri, deltaData);
+              if (contact)
+                  sidata.radi += deltaData[3];
+          }
+          deltan = mesh->resolveTriSphereContactBary(iPart, iTri, sidata.radi, x_[iPart], delta, bary, barysign, atom->shapetype_flag ? false : true);
+        }
+    #else
+        sidata.radi = radius_ ? radius_[iPart] : r0_;
+        if (fix_store_multicontact_data_)
+        {
+            double * deltaData = NULL;
+            const bool contact = fix_store_multicontact_data_->haveContact(iPart, idTri, deltaData);
+            if (contact)
+                sidata.radi += deltaData[3];
+        }
+        
+        deltan = mesh->resolveTriSphereContactBary(iPart, iTri, sidata.radi, x_[iPart], delta, bary, barysign, atom->shapetype_flag ? false : true);
+    #endif
+    
+    if(deltan > cutneighmax_) return;
+
+    sidata.i = iPart;
+
+    bool intersectflag = (deltan <= 0);
+
+    sidata.mesh = mesh;
+
+    if(atom->shapetype_flag)
+    {
+        
+        sidata.j = iTri;
+        fix_contact->handleContact(iPart,idTri,sidata.contact_history,intersectflag,false);
+        if(vMeshC)
+        {
+            for(int i = 0; i < 3; i++)
+                v_wall[i] = (bary[0]*vMesh[iTri][0][i] +
+                             bary[1]*vMesh[iTri][1][i] +
+                             bary[2]*vMesh[iTri][2][i] );
+        }
+        sidata.v_i = atom->v[iPart];
+        sidata.omega_i = atom->omega[iPart];
+        sidata.v_j = v_wall;
+        sidata.shearupdate = shearupdate_;
+        sidata.computeflag = computeflag_;
+        intersectflag = impl->checkSurfaceIntersect(sidata);
+        deltan = -sidata.deltan;
+        
+    }
+
+    sidata.fix_mesh = FixMesh_list_[iMesh];
+
+    if(deltan <= 0 || (radius && deltan < contactDistanceMultiplier*radius[iPart]))
+    {
+      
+      if(!atom->shapetype_flag && fix_contact && ! fix_contact->handleContact(iPart,idTri,sidata.contact_history,intersectflag,7 == barysign)) return;
+
+      if(vMeshC && !atom->shapetype_flag)
+      {
+        for(int i = 0; i < 3; i++)
+            v_wall[i] = (bary[0]*vMesh[iTri][0][i] + bary[1]*vMesh[iTri][1][i] + bary[2]*vMesh[iTri][2][i]);
+      }
+
+      if(!sidata.is_non_spherical || atom->superquadric_flag)
+        sidata.deltan   = -deltan;
+      sidata.delta[0] = -delta[0];
+      sidata.delta[1] = -delta[1];
+      sidata.delta[2] = -delta[2];
+      if(impl)
+        impl->compute_force(this, sidata, intersectflag,v_wall,FixMesh_list_[iMesh],iMesh,mesh,iTri);
+      else
+      {
+        sidata.r =  r0_ - sidata.deltan;
+        compute_force(sidata, v_wall); // LEGACY CODE (SPH)
+      }
+    }
+}
+
+/* ----------------------------------------------------------------------
+   mesh contacts can be resolved concurrently for different particles
+   only if nothing is accumulated outside of the particle's own data
+------------------------------------------------------------------------- */
+
+bool FixWallGran::mesh_contacts_threadsafe(FixMeshSurface *fix_mesh)
+{
+    return impl && !addflag_ && !heattransfer_flag_ && !track_energy_ &&
+           !store_force_contact_ && !store_force_contact_stress_ &&
+           !fix_store_multicontact_data_ && !atom->shapetype_flag &&
+           0 == fix_mesh->n_mesh_modules() &&
+           !modify->find_fix_style("calculate/wall_dissipated_energy",0);
+}
+
 /* ----------------------------------------------------------------------
    post_force for primitive wall
 ------------------------------------------------------------------------- */
@@ -1027,6 +1153,7 @@ void FixWallGran::post_force_primitive(int vflag)
 
   SurfacesIntersectData sidata;
   sidata.is_wall = true;
+  sidata.dt = update->dt;
   double *radius = atom->radius;
   const double contactDistanceMultiplier = neighbor->contactDistanceFactor - 1.0;
   
@@ -1045,6 +1172,23 @@ void FixWallGran::post_force_primitive(int vflag)
   int *neighborList;
   int nNeigh = primitiveWall_->getNeighbors(neighborList);
 
+  // resolve distances to the wall for the whole neighbor list at once
+  // not possible if the contact radius depends on multicontact data
+
+  const bool batch = !fix_store_multicontact_data_;
+  if(batch)
+  {
+    if(nNeigh > prim_nmax_)
+    {
+      prim_nmax_ = atom->nmax;
+      memory->destroy(prim_deltan_);
+      memory->destroy(prim_delta_);
+      memory->create(prim_deltan_,prim_nmax_,"wall/gran:prim_deltan");
+      memory->create(prim_delta_,prim_nmax_,3,"wall/gran:prim_delta");
+    }
+    primitiveWall_->resolveContacts(nNeigh,neighborList,x_,radius_,r0_,prim_deltan_,prim_delta_);
+  }
+
   for (int iCont = 0; iCont < nNeigh ; iCont++, neighborList++)
   {
     int iPart = *neighborList;
@@ -1052,14 +1196,19 @@ void FixWallGran::post_force_primitive(int vflag)
     if(!(mask[iPart] & groupbit)) continue;
 
     sidata.radi = radius_ ? radius_[iPart] : r0_;
-    if (fix_store_multicontact_data_)
+    if(batch)
+    {
+        deltan = prim_deltan_[iCont];
+        vectorCopy3D(prim_delta_[iCont],delta);
+    }
+    else
     {
         double * deltaData = NULL;
         const bool contact = fix_store_multicontact_data_->haveContact(iPart, 1, deltaData);
         if (contact)
             sidata.radi += deltaData[3];
+        deltan = primitiveWall_->resolveContact(x_[iPart], sidata.radi, delta);
     }
-    deltan = primitiveWall_->resolveContact(x_[iPart], sidata.radi, delta);
 
     if(deltan>cutneighmax_) continue;
 
@@ -1379,6 +1528,18 @@ void FixWallGran::addHeatFlux(TriMesh *mesh,int ip, const double ri, double delt
     if ((fabs(tcop) < SMALL) || (fabs(tcowall) < SMALL)) hc = 0.;
     else hc = 4.*tcop*tcowall/(tcop+tcowall)*sqrt(Acont);
 
+    // coarsegraining: a parcel touches the wall in place of cg^2 original
+    // particles, scale conductance so the wall heat transfer coefficient
+    // per wall area does not depend on cg
+    if(force->cg_active())
+    {
+        const double cg = force->cg(itype);
+        if(CONDUCTION_CONTACT_AREA_CONSTANT == area_calculation_mode_)
+            hc *= cg*cg;
+        else
+            hc *= cg;
+    }
+
     if(computeflag_)
     {
         double hf = (Temp_wall-Temp_p[ip]) * hc;
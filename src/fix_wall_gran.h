@@ -101,7 +101,7 @@ class FixWallGran : public Fix, public LIGGGHTS::IContactHistorySetup {
   { return iarg_; }
 
   int add_history_value(std::string name, std::string newtonflag)
-  {  return dnum_++; }
+  {  history_id_.push_back(name); return dnum_++; }
 
   int get_history_offset(const std::string hname)
   {  return impl->get_history_offset(hname);}
@@ -112,6 +112,10 @@ class FixWallGran : public Fix, public LIGGGHTS::IContactHistorySetup {
   inline int dnum() const
   { return dnum_; }
 
+  // rotate vector-valued primitive wall history of atom i, used by
+  // rotationally periodic domains when an atom is mapped across a wedge face
+  void rotate_history(int i, const double rot[3][3]);
+
   inline int n_meshes() const
   { return n_FixMesh_; }
 
@@ -246,6 +250,14 @@ class FixWallGran : public Fix, public LIGGGHTS::IContactHistorySetup {
   virtual void post_force_mesh(int);
   virtual void post_force_primitive(int);
 
+  void post_force_mesh_contact(LCM::SurfacesIntersectData & sidata, int iMesh, class TriMesh *mesh,
+                               class FixContactHistoryMesh *fix_contact,
+                               MultiVectorContainer<double,3,3> *vMeshC, int iPart, int iTri);
+  bool mesh_contacts_threadsafe(class FixMeshSurface *fix_mesh);
+
+  // traverse mesh contacts per particle instead of per triangle
+  bool particle_major_;
+
   // virtual functions that allow implementation of the
   // actual physics in the derived classes
   virtual void compute_force(LCM::SurfacesIntersectData & sidata, double *vwall);
@@ -313,8 +325,17 @@ class FixWallGran : public Fix, public LIGGGHTS::IContactHistorySetup {
   bool stress_flag_;
 
   class PrimitiveWall *primitiveWall_;
+
+  // per-neighbor distance to primitive wall, see post_force_primitive()
+  double *prim_deltan_;
+  double **prim_delta_;
+  int prim_nmax_;
   class FixPropertyAtom *fix_history_primitive_;
 
+  // history value names and offsets of x/y/z vector triples among them
+  std::vector<std::string> history_id_;
+  std::vector<int> history_vector_offset_;
+
   // class to keep track of wall contacts
   bool rebuildPrimitiveNeighlist_;
 
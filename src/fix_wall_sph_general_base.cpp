@@ -81,6 +81,8 @@ FixWallSphGeneralBase::FixWallSphGeneralBase(LAMMPS *lmp, int narg, char **arg)
   fix_dvdz_ = NULL;
 
   fixName = arg[0];
+
+  pre_force_overlap = 0;
 }
 
 /* ---------------------------------------------------------------------- */
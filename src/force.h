@@ -177,6 +177,18 @@ class Force : protected Pointers {
       return useTypeSpecific;
   }
 
+  void setCGGlobal(double cg)
+  {
+      coarsegraining_ = cg;
+      coarsegrainingTypeBased_.clear();
+  }
+
+  void setCGModelCheck(bool error, bool warn)
+  {
+      error_coarsegraining_ = error;
+      warn_coarsegraining_ = warn;
+  }
+
   void reportCG()
   {
     printf("Force: coarsegrainingfactor: %g.\n", coarsegraining_);
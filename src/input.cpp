@@ -583,6 +583,7 @@ int Input::execute_command()
   else if (!strcmp(command,"bond_style")) bond_style();
   else if (!strcmp(command,"boundary")) boundary();
   else if (!strcmp(command,"box")) box();
+  else if (!strcmp(command,"coarsegraining")) coarsegraining();
   else if (!strcmp(command,"communicate")) communicate();
   else if (!strcmp(command,"compute")) compute();
   else if (!strcmp(command,"compute_modify")) compute_modify();
@@ -1269,6 +1270,60 @@ void Input::box()
   domain->set_box(narg,arg);
 }
 
+/* ---------------------------------------------------------------------- */
+
+void Input::coarsegraining()
+{
+  if (narg < 1) error->all(FLERR,"Illegal coarsegraining command");
+  if (domain->box_exist && atom->natoms > 0)
+    error->all(FLERR,"Coarsegraining command must be used before particles are created");
+  if (modify->n_fixes_style("particletemplate"))
+    error->all(FLERR,"Coarsegraining command must be used before any fix particletemplate/* command");
+
+  // leading numeric args are the cg factors, either one global
+  // value or one value per atom type
+
+  int ncg = 0;
+  while (ncg < narg && strcmp(arg[ncg],"model_check")) ncg++;
+
+  bool check_error = true, check_warn = false;
+  if (ncg < narg) {
+    if (ncg+2 != narg) error->all(FLERR,"Illegal coarsegraining command");
+    if (!strcmp(arg[ncg+1],"error")) {
+      check_error = true; check_warn = false;
+    } else if (!strcmp(arg[ncg+1],"warn")) {
+      check_error = false; check_warn = true;
+    } else if (!strcmp(arg[ncg+1],"off")) {
+      check_error = false; check_warn = false;
+    } else error->all(FLERR,"Illegal coarsegraining command, model_check expects 'error', 'warn' or 'off'");
+  }
+  if (ncg == 0) error->all(FLERR,"Illegal coarsegraining command");
+  if (ncg > 1 && domain->box_exist && ncg != atom->ntypes)
+    error->all(FLERR,"Coarsegraining command expects either one value or one value per atom type");
+
+  for (int i = 0; i < ncg; i++)
+    if (force->numeric(FLERR,arg[i]) < 1.)
+      error->all(FLERR,"Coarsegraining factors must be >= 1");
+
+  if (ncg == 1) force->setCGGlobal(force->numeric(FLERR,arg[0]));
+  else {
+    force->setCGGlobal(1.);
+    for (int i = 0; i < ncg; i++)
+      force->setCG(force->numeric(FLERR,arg[i]));
+  }
+  force->setCGModelCheck(check_error,check_warn);
+
+  if (comm->me == 0) {
+    if (ncg == 1) {
+      if (screen) fprintf(screen,"Coarsegraining factor set to %g\n",force->cg_max());
+      if (logfile) fprintf(logfile,"Coarsegraining factor set to %g\n",force->cg_max());
+    } else {
+      if (screen) fprintf(screen,"Coarsegraining factors set per atom type, maximum %g\n",force->cg_max());
+      if (logfile) fprintf(logfile,"Coarsegraining factors set per atom type, maximum %g\n",force->cg_max());
+    }
+  }
+}
+
 /* ---------------------------------------------------------------------- */
 void Input::communicate()
 {
@@ -57,6 +57,7 @@
 #include "vector_liggghts.h"
 #include "input_mesh_tri.h"
 #include "tri_mesh.h"
+#include "tri_mesh_simplify.h"
 
 using namespace LAMMPS_NS;
 
@@ -64,7 +65,8 @@ InputMeshTri::InputMeshTri(LAMMPS *lmp, int argc, char **argv) : Input(lmp, argc
 verbose_(false),
 i_exclusion_list_(0),
 size_exclusion_list_(0),
-exclusion_list_(0)
+exclusion_list_(0),
+simplify_(0)
 {}
 
 InputMeshTri::~InputMeshTri()
@@ -76,11 +78,12 @@ InputMeshTri::~InputMeshTri()
 
 void InputMeshTri::meshtrifile(const char *filename, class TriMesh *mesh,bool verbose,
                                const int size_exclusion_list, int *exclusion_list,
-                               class Region *region)
+                               class Region *region, class TriMeshSimplify *simplify)
 {
   verbose_ = verbose;
   size_exclusion_list_ = size_exclusion_list;
   exclusion_list_ = exclusion_list;
+  simplify_ = simplify;
   
   if(strlen(filename) < 5)
     error->all(FLERR,"Illegal command, file name too short for input of triangular mesh");
@@ -120,6 +123,9 @@ void InputMeshTri::meshtrifile(const char *filename, class TriMesh *mesh,bool ve
   else error->all(FLERR,"Illegal command, need either an STL file or a VTK file as input for triangular mesh.");
 
   if(nonlammps_file) fclose(nonlammps_file);
+
+  if(simplify_)
+      simplify_->simplify(mesh);
 }
 
 /* ----------------------------------------------------------------------
@@ -581,6 +587,12 @@ void InputMeshTri::meshtrifile_stl_binary(class TriMesh *mesh, class Region *reg
 
 void InputMeshTri::addTriangle(TriMesh *mesh,double *a, double *b, double *c,int lineNumber)
 {
+    if(simplify_)
+    {
+        simplify_->addTriangle(a,b,c,lineNumber);
+        return;
+    }
+
     double **nodeTmp = create<double>(nodeTmp,3,3);
     for(int i=0;i<3;i++){
       nodeTmp[0][i] = a[i];
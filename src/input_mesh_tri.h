@@ -57,7 +57,7 @@ class InputMeshTri : protected Input
 
     void meshtrifile(const char *filename,class TriMesh *mesh,bool verbose,
                      const int size_exclusion_list, int *exclusion_list,
-                     class Region *region);
+                     class Region *region, class TriMeshSimplify *simplify = NULL);
 
   private:
 
@@ -66,6 +66,9 @@ class InputMeshTri : protected Input
     int size_exclusion_list_;
     int *exclusion_list_;
 
+    // if set, triangles are collected and simplified before insertion
+    class TriMeshSimplify *simplify_;
+
     void meshtrifile_vtk(class TriMesh *mesh,class Region *region);
     void meshtrifile_stl(class TriMesh *mesh,class Region *region, const char * filename);
     void meshtrifile_stl_binary(class TriMesh *, class Region *region, const char * filename);
@@ -186,6 +186,8 @@ void *lammps_extract_global(void *ptr, const char *name)
   if (strcmp(name,"mylocx") == 0) return (void *) &lmp->comm->myloc[0];
   if (strcmp(name,"mylocy") == 0) return (void *) &lmp->comm->myloc[1];
   if (strcmp(name,"mylocz") == 0) return (void *) &lmp->comm->myloc[2];
+  if (strcmp(name,"me") == 0) return (void *) &lmp->comm->me;
+  if (strcmp(name,"nprocs") == 0) return (void *) &lmp->comm->nprocs;
   if (strcmp(name,"natoms") == 0) return (void *) &lmp->atom->natoms;
   if (strcmp(name,"nlocal") == 0) return (void *) &lmp->atom->nlocal;
   if (strcmp(name,"nghost") == 0) return (void *) &lmp->atom->nghost;
@@ -358,6 +360,26 @@ void *lammps_extract_fix(void *ptr, const char *id, int style, int type,
   return NULL;
 }
 
+/* ----------------------------------------------------------------------
+   return the # of columns of the per-atom data of fix id
+   returns 0 if the fix stores a per-atom vector
+   returns -1 if the fix does not exist or stores no per-atom data
+   together with lammps_extract_fix(ptr,id,1,type,0,0) and the "nlocal"
+     global, this allows a caller to wrap the per-atom data without copy
+------------------------------------------------------------------------- */
+
+int lammps_extract_fix_peratom_cols(void *ptr, const char *id)
+{
+  LAMMPS *lmp = (LAMMPS *) ptr;
+
+  int ifix = lmp->modify->find_fix(id);
+  if (ifix < 0) return -1;
+  Fix *fix = lmp->modify->fix[ifix];
+
+  if (!fix->peratom_flag) return -1;
+  return fix->size_peratom_cols;
+}
+
 /* ----------------------------------------------------------------------
    extract a pointer to an internal LAMMPS evaluated variable
    name = variable name, must be equal-style or atom-style variable
@@ -423,6 +445,124 @@ int lammps_get_natoms(void *ptr)
   return natoms;
 }
 
+/* ----------------------------------------------------------------------
+   gather count values per local atom to proc 0, placed by atom ID
+   each proc packs (tag, values) of its nlocal atoms contiguously
+   proc 0 receives them via MPI_Gatherv and scatters them into data
+   memory and traffic scale with count*natoms on proc 0 only,
+     all other procs only hold count*nlocal values
+------------------------------------------------------------------------- */
+
+template<typename T>
+static void gather_atoms_to_root(LAMMPS *lmp, void *vptr, int count,
+                                 MPI_Datatype datatype, T *data)
+{
+  int i,j,m,iproc;
+  int me = lmp->comm->me;
+  int nprocs = lmp->comm->nprocs;
+  int nlocal = lmp->atom->nlocal;
+  int *tag = lmp->atom->tag;
+
+  T *vector = NULL;
+  T **array = NULL;
+  if (count == 1) vector = (T *) vptr;
+  else array = (T **) vptr;
+
+  // sendbuf = values of owned atoms, sendtag = their atom IDs
+
+  T *sendbuf;
+  lmp->memory->create(sendbuf,count*nlocal+1,"lib/gather:sendbuf");
+  m = 0;
+  if (count == 1)
+    for (i = 0; i < nlocal; i++) sendbuf[m++] = vector[i];
+  else
+    for (i = 0; i < nlocal; i++)
+      for (j = 0; j < count; j++) sendbuf[m++] = array[i][j];
+
+  int *recvcounts = NULL, *displs = NULL;
+  int *recvtag = NULL;
+  T *recvbuf = NULL;
+  int ntotal = 0;
+
+  if (me == 0) {
+    lmp->memory->create(recvcounts,nprocs,"lib/gather:recvcounts");
+    lmp->memory->create(displs,nprocs,"lib/gather:displs");
+  }
+  MPI_Gather(&nlocal,1,MPI_INT,recvcounts,1,MPI_INT,0,lmp->world);
+
+  // first gather atom IDs, then values with count-scaled counts/displs
+
+  if (me == 0) {
+    for (iproc = 0; iproc < nprocs; iproc++) {
+      displs[iproc] = ntotal;
+      ntotal += recvcounts[iproc];
+    }
+    lmp->memory->create(recvtag,ntotal+1,"lib/gather:recvtag");
+    lmp->memory->create(recvbuf,count*ntotal+1,"lib/gather:recvbuf");
+  }
+  MPI_Gatherv(tag,nlocal,MPI_INT,recvtag,recvcounts,displs,MPI_INT,
+              0,lmp->world);
+
+  if (me == 0)
+    for (iproc = 0; iproc < nprocs; iproc++) {
+      recvcounts[iproc] *= count;
+      displs[iproc] *= count;
+    }
+  MPI_Gatherv(sendbuf,count*nlocal,datatype,recvbuf,recvcounts,displs,
+              datatype,0,lmp->world);
+
+  if (me == 0) {
+    for (i = 0; i < ntotal; i++) {
+      T *dst = &data[count*(recvtag[i]-1)];
+      T *src = &recvbuf[count*i];
+      for (j = 0; j < count; j++) dst[j] = src[j];
+    }
+    lmp->memory->destroy(recvcounts);
+    lmp->memory->destroy(displs);
+    lmp->memory->destroy(recvtag);
+    lmp->memory->destroy(recvbuf);
+  }
+
+  lmp->memory->destroy(sendbuf);
+}
+
+/* ----------------------------------------------------------------------
+   gather the named atom-based entity to proc 0
+   name = desired quantity, e.g. x or charge
+   type = 0 for integer values, 1 for double values
+   count = # of per-atom values, e.g. 1 for type or charge, 3 for x or f
+   return atom-based values in data on proc 0 only,
+     ordered by count, then by atom ID
+     e.g. x[0][0],x[0][1],x[0][2],x[1][0],x[1][1],x[1][2],x[2][0],...
+   data must be pre-allocated by caller to correct length on proc 0,
+     it is not accessed on other procs and may be NULL there
+   must be called by all procs
+------------------------------------------------------------------------- */
+
+void lammps_gather_atoms_root(void *ptr, const char *name,
+                              int type, int count, void *data)
+{
+  LAMMPS *lmp = (LAMMPS *) ptr;
+
+  // error if tags are not defined or not consecutive
+
+  int flag = 0;
+  if (lmp->atom->tag_enable == 0 || lmp->atom->tag_consecutive() == 0) flag = 1;
+  if (lmp->atom->natoms > MAXSMALLINT) flag = 1;
+  if (flag) {
+    if (lmp->comm->me == 0)
+      lmp->error->warning(FLERR,"Library error in lammps_gather_atoms_root");
+    return;
+  }
+
+  void *vptr = lmp->atom->extract(name);
+
+  if (type == 0)
+    gather_atoms_to_root<int>(lmp,vptr,count,MPI_INT,(int *) data);
+  else
+    gather_atoms_to_root<double>(lmp,vptr,count,MPI_DOUBLE,(double *) data);
+}
+
 /* ----------------------------------------------------------------------
    gather the named atom-based entity across all processors
    name = desired quantity, e.g. x or charge
@@ -431,6 +571,8 @@ int lammps_get_natoms(void *ptr)
    return atom-based values in data, ordered by count, then by atom ID
      e.g. x[0][0],x[0][1],x[0][2],x[1][0],x[1][1],x[1][2],x[2][0],...
    data must be pre-allocated by caller to correct length
+   gathers to proc 0 and broadcasts, use lammps_gather_atoms_root()
+     if only proc 0 needs the data
 ------------------------------------------------------------------------- */
 
 void lammps_gather_atoms(void *ptr, const char *name,
@@ -443,72 +585,21 @@ void lammps_gather_atoms(void *ptr, const char *name,
   int flag = 0;
   if (lmp->atom->tag_enable == 0 || lmp->atom->tag_consecutive() == 0) flag = 1;
   if (lmp->atom->natoms > MAXSMALLINT) flag = 1;
-  if (flag && lmp->comm->me == 0) {
-    lmp->error->warning(FLERR,"Library error in lammps_gather_atoms");
+  if (flag) {
+    if (lmp->comm->me == 0)
+      lmp->error->warning(FLERR,"Library error in lammps_gather_atoms");
     return;
   }
 
   int natoms = static_cast<int> (lmp->atom->natoms);
-
-  int i,j,offset;
   void *vptr = lmp->atom->extract(name);
 
-  // copy = Natom length vector of per-atom values
-  // use atom ID to insert each atom's values into copy
-  // MPI_Allreduce with MPI_SUM to merge into data, ordered by atom ID
-
   if (type == 0) {
-    int *vector = NULL;
-    int **array = NULL;
-    if (count == 1) vector = (int *) vptr;
-    else array = (int **) vptr;
-
-    int *copy;
-    lmp->memory->create(copy,count*natoms,"lib/gather:copy");
-    for (i = 0; i < count*natoms; i++) copy[i] = 0;
-
-    int *tag = lmp->atom->tag;
-    int nlocal = lmp->atom->nlocal;
-
-    if (count == 1)
-      for (i = 0; i < nlocal; i++)
-        copy[tag[i]-1] = vector[i];
-    else
-      for (i = 0; i < nlocal; i++) {
-        offset = count*(tag[i]-1);
-        for (j = 0; j < count; j++)
-          copy[offset++] = array[i][0];
-      }
-
-    MPI_Allreduce(copy,data,count*natoms,MPI_INT,MPI_SUM,lmp->world);
-    lmp->memory->destroy(copy);
-
+    gather_atoms_to_root<int>(lmp,vptr,count,MPI_INT,(int *) data);
+    MPI_Bcast(data,count*natoms,MPI_INT,0,lmp->world);
   } else {
-    double *vector = NULL;
-    double **array = NULL;
-    if (count == 1) vector = (double *) vptr;
-    else array = (double **) vptr;
-
-    double *copy;
-    lmp->memory->create(copy,count*natoms,"lib/gather:copy");
-    for (i = 0; i < count*natoms; i++) copy[i] = 0.0;
-
-    int *tag = lmp->atom->tag;
-    int nlocal = lmp->atom->nlocal;
-
-    if (count == 1) {
-      for (i = 0; i < nlocal; i++)
-        copy[tag[i]-1] = vector[i];
-    } else {
-      for (i = 0; i < nlocal; i++) {
-        offset = count*(tag[i]-1);
-        for (j = 0; j < count; j++)
-          copy[offset++] = array[i][j];
-      }
-    }
-
-    MPI_Allreduce(copy,data,count*natoms,MPI_DOUBLE,MPI_SUM,lmp->world);
-    lmp->memory->destroy(copy);
+    gather_atoms_to_root<double>(lmp,vptr,count,MPI_DOUBLE,(double *) data);
+    MPI_Bcast(data,count*natoms,MPI_DOUBLE,0,lmp->world);
   }
 }
 
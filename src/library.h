@@ -68,9 +68,11 @@ void *lammps_extract_atom(void *, const char *);
 void *lammps_extract_compute(void *, const char *, int, int);
 void *lammps_extract_fix(void *, const char *, int, int, int, int);
 void *lammps_extract_variable(void *, char *, char *);
+int lammps_extract_fix_peratom_cols(void *, const char *);
 
 int lammps_get_natoms(void *);
 void lammps_gather_atoms(void *, const char *, int, int, void *);
+void lammps_gather_atoms_root(void *, const char *, int, int, void *);
 void lammps_scatter_atoms(void *, const char *, int, int, void *);
 
 #ifdef __cplusplus
@@ -84,6 +86,11 @@ W: Library error in lammps_gather_atoms
 This library function cannot be used if atom IDs are not defined
 or are not consecutively numbered.
 
+W: Library error in lammps_gather_atoms_root
+
+This library function cannot be used if atom IDs are not defined
+or are not consecutively numbered.
+
 W: Library error in lammps_scatter_atoms
 
 This library function cannot be used if atom IDs are not defined or
@@ -348,9 +348,9 @@ void Modify::setup(int vflag)
 void Modify::setup_pre_exchange()
 {
   if (update->whichflag <= 1)
-    call_method_on_fixes(&Fix::setup_pre_exchange, list_pre_exchange, n_pre_exchange);
+    call_method_on_fixes(&Fix::setup_pre_exchange, list_pre_exchange, n_pre_exchange, FIX_TIME_PRE_EXCHANGE);
   else if (update->whichflag == 2)
-    call_method_on_fixes(&Fix::min_setup_pre_exchange, list_min_pre_exchange, n_min_pre_exchange);
+    call_method_on_fixes(&Fix::min_setup_pre_exchange, list_min_pre_exchange, n_min_pre_exchange, FIX_TIME_PRE_EXCHANGE);
 }
 
 /* ----------------------------------------------------------------------
@@ -361,9 +361,9 @@ void Modify::setup_pre_exchange()
 void Modify::setup_pre_neighbor()
 {
   if (update->whichflag == 1)
-    call_method_on_fixes(&Fix::setup_pre_neighbor, list_pre_neighbor, n_pre_neighbor);
+    call_method_on_fixes(&Fix::setup_pre_neighbor, list_pre_neighbor, n_pre_neighbor, FIX_TIME_PRE_NEIGHBOR);
   else if (update->whichflag == 2)
-    call_method_on_fixes(&Fix::min_setup_pre_neighbor, list_min_pre_neighbor, n_min_pre_neighbor);
+    call_method_on_fixes(&Fix::min_setup_pre_neighbor, list_min_pre_neighbor, n_min_pre_neighbor, FIX_TIME_PRE_NEIGHBOR);
 }
 
 /* ----------------------------------------------------------------------
@@ -374,9 +374,9 @@ void Modify::setup_pre_neighbor()
 void Modify::setup_pre_force(int vflag)
 {
   if (update->whichflag == 1) {
-    call_method_on_fixes(&Fix::setup_pre_force, vflag, list_pre_force, n_pre_force);
+    call_method_on_fixes(&Fix::setup_pre_force, vflag, list_pre_force, n_pre_force, FIX_TIME_PRE_FORCE);
   } else if (update->whichflag == 2) {
-    call_method_on_fixes(&Fix::min_setup_pre_force, vflag, list_min_pre_force, n_min_pre_force);
+    call_method_on_fixes(&Fix::min_setup_pre_force, vflag, list_min_pre_force, n_min_pre_force, FIX_TIME_PRE_FORCE);
   }
 }
 
@@ -386,7 +386,7 @@ void Modify::setup_pre_force(int vflag)
 
 void Modify::pre_initial_integrate()
 {
-  call_method_on_fixes(&Fix::pre_initial_integrate, list_pre_initial_integrate, n_pre_initial_integrate);
+  call_method_on_fixes(&Fix::pre_initial_integrate, list_pre_initial_integrate, n_pre_initial_integrate, FIX_TIME_INTEGRATE);
 }
 
 /* ----------------------------------------------------------------------
@@ -396,7 +396,7 @@ void Modify::pre_initial_integrate()
 void Modify::initial_integrate(int vflag)
 {
   
-  call_method_on_fixes(&Fix::initial_integrate, vflag, list_initial_integrate, n_initial_integrate);
+  call_method_on_fixes(&Fix::initial_integrate, vflag, list_initial_integrate, n_initial_integrate, FIX_TIME_INTEGRATE);
 }
 
 /* ----------------------------------------------------------------------
@@ -405,7 +405,7 @@ void Modify::initial_integrate(int vflag)
 
 void Modify::post_integrate()
 {
-  call_method_on_fixes(&Fix::post_integrate, list_post_integrate, n_post_integrate);
+  call_method_on_fixes(&Fix::post_integrate, list_post_integrate, n_post_integrate, FIX_TIME_INTEGRATE);
 }
 
 /* ----------------------------------------------------------------------
@@ -415,7 +415,7 @@ void Modify::post_integrate()
 void Modify::pre_exchange()
 {
   
-  call_method_on_fixes(&Fix::pre_exchange, list_pre_exchange, n_pre_exchange);
+  call_method_on_fixes(&Fix::pre_exchange, list_pre_exchange, n_pre_exchange, FIX_TIME_PRE_EXCHANGE);
 }
 
 /* ----------------------------------------------------------------------
@@ -425,7 +425,7 @@ void Modify::pre_exchange()
 void Modify::pre_neighbor()
 {
   
-  call_method_on_fixes(&Fix::pre_neighbor, list_pre_neighbor, n_pre_neighbor);
+  call_method_on_fixes(&Fix::pre_neighbor, list_pre_neighbor, n_pre_neighbor, FIX_TIME_PRE_NEIGHBOR);
 }
 
 /* ----------------------------------------------------------------------
@@ -435,7 +435,7 @@ void Modify::pre_neighbor()
 void Modify::pre_force(int vflag)
 {
   
-  call_method_on_fixes(&Fix::pre_force, vflag, list_pre_force, n_pre_force);
+  call_method_on_fixes(&Fix::pre_force, vflag, list_pre_force, n_pre_force, FIX_TIME_PRE_FORCE);
 }
 
 /* ----------------------------------------------------------------------
@@ -445,7 +445,7 @@ void Modify::pre_force(int vflag)
 void Modify::post_force(int vflag)
 {
   
-  call_method_on_fixes(&Fix::post_force, vflag, list_post_force, n_post_force);
+  call_method_on_fixes(&Fix::post_force, vflag, list_post_force, n_post_force, FIX_TIME_POST_FORCE);
 }
 
 /* ----------------------------------------------------------------------
@@ -467,7 +467,7 @@ bool Modify::iterate_implicitly()
 
 void Modify::pre_final_integrate()
 {
-  call_method_on_fixes(&Fix::pre_final_integrate, list_pre_final_integrate, n_pre_final_integrate);
+  call_method_on_fixes(&Fix::pre_final_integrate, list_pre_final_integrate, n_pre_final_integrate, FIX_TIME_INTEGRATE);
 }
 
 /* ----------------------------------------------------------------------
@@ -476,7 +476,7 @@ void Modify::pre_final_integrate()
 
 void Modify::final_integrate()
 {
-  call_method_on_fixes(&Fix::final_integrate, list_final_integrate, n_final_integrate);
+  call_method_on_fixes(&Fix::final_integrate, list_final_integrate, n_final_integrate, FIX_TIME_INTEGRATE);
 }
 
 /* ----------------------------------------------------------------------
@@ -492,7 +492,7 @@ void Modify::end_of_step()
         const int ifix = list_end_of_step[i];
         fix[ifix]->begin_time_recording();
         fix[ifix]->end_of_step();
-        fix[ifix]->end_time_recording();
+        fix[ifix]->end_time_recording(FIX_TIME_END_OF_STEP);
       }
     }
   }
@@ -548,7 +548,7 @@ void Modify::post_run()
 void Modify::setup_pre_force_respa(int vflag, int ilevel)
 {
   call_respa_method_on_fixes(&Fix::setup_pre_force_respa, vflag, ilevel,
-      list_pre_force_respa, n_pre_force_respa);
+      list_pre_force_respa, n_pre_force_respa, FIX_TIME_PRE_FORCE);
 }
 
 /* ----------------------------------------------------------------------
@@ -558,7 +558,7 @@ void Modify::setup_pre_force_respa(int vflag, int ilevel)
 void Modify::initial_integrate_respa(int vflag, int ilevel, int iloop)
 {
   call_respa_method_on_fixes(&Fix::initial_integrate_respa, vflag, ilevel, iloop,
-      list_initial_integrate_respa, n_initial_integrate_respa);
+      list_initial_integrate_respa, n_initial_integrate_respa, FIX_TIME_INTEGRATE);
 }
 
 /* ----------------------------------------------------------------------
@@ -568,7 +568,7 @@ void Modify::initial_integrate_respa(int vflag, int ilevel, int iloop)
 void Modify::post_integrate_respa(int ilevel, int iloop)
 {
   call_respa_method_on_fixes(&Fix::post_integrate_respa, ilevel, iloop,
-      list_post_integrate_respa, n_post_integrate_respa);
+      list_post_integrate_respa, n_post_integrate_respa, FIX_TIME_INTEGRATE);
 }
 
 /* ----------------------------------------------------------------------
@@ -578,7 +578,7 @@ void Modify::post_integrate_respa(int ilevel, int iloop)
 void Modify::pre_force_respa(int vflag, int ilevel, int iloop)
 {
   call_respa_method_on_fixes(&Fix::pre_force_respa, vflag, ilevel, iloop,
-      list_pre_force_respa, n_pre_force_respa);
+      list_pre_force_respa, n_pre_force_respa, FIX_TIME_PRE_FORCE);
 }
 
 /* ----------------------------------------------------------------------
@@ -588,7 +588,7 @@ void Modify::pre_force_respa(int vflag, int ilevel, int iloop)
 void Modify::post_force_respa(int vflag, int ilevel, int iloop)
 {
   call_respa_method_on_fixes(&Fix::post_force_respa, vflag, ilevel, iloop,
-      list_post_force_respa, n_post_force_respa);
+      list_post_force_respa, n_post_force_respa, FIX_TIME_POST_FORCE);
 }
 
 /* ----------------------------------------------------------------------
@@ -598,7 +598,7 @@ void Modify::post_force_respa(int vflag, int ilevel, int iloop)
 void Modify::final_integrate_respa(int ilevel, int iloop)
 {
   call_respa_method_on_fixes(&Fix::final_integrate_respa, ilevel, iloop,
-      list_final_integrate_respa, n_final_integrate_respa);
+      list_final_integrate_respa, n_final_integrate_respa, FIX_TIME_INTEGRATE);
 }
 
 /* ----------------------------------------------------------------------
@@ -607,7 +607,7 @@ void Modify::final_integrate_respa(int ilevel, int iloop)
 
 void Modify::min_pre_exchange()
 {
-  call_method_on_fixes(&Fix::min_pre_exchange, list_min_pre_exchange, n_min_pre_exchange);
+  call_method_on_fixes(&Fix::min_pre_exchange, list_min_pre_exchange, n_min_pre_exchange, FIX_TIME_PRE_EXCHANGE);
 }
 
 /* ----------------------------------------------------------------------
@@ -626,7 +626,7 @@ void Modify::min_pre_neighbor()
 
 void Modify::min_pre_force(int vflag)
 {
-  call_method_on_fixes(&Fix::min_pre_force, vflag, list_min_pre_force, n_min_pre_force);
+  call_method_on_fixes(&Fix::min_pre_force, vflag, list_min_pre_force, n_min_pre_force, FIX_TIME_PRE_FORCE);
 }
 
 /* ----------------------------------------------------------------------
@@ -635,7 +635,7 @@ void Modify::min_pre_force(int vflag)
 
 void Modify::min_post_force(int vflag)
 {
-  call_method_on_fixes(&Fix::min_post_force, vflag, list_min_post_force, n_min_post_force);
+  call_method_on_fixes(&Fix::min_post_force, vflag, list_min_post_force, n_min_post_force, FIX_TIME_POST_FORCE);
 }
 
 /* ----------------------------------------------------------------------
@@ -1441,6 +1441,18 @@ bigint Modify::memory_usage()
   return bytes;
 }
 
+/* ----------------------------------------------------------------------
+   name of a timestep stage for which fix timings are recorded
+------------------------------------------------------------------------- */
+
+const char *Modify::time_stage_name(int stage) const
+{
+  static const char *names[FIX_TIME_N] =
+    {"integrate","pre_exchange","pre_neighbor","pre_force",
+     "post_force","end_of_step","other"};
+  return names[stage];
+}
+
 /* ======================================================================
    helper functions by Richard Berger (JKU)
 ========================================================================= */
@@ -1449,12 +1461,12 @@ bigint Modify::memory_usage()
    calls a member method on all fixes
 ------------------------------------------------------------------------- */
 
-void Modify::call_method_on_fixes(FixMethod method) {
+void Modify::call_method_on_fixes(FixMethod method, int stage) {
   if(timing) {
     for (int i = 0; i < nfix; i++) {
       fix[i]->begin_time_recording();
       (fix[i]->*method)();
-      fix[i]->end_time_recording();
+      fix[i]->end_time_recording(stage);
     }
   }
   else
@@ -1469,13 +1481,13 @@ void Modify::call_method_on_fixes(FixMethod method) {
    calls a member method on all fixes in the specified list
 ------------------------------------------------------------------------- */
 
-void Modify::call_method_on_fixes(FixMethod method, int *& ilist, int & inum) {
+void Modify::call_method_on_fixes(FixMethod method, int *& ilist, int & inum, int stage) {
   if(timing) {
     for (int i = 0; i < inum; i++) {
       const int ifix = ilist[i];
       fix[ifix]->begin_time_recording();
       (fix[ifix]->*method)();
-      fix[ifix]->end_time_recording();
+      fix[ifix]->end_time_recording(stage);
     }
   }
   else
@@ -1490,12 +1502,12 @@ void Modify::call_method_on_fixes(FixMethod method, int *& ilist, int & inum) {
    calls a member method with vflag parameter on all fixes
 ------------------------------------------------------------------------- */
 
-void Modify::call_method_on_fixes(FixMethodWithVFlag method, int vflag) {
+void Modify::call_method_on_fixes(FixMethodWithVFlag method, int vflag, int stage) {
   if(timing) {
     for (int i = 0; i < nfix; i++) {
       fix[i]->begin_time_recording();
       (fix[i]->*method)(vflag);
-      fix[i]->end_time_recording();
+      fix[i]->end_time_recording(stage);
     }
   }
   else
@@ -1511,13 +1523,13 @@ void Modify::call_method_on_fixes(FixMethodWithVFlag method, int vflag) {
    specified list
 ------------------------------------------------------------------------- */
 
-void Modify::call_method_on_fixes(FixMethodWithVFlag method, int vflag, int *& ilist, int & inum) {
+void Modify::call_method_on_fixes(FixMethodWithVFlag method, int vflag, int *& ilist, int & inum, int stage) {
   if(timing) {
     for (int i = 0; i < inum; i++) {
       const int ifix = ilist[i];
       fix[ifix]->begin_time_recording();
       (fix[ifix]->*method)(vflag);
-      fix[ifix]->end_time_recording();
+      fix[ifix]->end_time_recording(stage);
     }
   }
   else
@@ -1534,13 +1546,13 @@ void Modify::call_method_on_fixes(FixMethodWithVFlag method, int vflag, int *& i
 ------------------------------------------------------------------------- */
 
 void Modify::call_respa_method_on_fixes(FixMethodRESPA2 method,
-    int arg1, int arg2, int *& ilist, int & inum) {
+    int arg1, int arg2, int *& ilist, int & inum, int stage) {
   if(timing) {
     for (int i = 0; i < inum; i++) {
       const int ifix = ilist[i];
       fix[ifix]->begin_time_recording();
       (fix[ifix]->*method)(arg1, arg2);
-      fix[ifix]->end_time_recording();
+      fix[ifix]->end_time_recording(stage);
     }
   }
   else
@@ -1557,13 +1569,13 @@ void Modify::call_respa_method_on_fixes(FixMethodRESPA2 method,
 ------------------------------------------------------------------------- */
 
 void Modify::call_respa_method_on_fixes(FixMethodRESPA3 method, int arg1,
-    int arg2, int arg3, int *& ilist, int & inum) {
+    int arg2, int arg3, int *& ilist, int & inum, int stage) {
   if(timing) {
     for (int i = 0; i < inum; i++) {
       const int ifix = ilist[i];
       fix[ifix]->begin_time_recording();
       (fix[ifix]->*method)(arg1, arg2, arg3);
-      fix[ifix]->end_time_recording();
+      fix[ifix]->end_time_recording(stage);
     }
   }
   else
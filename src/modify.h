@@ -174,6 +174,7 @@ class Modify : protected Pointers {
   void restart_deallocate();
 
   bigint memory_usage();
+  const char *time_stage_name(int) const;
 
   int fix_restart_in_progress();
   bool have_restart_data(Fix *f);
@@ -225,13 +226,13 @@ class Modify : protected Pointers {
   void list_init_compute();
 
 private:
-  inline void call_method_on_fixes(FixMethod method);
-  inline void call_method_on_fixes(FixMethod method, int *& ilist, int & inum);
-  inline void call_method_on_fixes(FixMethodWithVFlag method, int vflag);
-  inline void call_method_on_fixes(FixMethodWithVFlag method, int vflag, int *& ilist, int & inum);
+  inline void call_method_on_fixes(FixMethod method, int stage = FIX_TIME_OTHER);
+  inline void call_method_on_fixes(FixMethod method, int *& ilist, int & inum, int stage = FIX_TIME_OTHER);
+  inline void call_method_on_fixes(FixMethodWithVFlag method, int vflag, int stage = FIX_TIME_OTHER);
+  inline void call_method_on_fixes(FixMethodWithVFlag method, int vflag, int *& ilist, int & inum, int stage = FIX_TIME_OTHER);
 
-  inline void call_respa_method_on_fixes(FixMethodRESPA2 method, int arg1, int arg2, int *& ilist, int & inum);
-  inline void call_respa_method_on_fixes(FixMethodRESPA3 method, int arg1, int arg2, int arg3, int *& ilist, int & inum);
+  inline void call_respa_method_on_fixes(FixMethodRESPA2 method, int arg1, int arg2, int *& ilist, int & inum, int stage);
+  inline void call_respa_method_on_fixes(FixMethodRESPA3 method, int arg1, int arg2, int arg3, int *& ilist, int & inum, int stage);
 
   typedef Compute *(*ComputeCreator)(LAMMPS *, int, int, char **);
   std::map<std::string,ComputeCreator> *compute_map;
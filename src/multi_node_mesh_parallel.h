@@ -66,6 +66,8 @@ namespace LAMMPS_NS
 
         void initialSetup();
         void pbcExchangeBorders(int setupFlag);
+        bool pbcExchangeBordersBegin(int setupFlag);
+        void pbcExchangeBordersEnd(int setupFlag);
         void clearReverse();
         void forwardComm(std::string property);
         void forwardComm(std::list<std::string> * properties = NULL);
@@ -147,10 +149,12 @@ namespace LAMMPS_NS
 
         // parallelization functions
 
+        bool pbcExchangeSetup(int setupFlag);
         void setup();
         void deleteUnowned();
         void pbc();
-        void exchange();
+        void exchangeBegin();
+        void exchangeEnd();
         void borders();
         void clearGhosts();
 
@@ -161,6 +165,9 @@ namespace LAMMPS_NS
         // lo-level parallelization
         int pushExchange(int dim);
         void popExchange(int nrecv,int dim,double *buf);
+        void postExchange(int dim);
+        int completeExchange(int dim,double *&buf);
+        int findBorderElements(int iswap,int ineed,int dim,int nfirst,int nlast);
 
         int sizeRestartMesh();
         int sizeRestartElement();
@@ -206,6 +213,16 @@ namespace LAMMPS_NS
 
         int maxforward_,maxreverse_; // max # of datums in forward/reverse comm
 
+        // non-blocking exchange
+        // own communicator, so exchanges of several meshes may be in flight
+        // at the same time without their messages matching each other
+        MPI_Comm world_mesh_;
+        int nsend_exchange_;                // # of datums sent in current exchange
+        int nrecv_exchange_[2];             // # of datums recv from both neighbors
+        int nrequest_exchange_;             // # of pending requests
+        MPI_Request request_exchange_[6];   // pending count and data requests
+        MPI_Status status_exchange_[6];
+
         // comm swaps
         
         int nswap_;                  // # of swaps to perform = sum of maxneed
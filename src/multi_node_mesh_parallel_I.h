@@ -47,6 +47,11 @@
 #define BUFMIN_MNMP 2000
 #define BUFEXTRA_MNMP 2000
 
+#define TAG_EXCHANGE_LEFT_MNMP 11
+#define TAG_EXCHANGE_RIGHT_MNMP 12
+#define TAG_BORDERS_LEFT_MNMP 13
+#define TAG_BORDERS_RIGHT_MNMP 14
+
   /* ----------------------------------------------------------------------
    consturctors
   ------------------------------------------------------------------------- */
@@ -65,6 +70,8 @@
     size_forward_(0),
     size_border_(0),
     maxforward_(0),maxreverse_(0),
+    nsend_exchange_(0),
+    nrequest_exchange_(0),
     nswap_(0),
     maxswap_(0),
     sendnum_(0),recvnum_(0),
@@ -79,6 +86,11 @@
     pbc_flag_(0),
     pbc_(0)
   {
+      // mesh messages use their own communicator, tags are the same
+      // for every mesh
+
+      MPI_Comm_dup(this->world,&world_mesh_);
+
       // initialize comm buffers & exchange memory
       
       maxsend_ = BUFMIN_MNMP;
@@ -121,6 +133,8 @@
 
       this->memory->destroy(buf_send_);
       this->memory->destroy(buf_recv_);
+
+      MPI_Comm_free(&world_mesh_);
   }
 
   /* ----------------------------------------------------------------------
@@ -651,23 +665,38 @@
   template<int NUM_NODES>
   void MultiNodeMeshParallel<NUM_NODES>::pbcExchangeBorders(int setupFlag)
   {
-      // need not do this during simulation for non-moving mesh and non-changing simulation box
-      
-      if(setupFlag) this->reset_stepLastReset();
+      if(pbcExchangeSetup(setupFlag))
+          pbcExchangeBordersEnd(setupFlag);
+  }
 
-      // perform operations that should be done before setting up parallellism and exchanging elements
-      preSetup();
+  /* ----------------------------------------------------------------------
+   parallelization - start pbc and exchange without waiting for messages
+   so other work can be done while the elements are in flight
+   returns false if nothing has been started, pbcExchangeBorders()
+   has to be used in this case
+  ------------------------------------------------------------------------- */
 
-      if(!setupFlag && !this->isMoving() && !this->isDeforming() && !this->domain->box_change) return;
+  template<int NUM_NODES>
+  bool MultiNodeMeshParallel<NUM_NODES>::pbcExchangeBordersBegin(int setupFlag)
+  {
+      // insertion meshes are used by fix insert/* in pre_exchange()
+      // so they have to be complete at that point
 
-      // set-up mesh parallelism
-      setup();
+      if(!doParallellization_ || isInsertionMesh_)
+        return false;
 
-      // enforce pbc
-      pbc();
+      return pbcExchangeSetup(setupFlag);
+  }
+
+  /* ----------------------------------------------------------------------
+   parallelization - complete exchange, then borders
+  ------------------------------------------------------------------------- */
 
-      // communicate particles
-      exchange();
+  template<int NUM_NODES>
+  void MultiNodeMeshParallel<NUM_NODES>::pbcExchangeBordersEnd(int setupFlag)
+  {
+      // complete communication of elements
+      exchangeEnd();
 
       if(sizeGlobal() != sizeGlobalOrig())
       {
@@ -697,6 +726,35 @@
 
   }
 
+  /* ----------------------------------------------------------------------
+   parallelization - set-up, pbc and start of exchange
+   returns false if nothing needs to be done
+  ------------------------------------------------------------------------- */
+
+  template<int NUM_NODES>
+  bool MultiNodeMeshParallel<NUM_NODES>::pbcExchangeSetup(int setupFlag)
+  {
+      // need not do this during simulation for non-moving mesh and non-changing simulation box
+      
+      if(setupFlag) this->reset_stepLastReset();
+
+      // perform operations that should be done before setting up parallellism and exchanging elements
+      preSetup();
+
+      if(!setupFlag && !this->isMoving() && !this->isDeforming() && !this->domain->box_change) return false;
+
+      // set-up mesh parallelism
+      setup();
+
+      // enforce pbc
+      pbc();
+
+      // start communication of elements
+      exchangeBegin();
+
+      return true;
+  }
+
   /* ----------------------------------------------------------------------
    parallelization - clear data of reverse comm properties
   ------------------------------------------------------------------------- */
@@ -762,22 +820,17 @@
    exchange elements with nearby processors
   ------------------------------------------------------------------------- */
 
+  /* ----------------------------------------------------------------------
+   start exchange - push elements leaving in x and post sends and receives
+   the remaining dimensions depend on what arrives in x, so they are
+   handled in exchangeEnd()
+  ------------------------------------------------------------------------- */
+
   template<int NUM_NODES>
-  void MultiNodeMeshParallel<NUM_NODES>::exchange()
+  void MultiNodeMeshParallel<NUM_NODES>::exchangeBegin()
   {
       if(!doParallellization_) return;
 
-      int nrecv, nsend = 0;
-      int nrecv1,nrecv2;
-      double *buf;
-      MPI_Request request;
-      MPI_Status status;
-      MPI_Comm world = this->world;
-
-      //int nprocs = this->comm->nprocs;
-      int *procgrid = this->comm->procgrid;
-      int procneigh[3][2];
-
       // clear global->local map for owned and ghost atoms
       
       clearMap();
@@ -786,63 +839,126 @@
       
       clearGhosts();
 
-      // copy procneigh
-      for (int i = 0; i < 3; i++)
-        for( int j = 0; j < 2; j++)
-            procneigh[i][j] = this->comm->procneigh[i][j];
+      nsend_exchange_ = pushExchange(0);
+      postExchange(0);
+  }
+
+  /* ----------------------------------------------------------------------
+   complete exchange
+  ------------------------------------------------------------------------- */
+
+  template<int NUM_NODES>
+  void MultiNodeMeshParallel<NUM_NODES>::exchangeEnd()
+  {
+      if(!doParallellization_) return;
+
+      int nrecv;
+      double *buf;
 
       for (int dim = 0; dim < 3; dim++)
       {
-          // push data to buffer
+          // push data to buffer, x has been pushed in exchangeBegin()
           
-          nsend = pushExchange(dim);
-
-          // send/recv in both directions
-          // if 1 proc in dimension, no send/recv, set recv buf to send buf
-          // if 2 procs in dimension, single send/recv
-          // if more than 2 procs in dimension, send/recv to both neighbors
-
-          if (procgrid[dim] == 1)
+          if(dim > 0)
           {
-            nrecv = nsend;
-            buf = buf_send_;
+              nsend_exchange_ = pushExchange(dim);
+              postExchange(dim);
           }
-          else
-          {
-            MPI_Sendrecv(&nsend,1,MPI_INT,procneigh[dim][0],0,&nrecv1,1,MPI_INT,procneigh[dim][1],0,world,&status);
-            nrecv = nrecv1;
-
-            if (this->comm->procgrid[dim] > 2)
-            {
-                MPI_Sendrecv(&nsend,1,MPI_INT,procneigh[dim][1],0,&nrecv2,1,MPI_INT,procneigh[dim][0],0,world,&status);
-                nrecv += nrecv2;
-            }
 
-            if (nrecv > maxrecv_) grow_recv(nrecv);
-
-            MPI_Irecv(buf_recv_,nrecv1,MPI_DOUBLE,procneigh[dim][1],0,world,&request);
-            MPI_Send(buf_send_,nsend,MPI_DOUBLE,procneigh[dim][0],0,world);
-            MPI_Wait(&request,&status);
-
-            if (procgrid[dim] > 2)
-            {
-                MPI_Irecv(&buf_recv_[nrecv1],nrecv2,MPI_DOUBLE,procneigh[dim][0],0,world,&request);
-                MPI_Send(buf_send_,nsend,MPI_DOUBLE,procneigh[dim][1],0,world);
-                MPI_Wait(&request,&status);
-            }
-
-            buf = buf_recv_;
-          }
+          nrecv = completeExchange(dim,buf);
 
           // check incoming elements to see if they are in my box
           // if so, add on this proc
 
-          popExchange(nrecv,dim, buf);
+          popExchange(nrecv,dim,buf);
           
       }
 
       // re-calculate nGlobal as some element might have been lost
-     MPI_Sum_Scalar(nLocal_,nGlobal_,world);
+     MPI_Sum_Scalar(nLocal_,nGlobal_,this->world);
+  }
+
+  /* ----------------------------------------------------------------------
+   post non-blocking send/recv in both directions for exchange
+   if 1 proc in dimension, no send/recv
+   if 2 procs in dimension, single send/recv
+   if more than 2 procs in dimension, send/recv to both neighbors
+   counts and data are sent right away, only the recv of the data has to
+   wait for the counts in completeExchange()
+  ------------------------------------------------------------------------- */
+
+  template<int NUM_NODES>
+  void MultiNodeMeshParallel<NUM_NODES>::postExchange(int dim)
+  {
+      int *procgrid = this->comm->procgrid;
+      int (*procneigh)[2] = this->comm->procneigh;
+      MPI_Comm world = world_mesh_;
+
+      nrequest_exchange_ = 0;
+      nrecv_exchange_[0] = nrecv_exchange_[1] = 0;
+
+      if (procgrid[dim] == 1)
+        return;
+
+      MPI_Irecv(&nrecv_exchange_[0],1,MPI_INT,procneigh[dim][1],TAG_EXCHANGE_LEFT_MNMP,world,&request_exchange_[nrequest_exchange_++]);
+      if (procgrid[dim] > 2)
+        MPI_Irecv(&nrecv_exchange_[1],1,MPI_INT,procneigh[dim][0],TAG_EXCHANGE_RIGHT_MNMP,world,&request_exchange_[nrequest_exchange_++]);
+
+      MPI_Isend(&nsend_exchange_,1,MPI_INT,procneigh[dim][0],TAG_EXCHANGE_LEFT_MNMP,world,&request_exchange_[nrequest_exchange_++]);
+      if (procgrid[dim] > 2)
+        MPI_Isend(&nsend_exchange_,1,MPI_INT,procneigh[dim][1],TAG_EXCHANGE_RIGHT_MNMP,world,&request_exchange_[nrequest_exchange_++]);
+
+      if (nsend_exchange_)
+      {
+        MPI_Isend(buf_send_,nsend_exchange_,MPI_DOUBLE,procneigh[dim][0],TAG_EXCHANGE_LEFT_MNMP,world,&request_exchange_[nrequest_exchange_++]);
+        if (procgrid[dim] > 2)
+          MPI_Isend(buf_send_,nsend_exchange_,MPI_DOUBLE,procneigh[dim][1],TAG_EXCHANGE_RIGHT_MNMP,world,&request_exchange_[nrequest_exchange_++]);
+      }
+  }
+
+  /* ----------------------------------------------------------------------
+   wait for exchange posted in postExchange(), return # of datums recv
+  ------------------------------------------------------------------------- */
+
+  template<int NUM_NODES>
+  int MultiNodeMeshParallel<NUM_NODES>::completeExchange(int dim,double *&buf)
+  {
+      int *procgrid = this->comm->procgrid;
+      int (*procneigh)[2] = this->comm->procneigh;
+      MPI_Comm world = world_mesh_;
+
+      // if 1 proc in dimension, set recv buf to send buf
+
+      if (procgrid[dim] == 1)
+      {
+        buf = buf_send_;
+        return nsend_exchange_;
+      }
+
+      // counts are the first requests posted
+
+      const int ncount = procgrid[dim] > 2 ? 2 : 1;
+      MPI_Waitall(ncount,request_exchange_,status_exchange_);
+
+      const int nrecv1 = nrecv_exchange_[0];
+      const int nrecv = nrecv1 + nrecv_exchange_[1];
+      if (nrecv > maxrecv_) grow_recv(nrecv);
+
+      MPI_Request request[2];
+      int nrequest = 0;
+      if (nrecv1)
+        MPI_Irecv(buf_recv_,nrecv1,MPI_DOUBLE,procneigh[dim][1],TAG_EXCHANGE_LEFT_MNMP,world,&request[nrequest++]);
+      if (nrecv_exchange_[1])
+        MPI_Irecv(&buf_recv_[nrecv1],nrecv_exchange_[1],MPI_DOUBLE,procneigh[dim][0],TAG_EXCHANGE_RIGHT_MNMP,world,&request[nrequest++]);
+
+      // wait for sends so buf_send_ can be re-used
+      MPI_Waitall(nrequest_exchange_-ncount,&request_exchange_[ncount],&status_exchange_[ncount]);
+      if (nrequest)
+        MPI_Waitall(nrequest,request,status_exchange_);
+      nrequest_exchange_ = 0;
+
+      buf = buf_recv_;
+      return nrecv;
   }
 
   /* ----------------------------------------------------------------------
@@ -854,11 +970,14 @@
   {
       if(doParallellization_)
       {
-          int iswap, twoneed, nfirst, nlast, n, nsend, nrecv, smax, rmax;
-          bool sendflag, dummy = false;
-          double lo,hi;
-          MPI_Request request;
-          MPI_Status status;
+          int iswap, twoneed, nfirst, nlast, n, smax, rmax;
+          int nsend[2], nrecv[2], offset_send[2], offset_recv[2];
+          int nrequest;
+          const int tag[2] = { TAG_BORDERS_LEFT_MNMP, TAG_BORDERS_RIGHT_MNMP };
+          const int me = this->comm->me;
+          bool dummy = false;
+          MPI_Request request[4];
+          MPI_Status status[4];
 
           nfirst = 0;
           iswap = 0;
@@ -869,143 +988,89 @@
               nlast = 0;
 
               // need to go left and right in each dim
+              // both directions use the same range of elements, so the
+              // swaps of one level of need are performed at the same time
               twoneed = 2*maxneed_[dim];
-              for (int ineed = 0; ineed < twoneed; ineed++)
+              for (int ineed = 0; ineed < twoneed; ineed += 2)
               {
-                  lo = slablo_[iswap];
-                  hi = slabhi_[iswap];
+                  nfirst = nlast;
+                  nlast = sizeLocal() + sizeGhost();
 
-                  // find elements within slab boundaries lo/hi using <= and >=
-                  
-                  if (ineed % 2 == 0)
-                  {
-                      nfirst = nlast;
-                      nlast = sizeLocal() + sizeGhost();
-                  }
+                  // find send elements for both directions
 
-                  nsend = 0;
+                  for (int k = 0; k < 2; k++)
+                      nsend[k] = findBorderElements(iswap+k, ineed+k, dim, nfirst, nlast);
 
-                  // sendflag = 0 if I do not send on this swap
-                  
-                  sendflag = true;
-                  int wrap = 0;
-                  
-                  if(ineed % 2 == 0 && this->comm->myloc[dim] == 0)
-                  {
-                      if(this->domain->periodicity[dim] && !this->domain->triclinic && !dynamic_cast<DomainWedge*>(this->domain))
-                          wrap = 1;
-                      else
-                          sendflag = false;
-                  }
+                  // pack up lists of border elements
+
+                  if((nsend[0]+nsend[1])*size_border_ > maxsend_)
+                    grow_send((nsend[0]+nsend[1])*size_border_,0);
 
-                  if(ineed % 2 == 1 && this->comm->myloc[dim] == this->comm->procgrid[dim]-1)
+                  n = 0;
+                  for (int k = 0; k < 2; k++)
                   {
-                      if(this->domain->periodicity[dim] && !this->domain->triclinic && !dynamic_cast<DomainWedge*>(this->domain))
-                          wrap = -1;
-                      else
-                          sendflag = false;
+                      offset_send[k] = n;
+                      n += pushElemListToBuffer(nsend[k], sendlist_[iswap+k], sendwraplist_[iswap+k], &buf_send_[n], OPERATION_COMM_BORDERS, NULL, this->domain->boxlo, this->domain->boxhi,dummy,dummy,dummy);
                   }
 
-                  // find send elements
-                  if(sendflag)
+                  // swap elements with other procs
+                  // no MPI calls except counts if nsend/nrecv = 0
+                  // if swapping with self, simply copy, no messages
+
+                  nrequest = 0;
+                  for (int k = 0; k < 2; k++)
                   {
-                      
-                      for (int i = nfirst; i < nlast; i++)
+                      nrecv[k] = nsend[k];
+                      if (sendproc_[iswap+k] != me)
                       {
-                          int type = checkBorderElement(ineed, i, dim, lo, hi);
-                          if(type != NOT_GHOST)
-                          {
-                              if (nsend >= maxsendlist_[iswap])
-                                  grow_list(iswap,nsend);
-                              sendlist_[iswap][nsend] = i;
-                              if (wrap == 1)
-                              {
-                                  switch (dim)
-                                  {
-                                  case 0:
-                                      type = IS_GHOST_WRAP_DIM_0_POS;
-                                      break;
-                                  case 1:
-                                      type = IS_GHOST_WRAP_DIM_1_POS;
-                                      break;
-                                  case 2:
-                                      type = IS_GHOST_WRAP_DIM_2_POS;
-                                      break;
-                                  }
-                              }
-                              else if (wrap == -1)
-                              {
-                                  switch (dim)
-                                  {
-                                  case 0:
-                                      type = IS_GHOST_WRAP_DIM_0_NEG;
-                                      break;
-                                  case 1:
-                                      type = IS_GHOST_WRAP_DIM_1_NEG;
-                                      break;
-                                  case 2:
-                                      type = IS_GHOST_WRAP_DIM_2_NEG;
-                                      break;
-                                  }
-                              }
-                              sendwraplist_[iswap][nsend] = type;
-                              nsend++;
-
-                          }
+                          MPI_Irecv(&nrecv[k],1,MPI_INT,recvproc_[iswap+k],tag[k],world_mesh_,&request[nrequest++]);
+                          MPI_Isend(&nsend[k],1,MPI_INT,sendproc_[iswap+k],tag[k],world_mesh_,&request[nrequest++]);
                       }
                   }
+                  if (nrequest)
+                      MPI_Waitall(nrequest,request,status);
 
-                  // pack up list of border elements
-
-                  if(nsend*size_border_ > maxsend_)
-                    grow_send(nsend*size_border_,0);
-
-                  n = pushElemListToBuffer(nsend, sendlist_[iswap], sendwraplist_[iswap], buf_send_, OPERATION_COMM_BORDERS, NULL, this->domain->boxlo, this->domain->boxhi,dummy,dummy,dummy);
-
-                  // swap atoms with other proc
-                  // no MPI calls except SendRecv if nsend/nrecv = 0
-                  // put incoming ghosts at end of my atom arrays
-                  // if swapping with self, simply copy, no messages
-
-                  double *buf = NULL;
+                  if ((nrecv[0]+nrecv[1])*size_border_ > maxrecv_)
+                      grow_recv((nrecv[0]+nrecv[1])*size_border_);
 
-                  if (sendproc_[iswap] != this->comm->me)
+                  nrequest = 0;
+                  n = 0;
+                  for (int k = 0; k < 2; k++)
                   {
-                      MPI_Sendrecv(&nsend,1,MPI_INT,sendproc_[iswap],0,&nrecv,1,MPI_INT,recvproc_[iswap],0,this->world,&status);
-                      if (nrecv*size_border_ > maxrecv_)
-                          grow_recv(nrecv*size_border_);
-                      if (nrecv)
-                          MPI_Irecv(buf_recv_,nrecv*size_border_,MPI_DOUBLE,recvproc_[iswap],0,this->world,&request);
-
-                      if (n)
-                          MPI_Send(buf_send_,n,MPI_DOUBLE,sendproc_[iswap],0,this->world);
+                      offset_recv[k] = n;
+                      if (sendproc_[iswap+k] == me)
+                          continue;
+
+                      if (nrecv[k])
+                          MPI_Irecv(&buf_recv_[n],nrecv[k]*size_border_,MPI_DOUBLE,recvproc_[iswap+k],tag[k],world_mesh_,&request[nrequest++]);
+                      if (nsend[k])
+                          MPI_Isend(&buf_send_[offset_send[k]],nsend[k]*size_border_,MPI_DOUBLE,sendproc_[iswap+k],tag[k],world_mesh_,&request[nrequest++]);
+                      n += nrecv[k]*size_border_;
+                  }
+                  if (nrequest)
+                      MPI_Waitall(nrequest,request,status);
 
-                      if (nrecv)
-                          MPI_Wait(&request,&status);
+                  // unpack buffers in swap order
+                  // put incoming ghosts at end of my element arrays
 
-                      buf = buf_recv_;
-                  }
-                  else
+                  for (int k = 0; k < 2; k++)
                   {
-                      nrecv = nsend;
-                      buf = buf_send_;
-                  }
-
-                  // unpack buffer
+                      double *buf = sendproc_[iswap] != me ? &buf_recv_[offset_recv[k]] : &buf_send_[offset_send[k]];
 
-                  n = popElemListFromBuffer(nLocal_+nGhost_, nrecv, buf, OPERATION_COMM_BORDERS, NULL, dummy,dummy,dummy);
+                      n = popElemListFromBuffer(nLocal_+nGhost_, nrecv[k], buf, OPERATION_COMM_BORDERS, NULL, dummy,dummy,dummy);
 
-                  // set pointers & counters
+                      // set pointers & counters
 
-                  smax = MAX(smax,nsend);
-                  rmax = MAX(rmax,nrecv);
-                  sendnum_[iswap] = nsend;
-                  recvnum_[iswap] = nrecv;
-                  size_forward_recv_[iswap] = nrecv*size_forward_;
-                  size_reverse_recv_[iswap] = nsend*size_reverse_;
-                  firstrecv_[iswap] = nLocal_+nGhost_;
-                  nGhost_ += nrecv;
-                  iswap++;
+                      smax = MAX(smax,nsend[k]);
+                      rmax = MAX(rmax,nrecv[k]);
+                      sendnum_[iswap] = nsend[k];
+                      recvnum_[iswap] = nrecv[k];
+                      size_forward_recv_[iswap] = nrecv[k]*size_forward_;
+                      size_reverse_recv_[iswap] = nsend[k]*size_reverse_;
+                      firstrecv_[iswap] = nLocal_+nGhost_;
+                      nGhost_ += nrecv[k];
+                      iswap++;
+                  }
               }
           }
 
@@ -1020,6 +1085,90 @@
       this->generateMap();
   }
 
+  /* ----------------------------------------------------------------------
+   fill send list of swap iswap with elements within slab boundaries
+   returns # of elements to send
+  ------------------------------------------------------------------------- */
+
+  template<int NUM_NODES>
+  int MultiNodeMeshParallel<NUM_NODES>::findBorderElements(int iswap, int ineed, int dim, int nfirst, int nlast)
+  {
+      const double lo = slablo_[iswap];
+      const double hi = slabhi_[iswap];
+      int nsend = 0;
+
+      // sendflag = 0 if I do not send on this swap
+      
+      bool sendflag = true;
+      int wrap = 0;
+      
+      if(ineed % 2 == 0 && this->comm->myloc[dim] == 0)
+      {
+          if(this->domain->periodicity[dim] && !this->domain->triclinic && !dynamic_cast<DomainWedge*>(this->domain))
+              wrap = 1;
+          else
+              sendflag = false;
+      }
+
+      if(ineed % 2 == 1 && this->comm->myloc[dim] == this->comm->procgrid[dim]-1)
+      {
+          if(this->domain->periodicity[dim] && !this->domain->triclinic && !dynamic_cast<DomainWedge*>(this->domain))
+              wrap = -1;
+          else
+              sendflag = false;
+      }
+
+      if(!sendflag)
+          return 0;
+
+      // find elements within slab boundaries lo/hi using <= and >=
+
+      for (int i = nfirst; i < nlast; i++)
+      {
+          int type = checkBorderElement(ineed, i, dim, lo, hi);
+          if(type != NOT_GHOST)
+          {
+              if (nsend >= maxsendlist_[iswap])
+                  grow_list(iswap,nsend);
+              sendlist_[iswap][nsend] = i;
+              if (wrap == 1)
+              {
+                  switch (dim)
+                  {
+                  case 0:
+                      type = IS_GHOST_WRAP_DIM_0_POS;
+                      break;
+                  case 1:
+                      type = IS_GHOST_WRAP_DIM_1_POS;
+                      break;
+                  case 2:
+                      type = IS_GHOST_WRAP_DIM_2_POS;
+                      break;
+                  }
+              }
+              else if (wrap == -1)
+              {
+                  switch (dim)
+                  {
+                  case 0:
+                      type = IS_GHOST_WRAP_DIM_0_NEG;
+                      break;
+                  case 1:
+                      type = IS_GHOST_WRAP_DIM_1_NEG;
+                      break;
+                  case 2:
+                      type = IS_GHOST_WRAP_DIM_2_NEG;
+                      break;
+                  }
+              }
+              sendwraplist_[iswap][nsend] = type;
+              nsend++;
+          }
+      }
+
+      return nsend;
+  }
+
   /* ----------------------------------------------------------------------
    check if element qualifies as ghost
   ------------------------------------------------------------------------- */
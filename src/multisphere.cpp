@@ -61,8 +61,11 @@ Multisphere::Multisphere(LAMMPS *lmp) :
 
   nbody_(0),
   nbody_all_(0),
-  mapTagMax_(0), 
-  mapArray_(0),
+  mapTagMax_(0),
+  mapHash_(0),
+  mapHashSize_(0),
+  mapHashShift_(0),
+  mapHashCount_(0),
 
   id_ (*customValues_.addElementProperty< ScalarContainer<int> >("id_multisphere","comm_exchange_borders"/*ID does never change*/,"frame_invariant","restart_yes")),
 
@@ -111,7 +114,7 @@ Multisphere::~Multisphere()
     delete &customValues_;
 
     // deallocate map memory if exists
-    if(mapArray_) clear_map();
+    if(mapHash_) clear_map();
 }
 
 /* ----------------------------------------------------------------------
@@ -393,14 +396,16 @@ void Multisphere::id_extend_body_extend(int *body)
 }
 
 /* ----------------------------------------------------------------------
-   clear and generate a global map for global-local lookup
+   clear and generate the map for global-local lookup
+   only bodies owned by this proc are stored
 ------------------------------------------------------------------------- */
 
 void Multisphere::clear_map()
 {
     // deallocate old memory
-    memory->destroy(mapArray_);
-    mapArray_ = NULL;
+    memory->destroy(mapHash_);
+    mapHash_ = NULL;
+    mapHashSize_ = mapHashCount_ = 0;
 }
 
 void Multisphere::generate_map()
@@ -408,29 +413,116 @@ void Multisphere::generate_map()
     int idmax, idmax_all;
 
     // deallocate old memory if exists
-    if(mapArray_) clear_map();
+    if(mapHash_) clear_map();
 
     if(nbody_all_ == 0)
         return;
 
     // get max ID of all proc
+    // only needed for the global lengths returned by extract()
     idmax = id_.max();
     MPI_Max_Scalar(idmax,idmax_all,world);
     mapTagMax_ = std::max(mapTagMax_,idmax_all);
 
-    // alocate and initialize new array
-    // IDs start at 1, have to go up to (inclusive) mapTagMax_
-    
-    memory->create(mapArray_,mapTagMax_+1,"Multisphere:mapArray_");
-    for(int i = 0; i < mapTagMax_+1; i++)
-        mapArray_[i] = -1;
+    map_alloc(nbody_);
 
-    // build map
+    // build map, lowest local index wins for duplicate IDs
     for (int i = nbody_-1; i >= 0; i--)
+        map_set(id_(i),i);
+}
+
+/* ----------------------------------------------------------------------
+   allocate empty hash table for at least n bodies
+   table is kept at most half full, so probe sequences stay short
+------------------------------------------------------------------------- */
+
+void Multisphere::map_alloc(int n)
+{
+    int bits = 4;
+    while((1 << bits) < 2*n) bits++;
+
+    memory->destroy(mapHash_);
+    mapHashSize_ = 1 << bits;
+    mapHashShift_ = 32 - bits;
+    mapHashCount_ = 0;
+    memory->create(mapHash_,mapHashSize_,2,"Multisphere:mapHash_");
+    for(int h = 0; h < mapHashSize_; h++)
+        mapHash_[h][0] = mapHash_[h][1] = -1;
+}
+
+/* ----------------------------------------------------------------------
+   insert or update entry for body ID body_tag
+   bodies without ID (-1) are not stored
+   no-op if no map has been generated yet
+------------------------------------------------------------------------- */
+
+void Multisphere::map_set(int body_tag, int ilocal)
+{
+    if(!mapHash_ || body_tag < 0)
+        return;
+
+    if(2*(mapHashCount_+1) > mapHashSize_)
     {
-        
-        mapArray_[id_(i)] = i;
+        // re-hash into a larger table
+
+        int **old = mapHash_;
+        const int oldsize = mapHashSize_;
+        mapHash_ = NULL;
+        map_alloc(std::max(nbody_,2*(mapHashCount_+1)));
+        for(int h = 0; h < oldsize; h++)
+            if(old[h][0] >= 0)
+                map_set(old[h][0],old[h][1]);
+        memory->destroy(old);
+    }
+
+    const int mask = mapHashSize_-1;
+    int h = map_slot(body_tag);
+    while(mapHash_[h][0] >= 0 && mapHash_[h][0] != body_tag)
+        h = (h+1) & mask;
+
+    if(mapHash_[h][0] < 0)
+        mapHashCount_++;
+    mapHash_[h][0] = body_tag;
+    mapHash_[h][1] = ilocal;
+}
+
+/* ----------------------------------------------------------------------
+   remove entry for body ID body_tag
+   entries behind it are shifted back, so no tombstones are needed
+------------------------------------------------------------------------- */
+
+void Multisphere::map_erase(int body_tag)
+{
+    if(!mapHash_ || body_tag < 0)
+        return;
+
+    const int mask = mapHashSize_-1;
+    int h = map_slot(body_tag);
+    while(mapHash_[h][0] != body_tag)
+    {
+        if(mapHash_[h][0] < 0)
+            return;
+        h = (h+1) & mask;
+    }
+
+    // backward shift deletion for linear probing
+
+    int hole = h;
+    for(int k = (hole+1) & mask; mapHash_[k][0] >= 0; k = (k+1) & mask)
+    {
+        const int home = map_slot(mapHash_[k][0]);
+
+        // entry at k may fill the hole if its home slot is not
+        // cyclically in (hole,k]
+        if(((k-home) & mask) >= ((k-hole) & mask))
+        {
+            mapHash_[hole][0] = mapHash_[k][0];
+            mapHash_[hole][1] = mapHash_[k][1];
+            hole = k;
+        }
     }
+    mapHash_[hole][0] = mapHash_[hole][1] = -1;
+    mapHashCount_--;
 }
 
 /* ----------------------------------------------------------------------
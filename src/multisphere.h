@@ -115,14 +115,13 @@ namespace LAMMPS_NS {
       inline int tag_max_body()
       { return mapTagMax_; }
 
-      inline int map(int ibody_local)
-      { return mapArray_?mapArray_[ibody_local]:-1; }
+      inline int map(int body_tag) const;
 
       inline int tag(int ibody_local)
       { return id_(ibody_local); }
 
       inline bool has_tag(int _tag)
-      { return mapArray_[_tag] == -1 ? false : true;}
+      { return map(_tag) != -1; }
 
       inline int atomtype(int ibody_local)
       { return atomtype_(ibody_local); }
@@ -212,8 +211,19 @@ namespace LAMMPS_NS {
       int nbody_, nbody_all_;
 
       // global-local lookup
+      // open-addressing hash table over the local bodies only, so memory
+      // and setup cost do not scale with the global # of bodies
+      // mapHash_ columns: body ID (-1 if slot empty), local index
       int mapTagMax_;
-      int *mapArray_;
+      int **mapHash_;
+      int mapHashSize_;
+      int mapHashShift_;
+      int mapHashCount_;
+
+      inline int map_slot(int body_tag) const;
+      void map_set(int body_tag, int ilocal);
+      void map_erase(int body_tag);
+      void map_alloc(int n);
 
       // ID of rigid body
       
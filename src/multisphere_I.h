@@ -42,6 +42,31 @@
 #ifndef LMP_MULTISPHERE_I_H
 #define LMP_MULTISPHERE_I_H
 
+/* ----------------------------------------------------------------------
+   first slot to probe for a body ID, Fibonacci hashing
+------------------------------------------------------------------------- */
+
+inline int Multisphere::map_slot(int body_tag) const
+{
+    return static_cast<int>((static_cast<unsigned int>(body_tag)*2654435761u) >> mapHashShift_);
+}
+
+/* ----------------------------------------------------------------------
+   local index of body with ID body_tag, -1 if not owned by this proc
+------------------------------------------------------------------------- */
+
+inline int Multisphere::map(int body_tag) const
+{
+    if(!mapHash_ || body_tag < 0)
+        return -1;
+
+    const int mask = mapHashSize_-1;
+    for(int h = map_slot(body_tag); mapHash_[h][0] >= 0; h = (h+1) & mask)
+        if(mapHash_[h][0] == body_tag)
+            return mapHash_[h][1];
+    return -1;
+}
+
 /* ---------------------------------------------------------------------- */
 
 inline double Multisphere::max_r_bound()
@@ -64,7 +89,7 @@ inline void Multisphere::copy_body(int from_local, int to_local)
 
     customValues_.copyElement(from_local, to_local);
 
-    mapArray_[tag_from] = to_local;
+    map_set(tag_from,to_local);
 }
 
 /* ---------------------------------------------------------------------- */
@@ -72,11 +97,11 @@ inline void Multisphere::copy_body(int from_local, int to_local)
 inline void Multisphere::remove_body(int ilocal)
 {
     
-    mapArray_[id_(ilocal)] = -1;
-    if(nbody_ > 1) mapArray_[id_(nbody_-1)] = ilocal;
+    // last body is moved to ilocal
+
+    map_erase(id_(ilocal));
+    if(ilocal < nbody_-1) map_set(id_(nbody_-1),ilocal);
 
-    /*if(ilocal < nbody_-1)
-        copy_body(nbody_-1,ilocal);*/
     customValues_.deleteElement(ilocal);
 
     nbody_--;
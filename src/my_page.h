@@ -48,6 +48,8 @@ MyPage = templated class for storing chunks of datums in pages
   chunks are not returnable, can only reset and start over
   replaces many small mallocs with a few large mallocs
   pages are never freed, so can reuse w/out reallocs
+  pages are obtained from and returned to MyPagePool, so pages released
+    by init() or the destructor are re-used by the next MyPage
 usage:
   request one datum at a time, repeat, clear
   request chunks of datums in each get() or vget(), repeat, clear
@@ -81,6 +83,7 @@ methods:
 #define LAMMPS_MY_PAGE_H
 
 #include <stdlib.h>
+#include "my_page_pool.h"
 namespace LAMMPS_NS {
 
 template<class T>
@@ -102,17 +105,18 @@ class MyPage {
 
   int init(int user_maxchunk = 1, int user_pagesize = 1024,
            int user_pagedelta = 1) {
-    maxchunk = user_maxchunk;
-    pagesize = user_pagesize;
-    pagedelta = user_pagedelta;
-
-    if (maxchunk <= 0 || pagesize <= 0 || pagedelta <= 0) return 1;
-    if (maxchunk > pagesize) return 1;
+    if (user_maxchunk <= 0 || user_pagesize <= 0 || user_pagedelta <= 0)
+      return 1;
+    if (user_maxchunk > user_pagesize) return 1;
 
     // free any previously allocated pages
+    // before page size changes, so they go back to the pool correctly
 
-    for (int i = 0; i < npage; i++) free(pages[i]);
-    free(pages);
+    deallocate();
+
+    maxchunk = user_maxchunk;
+    pagesize = user_pagesize;
+    pagedelta = user_pagedelta;
 
     // initial page allocation
 
@@ -129,8 +133,7 @@ class MyPage {
   // free all allocated pages
 
   ~MyPage() {
-    for (int i = 0; i < npage; i++) free(pages[i]);
-    free(pages);
+    deallocate();
   }
 
   // get ptr to one datum
@@ -265,21 +268,16 @@ class MyPage {
     }
 
     for (int i = npage-pagedelta; i < npage; i++) {
-#if defined(LAMMPS_MEMALIGN)
-      void *ptr;
-      if (posix_memalign(&ptr, LAMMPS_MEMALIGN, pagesize*sizeof(T)))
-        errorflag = 2;
-      pages[i] = (T *) ptr;
-#else
-      if(zeroize) 
-        pages[i] = (T *) calloc(pagesize,sizeof(T));
-      else
-        pages[i] = (T *) malloc(pagesize*sizeof(T));
+      pages[i] = (T *) MyPagePool::allocate(pagesize*sizeof(T),zeroize);
       if (!pages[i]) errorflag = 2;
-
-#endif
     }
   }
+
+  void deallocate() {
+    for (int i = 0; i < npage; i++)
+      MyPagePool::release(pages[i],pagesize*sizeof(T));
+    free(pages);
+  }
 };
 
 }
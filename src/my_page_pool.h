@@ -0,0 +1,261 @@
+/* ----------------------------------------------------------------------
+    This is the
+
+    ██╗     ██╗ ██████╗  ██████╗  ██████╗ ██╗  ██╗████████╗███████╗
+    ██║     ██║██╔════╝ ██╔════╝ ██╔════╝ ██║  ██║╚══██╔══╝██╔════╝
+    ██║     ██║██║  ███╗██║  ███╗██║  ███╗███████║   ██║   ███████╗
+    ██║     ██║██║   ██║██║   ██║██║   ██║██╔══██║   ██║   ╚════██║
+    ███████╗██║╚██████╔╝╚██████╔╝╚██████╔╝██║  ██║   ██║   ███████║
+    ╚══════╝╚═╝ ╚═════╝  ╚═════╝  ╚═════╝ ╚═╝  ╚═╝   ╚═╝   ╚══════╝®
+
+    DEM simulation engine, released by
+    DCS Computing Gmbh, Linz, Austria
+    http://www.dcs-computing.com, office@dcs-computing.com
+
+    LIGGGHTS® is part of CFDEM®project:
+    http://www.liggghts.com | http://www.cfdem.com
+
+    Core developer and main author:
+    Christoph Kloss, christoph.kloss@dcs-computing.com
+
+    LIGGGHTS® is open-source, distributed under the terms of the GNU Public
+    License, version 2 or later. It is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+    of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. You should have
+    received a copy of the GNU General Public License along with LIGGGHTS®.
+    If not, see http://www.gnu.org/licenses . See also top-level README
+    and LICENSE files.
+
+    LIGGGHTS® and CFDEM® are registered trade marks of DCS Computing GmbH,
+    the producer of the LIGGGHTS® software and the CFDEM®coupling software
+    See http://www.cfdem.com/terms-trademark-policy for details.
+
+-------------------------------------------------------------------------
+    Contributing author and copyright for this file:
+    (if not contributing author is listed, this file has been contributed
+    by the core developer)
+
+    Copyright 2012-     DCS Computing GmbH, Linz
+------------------------------------------------------------------------- */
+
+/* ----------------------------------------------------------------------
+MyPagePool = process-wide allocator for the pages of MyPage and MyPoolChunk
+  pages released by a MyPage (destructor or init) are kept in a cache
+    and handed out again to the next request of the same size,
+    so re-initializing neighbor lists or contact history does not
+    fragment the heap
+  at most max_cached() bytes are kept in the cache, default MAXCACHED_MPP,
+    set via set_max_cached() (neigh_modify page_cache)
+  fresh pages are touched by the requesting thread right away, so with a
+    first-touch NUMA policy they are placed close to the thread using them
+    no explicit NUMA binding (libnuma, mbind) is done, placement relies
+    entirely on the first-touch policy of the OS
+  if compiled with -DLAMMPS_HUGEPAGES on Linux, pages of at least
+    HUGEPAGE_MPP bytes are mapped separately and advised to be backed
+    by transparent huge pages
+    pages are not rounded up to this size, so with the default neighbor
+    page size of 100000 only pages of 3 or more doubles per neighbor
+    qualify, pages of ints need neigh_modify page >= 524288
+methods:
+   void *allocate(nbytes, zeroize) = return ptr to nbytes of memory
+     memory is zeroized if zeroize = true
+     return NULL if allocation error
+   void release(ptr, nbytes) = give back memory obtained by allocate()
+     nbytes must be the same as in the allocate() call
+   void purge() = free all cached pages
+   void set_max_cached(nbytes) = limit cache size, frees pages above limit
+   bytes_inuse(), bytes_cached(), bytes_peak() = usage statistics
+------------------------------------------------------------------------- */
+
+#ifndef LAMMPS_MY_PAGE_POOL_H
+#define LAMMPS_MY_PAGE_POOL_H
+
+#include <stdlib.h>
+#include <string.h>
+#if defined(LAMMPS_HUGEPAGES) && defined(__linux__)
+#include <sys/mman.h>
+#endif
+
+// default max # of bytes kept in the cache
+#define MAXCACHED_MPP (256*1024*1024)
+// max # of different page sizes kept in the cache
+#define NSIZE_MPP 16
+// granularity for first touch
+#define TOUCH_MPP 4096
+// min size of pages backed by huge pages
+#define HUGEPAGE_MPP (2*1024*1024)
+
+namespace LAMMPS_NS {
+
+class MyPagePool {
+ public:
+
+  static void *allocate(size_t nbytes, bool zeroize = false) {
+    void *ptr = NULL;
+    Pool &p = pool();
+
+    // re-use a cached page of identical size
+    // the page has already been touched by this process
+
+#if defined(_OPENMP)
+    #pragma omp critical (MyPagePool)
+#endif
+    {
+      for (int i = 0; i < p.nsize; i++) {
+        if (p.size[i] == nbytes && p.head[i]) {
+          ptr = p.head[i];
+          p.head[i] = *static_cast<void **>(ptr);
+          p.cached -= nbytes;
+          break;
+        }
+      }
+    }
+
+    if (ptr) {
+      if (zeroize) memset(ptr,0,nbytes);
+    } else {
+      ptr = allocate_new(nbytes);
+      if (!ptr) return NULL;
+
+      // first touch by the thread that requested the page
+
+      if (zeroize) memset(ptr,0,nbytes);
+      else
+        for (size_t i = 0; i < nbytes; i += TOUCH_MPP)
+          static_cast<char *>(ptr)[i] = 0;
+    }
+
+#if defined(_OPENMP)
+    #pragma omp critical (MyPagePool)
+#endif
+    {
+      p.inuse += nbytes;
+      if (p.inuse > p.peak) p.peak = p.inuse;
+    }
+    return ptr;
+  }
+
+  static void release(void *ptr, size_t nbytes) {
+    if (!ptr) return;
+    Pool &p = pool();
+    bool cached = false;
+
+#if defined(_OPENMP)
+    #pragma omp critical (MyPagePool)
+#endif
+    {
+      p.inuse -= nbytes;
+
+      // pages too small to hold the free list link are not cached
+
+      if (nbytes >= sizeof(void *) && p.cached + nbytes <= p.maxcached) {
+        int i = 0;
+        while (i < p.nsize && p.size[i] != nbytes) i++;
+        if (i == p.nsize && p.nsize < NSIZE_MPP) {
+          p.size[i] = nbytes;
+          p.head[i] = NULL;
+          p.nsize++;
+        }
+        if (i < p.nsize) {
+          *static_cast<void **>(ptr) = p.head[i];
+          p.head[i] = ptr;
+          p.cached += nbytes;
+          cached = true;
+        }
+      }
+    }
+
+    if (!cached) free_page(ptr,nbytes);
+  }
+
+  static void purge() { pool().clear(); }
+
+  static void set_max_cached(size_t nbytes) {
+    Pool &p = pool();
+#if defined(_OPENMP)
+    #pragma omp critical (MyPagePool)
+#endif
+    {
+      p.maxcached = nbytes;
+      if (p.cached > p.maxcached) p.clear();
+    }
+  }
+
+  static size_t max_cached() { return pool().maxcached; }
+
+  static size_t bytes_inuse() { return pool().inuse; }
+  static size_t bytes_cached() { return pool().cached; }
+  static size_t bytes_peak() { return pool().peak; }
+
+ private:
+
+  struct Pool {
+    int nsize;                   // # of different page sizes in cache
+    size_t size[NSIZE_MPP];      // page size in bytes
+    void *head[NSIZE_MPP];       // first cached page of each size
+    size_t inuse;                // bytes handed out and not released
+    size_t cached;               // bytes held in cache
+    size_t peak;                 // max of inuse
+    size_t maxcached;            // max bytes held in cache
+
+    Pool() : nsize(0), inuse(0), cached(0), peak(0),
+      maxcached(MAXCACHED_MPP) {}
+    ~Pool() { clear(); }
+
+    void clear() {
+      for (int i = 0; i < nsize; i++) {
+        while (head[i]) {
+          void *ptr = head[i];
+          head[i] = *static_cast<void **>(ptr);
+          free_page(ptr,size[i]);
+        }
+      }
+      nsize = 0;
+      cached = 0;
+    }
+  };
+
+  // one pool per process, shared by all template instances
+
+  static Pool &pool() {
+    static Pool p;
+    return p;
+  }
+
+  static void *allocate_new(size_t nbytes) {
+    void *ptr = NULL;
+#if defined(LAMMPS_HUGEPAGES) && defined(__linux__)
+    if (nbytes >= HUGEPAGE_MPP) {
+      ptr = mmap(NULL,nbytes,PROT_READ|PROT_WRITE,
+                 MAP_PRIVATE|MAP_ANONYMOUS,-1,0);
+      if (ptr == MAP_FAILED) return NULL;
+#if defined(MADV_HUGEPAGE)
+      madvise(ptr,nbytes,MADV_HUGEPAGE);
+#endif
+      return ptr;
+    }
+#endif
+#if defined(LAMMPS_MEMALIGN)
+    if (posix_memalign(&ptr, LAMMPS_MEMALIGN, nbytes)) return NULL;
+#else
+    ptr = malloc(nbytes);
+#endif
+    return ptr;
+  }
+
+  static void free_page(void *ptr, size_t nbytes) {
+#if defined(LAMMPS_HUGEPAGES) && defined(__linux__)
+    if (nbytes >= HUGEPAGE_MPP) {
+      munmap(ptr,nbytes);
+      return;
+    }
+#else
+    (void) nbytes;
+#endif
+    free(ptr);
+  }
+};
+
+}
+
+#endif
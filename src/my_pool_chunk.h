@@ -49,6 +49,7 @@ MyPoolChunk = templated class for storing chunks of datums in pages
   chunks come in nbin different fixed sizes so can reuse
   replaces many small mallocs with a few large mallocs
   pages are never freed, so can reuse w/out reallocs
+  pages are obtained from and returned to MyPagePool
 usage:
   continously get() and put() chunks as needed
   NOTE: could add a clear() if retain info on mapping of pages to bins
@@ -76,6 +77,7 @@ public varaibles:
 #define LAMMPS_MY_POOL_CHUNK_H
 
 #include <stdlib.h>
+#include "my_page_pool.h"
 
 namespace LAMMPS_NS {
 
@@ -121,20 +123,22 @@ class MyPoolChunk {
 
     ndatum = nchunk = size = 0;
     pages = NULL;
+    whichbin = NULL;
     npage = 0;
   }
 
   // free all allocated memory
 
   ~MyPoolChunk() {
-    delete [] freehead;
-    delete [] chunksize;
     if (npage) {
       free(freelist);
-      for (int i = 0; i < npage; i++) free(pages[i]);
+      for (int i = 0; i < npage; i++)
+        MyPagePool::release(pages[i],chunkperpage*chunksize[whichbin[i]]*sizeof(T));
       free(pages);
       free(whichbin);
     }
+    delete [] freehead;
+    delete [] chunksize;
   }
 
   // return pointer/index of unused chunk of size maxchunk
@@ -219,7 +223,7 @@ class MyPoolChunk {
 
     for (int i = oldpage; i < npage; i++) {
       whichbin[i] = ibin;
-      pages[i] = (T *) malloc(chunkperpage*chunksize[ibin]*sizeof(T));
+      pages[i] = (T *) MyPagePool::allocate(chunkperpage*chunksize[ibin]*sizeof(T));
       size += chunkperpage*chunksize[ibin];
       if (!pages[i]) errorflag = 2;
     }
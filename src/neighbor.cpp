@@ -72,6 +72,8 @@
 #include "fix.h"
 #include "compute.h"
 #include "update.h"
+#include "timer.h"
+#include "perf_events.h"
 #include "respa.h"
 #include "output.h"
 #include "citeme.h"
@@ -80,6 +82,7 @@
 #include "neigh_multi_level_grid.h" 
 #include "math_extra_liggghts.h"    
 #include "fix_contact_history.h"
+#include "my_page_pool.h"
 #include <assert.h>
 
 using namespace LAMMPS_NS;
@@ -91,6 +94,7 @@ using namespace LAMMPS_NS;
 #define SMALL 1.0e-6
 #define BIG 1.0e20
 #define CUT2BIN_RATIO 100
+#define LOOKAHEAD 2.0
 
 enum{NSQ,BIN,MULTI};     // also in neigh_list.cpp
 
@@ -121,6 +125,10 @@ Neighbor::Neighbor(LAMMPS *lmp) : Pointers(lmp)
   delay = 10;
   contactDistanceFactor = 1.0; 
   dist_check = 1;
+  async_check = 0;
+  async_pending = 0;
+  contact_list = 0;
+  contact_margin = -1.0;
   pgsize = 100000;
   oneatom = 2000;
   binsizeflag = 0;
@@ -211,6 +219,8 @@ Neighbor::~Neighbor()
   delete [] cuttypesq;
   delete [] fixchecklist;
 
+  check_distance_discard();
+
   memory->destroy(xhold);
   memory->destroy(rhold); 
 
@@ -1364,6 +1374,26 @@ int Neighbor::decide()
   }
 
   ago++;
+
+  // non-blocking check: complete check posted on previous step
+  // and post the check for the next step if it is a check step
+  // only used for dynamics, since minimizer moves are not bounded by v*dt
+  // no check is posted on the last step of a run, atoms may be moved
+  //   by other commands before the next run
+
+  if (async_check && dist_check && !build_once && nprocs > 1 &&
+      update->whichflag == 1) {
+    if (ago >= delay && ago % every == 0) {
+      int flag;
+      if (async_pending) flag = check_distance_finish();
+      else flag = check_distance();
+      if (flag) return 1;
+    }
+    if (ago+1 >= delay && (ago+1) % every == 0 &&
+        update->ntimestep < update->laststep) check_distance_start();
+    return 0;
+  }
+
   if (ago >= delay && ago % every == 0) {
     if (build_once) return 0;
     if (dist_check == 0) return 1;
@@ -1385,35 +1415,12 @@ int Neighbor::decide()
 int Neighbor::check_distance()
 {
   double delx,dely,delz,rsq;
-  double delta,deltasq,delta1,delta2,delr,delrsq; 
+  double delta,deltasq,delr,delrsq; 
 
   if (boxcheck) {
-    if (triclinic == 0) {
-      delx = bboxlo[0] - boxlo_hold[0];
-      dely = bboxlo[1] - boxlo_hold[1];
-      delz = bboxlo[2] - boxlo_hold[2];
-      delta1 = sqrt(delx*delx + dely*dely + delz*delz);
-      delx = bboxhi[0] - boxhi_hold[0];
-      dely = bboxhi[1] - boxhi_hold[1];
-      delz = bboxhi[2] - boxhi_hold[2];
-      delta2 = sqrt(delx*delx + dely*dely + delz*delz);
-      delta = 0.5 * (skin - (delta1+delta2));
-      deltasq = delta*delta;
-    } else {
-      domain->box_corners();
-      delta1 = delta2 = 0.0;
-      for (int i = 0; i < 8; i++) {
-        delx = corners[i][0] - corners_hold[i][0];
-        dely = corners[i][1] - corners_hold[i][1];
-        delz = corners[i][2] - corners_hold[i][2];
-        delta = sqrt(delx*delx + dely*dely + delz*delz);
-        if (delta > delta1) delta1 = delta;
-        else if (delta > delta2) delta2 = delta;
-      }
-      delta = 0.5 * (skin - (delta1+delta2));
-      deltasq = delta*delta;
-    }
-  } else { 
+    delta = trigger_distance();
+    deltasq = delta*delta;
+  } else {
     deltasq = triggersq;
     delta = sqrt(deltasq);
   }
@@ -1460,6 +1467,131 @@ int Neighbor::check_distance()
   return flagall;
 }
 
+/* ----------------------------------------------------------------------
+   wait on a non-blocking check that is still in flight and drop it
+   called when neighbor lists are built and at the start of a run, so the
+   first check of a run is a blocking one on the current positions
+------------------------------------------------------------------------- */
+
+void Neighbor::check_distance_discard()
+{
+  if (!async_pending) return;
+  MPI_Status status;
+  MPI_Wait(&async_request,&status);
+  async_pending = 0;
+}
+
+/* ----------------------------------------------------------------------
+   distance an atom may move before reneighboring is triggered
+   1/2 of skin, reduced by how far box corners moved since last build
+------------------------------------------------------------------------- */
+
+double Neighbor::trigger_distance()
+{
+  double delx,dely,delz,delta,delta1,delta2;
+
+  if (!boxcheck) return sqrt(triggersq);
+
+  if (triclinic == 0) {
+    delx = bboxlo[0] - boxlo_hold[0];
+    dely = bboxlo[1] - boxlo_hold[1];
+    delz = bboxlo[2] - boxlo_hold[2];
+    delta1 = sqrt(delx*delx + dely*dely + delz*delz);
+    delx = bboxhi[0] - boxhi_hold[0];
+    dely = bboxhi[1] - boxhi_hold[1];
+    delz = bboxhi[2] - boxhi_hold[2];
+    delta2 = sqrt(delx*delx + dely*dely + delz*delz);
+  } else {
+    domain->box_corners();
+    delta1 = delta2 = 0.0;
+    for (int i = 0; i < 8; i++) {
+      delx = corners[i][0] - corners_hold[i][0];
+      dely = corners[i][1] - corners_hold[i][1];
+      delz = corners[i][2] - corners_hold[i][2];
+      delta = sqrt(delx*delx + dely*dely + delz*delz);
+      if (delta > delta1) delta1 = delta;
+      else if (delta > delta2) delta2 = delta;
+    }
+  }
+  return 0.5 * (skin - (delta1+delta2));
+}
+
+/* ----------------------------------------------------------------------
+   post non-blocking reduction of max atom displacement since last build
+   and max atom velocity, invoked one step before the check is needed
+   the reduction is in flight while forces of the current step are computed
+------------------------------------------------------------------------- */
+
+void Neighbor::check_distance_start()
+{
+  double delx,dely,delz,rsq,vsq;
+
+  double **x = atom->x;
+  double **v = atom->v;
+  double *radius = atom->radius;
+  int nlocal = atom->nlocal;
+  if (includegroup) nlocal = atom->nfirst;
+
+  double dmax = 0.0;
+  double vmaxsq = 0.0;
+
+  if (atom->radvary_flag == 0) {
+    double rsqmax = 0.0;
+    for (int i = 0; i < nlocal; i++) {
+      delx = x[i][0] - xhold[i][0];
+      dely = x[i][1] - xhold[i][1];
+      delz = x[i][2] - xhold[i][2];
+      rsq = delx*delx + dely*dely + delz*delz;
+      if (rsq > rsqmax) rsqmax = rsq;
+      vsq = v[i][0]*v[i][0] + v[i][1]*v[i][1] + v[i][2]*v[i][2];
+      if (vsq > vmaxsq) vmaxsq = vsq;
+    }
+    dmax = sqrt(rsqmax);
+  } else {
+
+    // growth of radius adds to the displacement of the surface
+
+    double d;
+    for (int i = 0; i < nlocal; i++) {
+      delx = x[i][0] - xhold[i][0];
+      dely = x[i][1] - xhold[i][1];
+      delz = x[i][2] - xhold[i][2];
+      rsq = delx*delx + dely*dely + delz*delz;
+      d = sqrt(rsq) + fabs(radius[i] - rhold[i]);
+      if (d > dmax) dmax = d;
+      vsq = v[i][0]*v[i][0] + v[i][1]*v[i][1] + v[i][2]*v[i][2];
+      if (vsq > vmaxsq) vmaxsq = vsq;
+    }
+  }
+
+  async_local[0] = dmax;
+  async_local[1] = sqrt(vmaxsq);
+  MPI_Iallreduce(async_local,async_global,2,MPI_DOUBLE,MPI_MAX,world,
+                 &async_request);
+  async_pending = 1;
+}
+
+/* ----------------------------------------------------------------------
+   complete reduction posted on previous step and decide on reneighboring
+   atoms moved by at most v*dt since then, so displacement is extrapolated
+     conservatively by LOOKAHEAD times the max velocity
+------------------------------------------------------------------------- */
+
+int Neighbor::check_distance_finish()
+{
+  MPI_Status status;
+  MPI_Wait(&async_request,&status);
+  async_pending = 0;
+
+  double delta = trigger_distance();
+  double ahead = LOOKAHEAD * async_global[1] * update->dt;
+
+  int flagall = 0;
+  if (async_global[0] + ahead > delta) flagall = 1;
+  if (flagall && ago == MAX(every,delay)) ndanger++;
+  return flagall;
+}
+
 /* ----------------------------------------------------------------------
    build all perpetual neighbor lists every few timesteps
    pairwise & topology lists are created as needed
@@ -1474,6 +1606,10 @@ void Neighbor::build(int topoflag)
   ncalls++;
   lastcall = update->ntimestep;
 
+  // discard a non-blocking check that is still in flight
+
+  check_distance_discard();
+
   // store current atom positions and box size if needed
 
   if (dist_check) {
@@ -1555,8 +1691,10 @@ void Neighbor::build(int topoflag)
   // invoke building of pair and molecular neighbor lists
   // only for pairwise lists with buildflag set
 
+  timer->perf->start(PERF_NEIGH_BUILD);
   for (i = 0; i < nblist; i++)
     (this->*pair_build[blist[i]])(lists[blist[i]]);
+  timer->perf->stop(PERF_NEIGH_BUILD);
 
   if (atom->molecular && topoflag) build_topology();
 }
@@ -1921,10 +2059,28 @@ void Neighbor::modify_params(int narg, char **arg)
       iarg +=2;
     } else if (strcmp(arg[iarg],"check") == 0) {
       if (iarg+2 > narg) error->all(FLERR,"Illegal neigh_modify command");
-      if (strcmp(arg[iarg+1],"yes") == 0) dist_check = 1;
-      else if (strcmp(arg[iarg+1],"no") == 0) dist_check = 0;
+      if (strcmp(arg[iarg+1],"yes") == 0) {
+        dist_check = 1;
+        async_check = 0;
+      } else if (strcmp(arg[iarg+1],"no") == 0) {
+        dist_check = 0;
+        async_check = 0;
+      } else if (strcmp(arg[iarg+1],"async") == 0) {
+        dist_check = 1;
+        async_check = 1;
+      } else error->all(FLERR,"Illegal neigh_modify command");
+      iarg += 2;
+    } else if (strcmp(arg[iarg],"contact_list") == 0) {
+      if (iarg+2 > narg) error->all(FLERR,"Illegal neigh_modify command");
+      if (strcmp(arg[iarg+1],"yes") == 0) contact_list = 1;
+      else if (strcmp(arg[iarg+1],"no") == 0) contact_list = 0;
       else error->all(FLERR,"Illegal neigh_modify command");
       iarg += 2;
+    } else if (strcmp(arg[iarg],"contact_margin") == 0) {
+      if (iarg+2 > narg) error->all(FLERR,"Illegal neigh_modify command");
+      contact_margin = force->numeric(FLERR,arg[iarg+1]);
+      if (contact_margin <= 0.0) error->all(FLERR,"Illegal neigh_modify command, contact_margin must be > 0");
+      iarg += 2;
     } else if (strcmp(arg[iarg],"once") == 0) {
       if (iarg+2 > narg) error->all(FLERR,"Illegal neigh_modify command");
       if (strcmp(arg[iarg+1],"yes") == 0) build_once = 1;
@@ -1936,6 +2092,12 @@ void Neighbor::modify_params(int narg, char **arg)
       old_pgsize = pgsize;
       pgsize = force->inumeric(FLERR,arg[iarg+1]);
       iarg += 2;
+    } else if (strcmp(arg[iarg],"page_cache") == 0) {
+      if (iarg+2 > narg) error->all(FLERR,"Illegal neigh_modify command");
+      double mbytes = force->numeric(FLERR,arg[iarg+1]);
+      if (mbytes < 0.0) error->all(FLERR,"Illegal neigh_modify command, page_cache must be >= 0");
+      MyPagePool::set_max_cached((size_t) (mbytes*1024.0*1024.0));
+      iarg += 2;
     } else if (strcmp(arg[iarg],"one") == 0) {
       if (iarg+2 > narg) error->all(FLERR,"Illegal neigh_modify command");
       old_oneatom = oneatom;
@@ -2198,6 +2360,10 @@ bigint Neighbor::memory_usage()
 
   for (int i = 0; i < nlist; i++) bytes += lists[i]->memory_usage();
 
+  // pages released by neighbor lists or contact history and held for re-use
+
+  bytes += MyPagePool::bytes_cached();
+
   bytes += memory->usage(bondlist,maxbond,3);
   bytes += memory->usage(anglelist,maxangle,4);
   bytes += memory->usage(dihedrallist,maxdihedral,5);
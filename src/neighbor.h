@@ -72,6 +72,12 @@ class Neighbor : protected Pointers {
   int delay;                       // delay build for this many steps
   double contactDistanceFactor;    // contact distance factor used to compute non-touch contact (forces without radius overlap)
   int dist_check;                  // 0 = always build, 1 = only if 1/2 dist
+  int async_check;                 // 1 if distance check is reduced
+                                   //   non-blocking one step ahead
+  int contact_list;                // 1 if pair gran keeps a persistent
+                                   //   list of pairs near contact
+  double contact_margin;           // gap below which pairs are kept in it,
+                                   //   as given, scaled by cg when used
   int ago;                         // how many steps ago neighboring occurred
   int pgsize;                      // size of neighbor page
   int oneatom;                     // max # of neighbors for one atom
@@ -122,6 +128,9 @@ class Neighbor : protected Pointers {
   void print_lists_of_lists();                  // debug print out
   int decide();                                 // decide whether to build or not
   virtual int check_distance();                 // check max distance moved since last build
+  void check_distance_start();                  // post check for next step
+  int check_distance_finish();                  // complete check posted on last step
+  void check_distance_discard();                // wait on and drop a posted check
   void setup_bins();                            // setup bins based on box and cutoff
   virtual void build(int topoflag=1);           // create all neighbor lists (pair,bond)
   virtual void build_topology();                // create all topology neighbor lists
@@ -159,6 +168,11 @@ class Neighbor : protected Pointers {
   double *cuttypesq;               // cuttype squared
 
   double triggersq;                // trigger = build when atom moves this dist
+
+  int async_pending;               // 1 if a non-blocking check is in flight
+  MPI_Request async_request;       // request of non-blocking check
+  double async_local[2];           // max displacement and velocity on proc
+  double async_global[2];          // max displacement and velocity of all procs
   int cluster_check;               // 1 if check bond/angle/etc satisfies minimg
 
   double **xhold;                      // atom coords at last neighbor build
@@ -228,6 +242,7 @@ class Neighbor : protected Pointers {
   int *glist;                  // lists to grow atom arrays every reneigh
   int *slist;                  // lists to grow stencil arrays every reneigh
 
+  double trigger_distance();            // allowed move since last build
   void bin_atoms();                     // bin all atoms
   double bin_distance(int, int, int);   // distance between binx
   double bin_largest_distance(int, int, int); 
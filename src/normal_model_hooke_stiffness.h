@@ -169,7 +169,7 @@ namespace ContactModels
                 // we need to calculate half an integration step which was left over to ensure no energy loss, but only for the elastic energy. The dissipation part is handled in fix_wall_gran_base.h.
                 double delta[3];
                 scdata.fix_mesh->triMesh()->get_global_vel(delta);
-                vectorScalarMult3D(delta, update->dt);
+                vectorScalarMult3D(delta, scdata.dt);
                 // -= because force is in opposite direction
                 // no *dt as delta is v*dt of the contact position
                 elastic_energy[0] -= (delta[0]*(elastic_energy[1]) +
@@ -269,7 +269,7 @@ namespace ContactModels
               {
                   double delta[3];
                   sidata.fix_mesh->triMesh()->get_global_vel(delta);
-                  vectorScalarMult3D(delta, update->dt);
+                  vectorScalarMult3D(delta, sidata.dt);
                   // -= because force is in opposite direction
                   // no *dt as delta is v*dt of the contact position
                     //printf("pela %e %e %e %e\n",  update->get_cur_time()-update->dt, deb, -sidata.radj, deb-sidata.radj);
@@ -93,6 +93,7 @@ Pair::Pair(LAMMPS *lmp) : Pointers(lmp)
   no_virial_fdotr_compute = 0;
   writedata = 0;
   ghostneigh = 0;
+  split_enable = 0;
 
   nextra = 0;
   pvector = NULL;
@@ -121,6 +122,9 @@ Pair::Pair(LAMMPS *lmp) : Pointers(lmp)
   eatom = NULL;
   vatom = NULL;
 
+  ilist_split = NULL;
+  maxsplit = ninterior = 0;
+
   listgranhistory = NULL;
   list = listhalf = listfull = listgranhistory = listinner = listmiddle = listouter = NULL; 
 
@@ -134,6 +138,7 @@ Pair::~Pair()
 {
   memory->destroy(eatom);
   memory->destroy(vatom);
+  memory->destroy(ilist_split);
 }
 
 /* ----------------------------------------------------------------------
@@ -695,6 +700,77 @@ void Pair::compute_dummy(int eflag, int vflag)
   else evflag = 0;
 }
 
+/* ----------------------------------------------------------------------
+   split ilist of standard neighbor list into interior atoms, which have
+     only owned atoms as neighbors, followed by boundary atoms
+   interior atoms can be computed before ghost atoms are updated
+   called after every neighbor list build
+------------------------------------------------------------------------- */
+
+void Pair::split_neighbor_list()
+{
+  int inum = list->inum;
+  int *ilist = list->ilist;
+  int *numneigh = list->numneigh;
+  int **firstneigh = list->firstneigh;
+  int nlocal = atom->nlocal;
+
+  if (inum > maxsplit) {
+    maxsplit = atom->nmax;
+    memory->destroy(ilist_split);
+    memory->create(ilist_split,maxsplit,"pair:ilist_split");
+  }
+
+  // interior atoms fill ilist_split from the front, boundary from the back
+  // boundary atoms are reversed again to keep their original order
+
+  int nfront = 0;
+  int nback = inum;
+
+  for (int ii = 0; ii < inum; ii++) {
+    int i = ilist[ii];
+    int *jlist = firstneigh[i];
+    int jnum = numneigh[i];
+    int jj;
+    for (jj = 0; jj < jnum; jj++)
+      if ((jlist[jj] & NEIGHMASK) >= nlocal) break;
+    if (jj == jnum) ilist_split[nfront++] = i;
+    else ilist_split[--nback] = i;
+  }
+
+  ninterior = nfront;
+  for (int lo = nback, hi = inum-1; lo < hi; lo++, hi--) {
+    int tmp = ilist_split[lo];
+    ilist_split[lo] = ilist_split[hi];
+    ilist_split[hi] = tmp;
+  }
+}
+
+/* ----------------------------------------------------------------------
+   compute interactions of a subset of atoms set by split_neighbor_list()
+   iflag = 0 for interior atoms, 1 for boundary atoms
+   standard neighbor list is restored on return
+------------------------------------------------------------------------- */
+
+void Pair::compute_split(int eflag, int vflag, int iflag)
+{
+  int inum = list->inum;
+  int *ilist = list->ilist;
+
+  if (iflag == 0) {
+    list->inum = ninterior;
+    list->ilist = ilist_split;
+  } else {
+    list->inum = inum - ninterior;
+    list->ilist = &ilist_split[ninterior];
+  }
+
+  compute(eflag,vflag);
+
+  list->inum = inum;
+  list->ilist = ilist;
+}
+
 /* ----------------------------------------------------------------------
    setup for energy, virial computation
    see integrate::ev_set() for values of eflag (0-3) and vflag (0-6)
@@ -82,6 +82,8 @@ class Pair : protected Pointers {
   int no_virial_fdotr_compute;   // 1 if does not invoke virial_fdotr_compute()
   int writedata;                 // 1 if writes coeffs to data file
   int ghostneigh;                // 1 if pair style needs neighbors of ghosts
+  int split_enable;              // 1 if compute() can run on interior and
+                                 //   boundary atoms in two separate passes
   double **cutghost;             // cutoff for each ghost pair
 
   int ewaldflag;                 // 1 if compatible with Ewald solver
@@ -142,6 +144,8 @@ class Pair : protected Pointers {
   void init_bitmap(double, double, int, int &, int &, int &, int &);
   virtual void modify_params(int, char **);
   void compute_dummy(int, int);
+  void split_neighbor_list();
+  void compute_split(int, int, int);
 
   // need to be public, so can be called by pair_style reaxc
 
@@ -162,6 +166,7 @@ class Pair : protected Pointers {
   virtual void compute_inner() {}
   virtual void compute_middle() {}
   virtual void compute_outer(int, int) {}
+  virtual int split_allowed() { return split_enable; }
 
   virtual double single(int, int, int, int,
                         double, double, double,
@@ -227,6 +232,10 @@ class Pair : protected Pointers {
   int vflag_fdotr;
   int maxeatom,maxvatom;
 
+  int *ilist_split;                    // ilist with interior atoms first
+  int maxsplit;                        // allocated size of ilist_split
+  int ninterior;                       // # of atoms with only owned neighbors
+
   virtual void ev_setup(int, int);
   void ev_unset();
   void ev_tally_full(int, double, double, double, double, double, double);
@@ -60,6 +60,8 @@
 #include "modify.h"
 #include "force.h"
 #include "update.h"
+#include "timer.h"
+#include "perf_events.h"
 #include "modify.h"
 #include "fix.h"
 #include "fix_contact_history.h"
@@ -75,6 +77,7 @@
 #include "fix_property_global.h"
 #include "fix_property_atom.h"
 #include "fix_contact_property_atom.h"
+#include "fix_multirate_gran.h"
 #include "compute_pair_gran_local.h"
 #include "pair_gran.h"
 
@@ -86,6 +89,7 @@ PairGran::PairGran(LAMMPS *lmp) : Pair(lmp)
 {
   single_enable = 0;
   no_virial_fdotr_compute = 1;
+  split_enable = 1;
 
   suffix = NULL;
   neighprev = 0;
@@ -124,6 +128,17 @@ PairGran::PairGran(LAMMPS *lmp) : Pair(lmp)
 
   fix_relax_ = NULL;
 
+  fix_multirate_ = NULL;
+
+  contact_list_enable_ = false;
+  cl_margin_ = 0.;
+  cl_ncalls_ = -1;
+  cl_nmax_ = cl_jjmax_ = cl_n_ = 0;
+  cl_first_ = cl_num_ = cl_jj_ = NULL;
+  cl_xold_ = NULL;
+  cl_rold_ = NULL;
+  cl_nrescan_ = 0;
+
   if(modify->n_fixes_style("multisphere/advanced"))
     do_store_contact_forces();
 }
@@ -162,6 +177,12 @@ PairGran::~PairGran()
 
   if(fix_dnum) delete []fix_dnum;
   if(dnum_index) delete []dnum_index;
+
+  memory->destroy(cl_first_);
+  memory->destroy(cl_num_);
+  memory->destroy(cl_jj_);
+  memory->destroy(cl_xold_);
+  memory->destroy(cl_rold_);
 }
 
 /* ---------------------------------------------------------------------- */
@@ -253,6 +274,23 @@ void PairGran::init_style()
 
   dt = update->dt;
 
+  // persistent contact list, not possible if multicontact models widen
+  // the radii per contact
+
+  contact_list_enable_ = neighbor->contact_list && !store_multicontact_data_;
+  if (neighbor->contact_list && store_multicontact_data_ && comm->me == 0)
+    error->warning(FLERR,"neigh_modify contact_list is not supported by multicontact surface models and ignored");
+  // the margin is scaled here, when the coarse-graining factors are final
+
+  cl_margin_ = neighbor->contact_margin > 0. ?
+    force->cg_max()*neighbor->contact_margin : 0.1*neighbor->skin;
+  cl_ncalls_ = -1;
+  cl_nrescan_ = 0;
+
+  // multi-rate integration of coarse size class
+
+  fix_multirate_ = static_cast<FixMultirateGran*>(modify->find_fix_style_strict("multirate/gran",0));
+
   // if shear history is stored:
   // check if newton flag is valid
   // if first init, create Fix needed for storing shear history
@@ -666,7 +704,107 @@ void PairGran::compute(int eflag, int vflag)
    shearupdate_ = 1;
    if (update->setupflag) shearupdate_ = 0;
 
-   compute_force(eflag,vflag,0);
+   // fill compute pair/gran/local in this pass if it is invoked on this step
+
+   const int addflag = (cpl_ && cpl_->capture_due()) ? 1 : 0;
+
+   timer->perf->start(PERF_PAIR);
+   compute_force(eflag,vflag,addflag);
+   timer->perf->stop(PERF_PAIR);
+}
+
+/* ----------------------------------------------------------------------
+   compute can only be split into interior and boundary passes if it does
+   not gather per-contact data that is finalized or communicated per pass
+------------------------------------------------------------------------- */
+
+int PairGran::split_allowed()
+{
+  if (contact_list_enable_) return 0;
+  if (cpl_ && cpl_->capture_due()) return 0;
+  if (store_contact_forces_ || store_contact_forces_stress_) return 0;
+  return split_enable;
+}
+
+/* ----------------------------------------------------------------------
+   decide if the contact list rows must be rebuilt from the full neighbor
+   list in this pass
+   a pair is left out of the rows if its gap r - cdf*radsum exceeded the
+   margin at the last rescan. it can only come into range again once an
+   owned or ghost atom moved or grew by more than half the margin since
+   then. ghost indices are stable between neighbor builds, so this is
+   decided locally without communication
+------------------------------------------------------------------------- */
+
+bool PairGran::contact_list_check()
+{
+  const int nall = atom->nlocal + atom->nghost;
+  double **x = atom->x;
+  double *radius = atom->radius;
+
+  bool rescan = (cl_ncalls_ != neighbor->ncalls);
+
+  if (!rescan) {
+    const double cdf = neighbor->contactDistanceFactor;
+    const double trigger = 0.5*cl_margin_;
+    const double triggersq = trigger*trigger;
+    for (int i = 0; i < nall; i++) {
+      const double delx = x[i][0] - cl_xold_[i][0];
+      const double dely = x[i][1] - cl_xold_[i][1];
+      const double delz = x[i][2] - cl_xold_[i][2];
+      const double rsq = delx*delx + dely*dely + delz*delz;
+      const double delr = radius[i] - cl_rold_[i];
+      if (delr != 0.) {
+        if (sqrt(rsq) + cdf*fabs(delr) > trigger) {
+          rescan = true;
+          break;
+        }
+      } else if (rsq > triggersq) {
+        rescan = true;
+        break;
+      }
+    }
+  }
+
+  if (!rescan) return false;
+
+  // store reference state and make room for rows of all owned atoms
+
+  if (atom->nmax > cl_nmax_) {
+    cl_nmax_ = atom->nmax;
+    memory->destroy(cl_first_);
+    memory->destroy(cl_num_);
+    memory->destroy(cl_xold_);
+    memory->destroy(cl_rold_);
+    memory->create(cl_first_,cl_nmax_,"pair:cl_first");
+    memory->create(cl_num_,cl_nmax_,"pair:cl_num");
+    memory->create(cl_xold_,cl_nmax_,3,"pair:cl_xold");
+    memory->create(cl_rold_,cl_nmax_,"pair:cl_rold");
+  }
+
+  for (int i = 0; i < nall; i++) {
+    cl_xold_[i][0] = x[i][0];
+    cl_xold_[i][1] = x[i][1];
+    cl_xold_[i][2] = x[i][2];
+    cl_rold_[i] = radius[i];
+  }
+
+  const int inum = list->inum;
+  const int * const ilist = list->ilist;
+  const int * const numneigh = list->numneigh;
+  int nslots = 0;
+  for (int ii = 0; ii < inum; ii++)
+    nslots += numneigh[ilist[ii]];
+  if (nslots > cl_jjmax_) {
+    cl_jjmax_ = nslots;
+    memory->destroy(cl_jj_);
+    memory->create(cl_jj_,cl_jjmax_,"pair:cl_jj");
+  }
+
+  cl_n_ = 0;
+  cl_ncalls_ = neighbor->ncalls;
+  cl_nrescan_++;
+  return true;
 }
 
 /* ----------------------------------------------------------------------
@@ -788,6 +926,8 @@ void *PairGran::extract(const char *str, int &dim)
 double PairGran::memory_usage()
 {
   double bytes = nmax * sizeof(double);
+  bytes += cl_nmax_ * (2*sizeof(int) + 4*sizeof(double));
+  bytes += cl_jjmax_ * sizeof(int);
   return bytes;
 }
 
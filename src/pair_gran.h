@@ -76,6 +76,7 @@ public:
 
   virtual void compute(int eflag, int vflag);
   virtual void compute_pgl(int eflag, int vflag);
+  virtual int split_allowed();
   virtual void settings(int, char **) = 0;
   virtual void coeff(int, char **);
   virtual void init_style();
@@ -202,6 +203,35 @@ public:
   double * get_sum_normal_force_ptr(const int i)
   { return &(fix_sum_normal_force_->vector_atom[i]); }
 
+  // persistent contact list (neigh_modify contact_list yes)
+  // per owned atom, the neighbor list slots jj of pairs whose gap was below
+  // the margin at the last rescan
+
+  bool contact_list_check();
+
+  inline bool contact_list_enabled() const
+  { return contact_list_enable_; }
+
+  inline double contact_list_margin() const
+  { return cl_margin_; }
+
+  inline void contact_list_begin_row(const int i)
+  { cl_first_[i] = cl_n_; cl_num_[i] = 0; }
+
+  inline void contact_list_add(const int i, const int jj)
+  { cl_jj_[cl_n_++] = jj; cl_num_[i]++; }
+
+  inline const int * contact_list_row(const int i) const
+  { return &cl_jj_[cl_first_[i]]; }
+
+  inline int contact_list_rownum(const int i) const
+  { return cl_num_[i]; }
+
+  // force-evaluation skipping within coarse size class (fix multirate/gran)
+
+  class FixMultirateGran * fix_multirate() const
+  { return fix_multirate_; }
+
  protected:
 
   struct HistoryArg {
@@ -295,8 +325,23 @@ public:
 
   FixRelaxContacts *fix_relax_;
 
+  class FixMultirateGran *fix_multirate_;
+
   // dissipated energy in wall -> particle contacts
   double dissipated_energy_;
+
+  // persistent contact list
+  bool contact_list_enable_;
+  double cl_margin_;          // pairs with a larger gap are skipped
+  bigint cl_ncalls_;          // neighbor build the rows belong to
+  int cl_nmax_;               // allocated # of atoms
+  int cl_jjmax_;              // allocated # of slots
+  int cl_n_;                  // used # of slots
+  int *cl_first_,*cl_num_;    // row start and length per owned atom
+  int *cl_jj_;                // neighbor list slots of all rows
+  double **cl_xold_;          // positions at last rescan
+  double *cl_rold_;           // radii at last rescan
+  bigint cl_nrescan_;         // # of rescans in this run
 };
 
 }
@@ -62,6 +62,7 @@
 #include "fix_contact_property_atom.h"
 #include "os_specific.h"
 #include "fix_insert_stream_predefined.h"
+#include "fix_multirate_gran.h"
 
 #include "granular_pair_style.h"
 
@@ -247,6 +248,28 @@ public:
     sidata.is_wall = false;
     sidata.computeflag = pg->computeflag();
     sidata.shearupdate = pg->shearupdate();
+    sidata.dt = update->dt;
+
+    // persistent contact list: visit only pairs that may be in range
+    // all pairs are visited when the rows are rebuilt or when history is
+    // copied for freshly inserted particles
+
+    const bool use_cl = pg->contact_list_enabled() && fix_insert.empty();
+    const bool cl_rescan = use_cl && pg->contact_list_check();
+    const bool cl_skip = use_cl && !cl_rescan;
+    const double cl_margin = pg->contact_list_margin();
+    const double contactDistanceFactor = neighbor->contactDistanceFactor;
+
+    // fix multirate/gran: contacts between two particles of the coarse
+    // class are only evaluated every M-th step, their contact models get
+    // M times the time-step via sidata.dt. their force is either scaled by
+    // M or stored to be held until the next evaluation
+
+    FixMultirateGran * const fix_multirate = pg->fix_multirate();
+    const bool mr_coarse_step = fix_multirate && fix_multirate->coarse_step();
+    const bool mr_hold = fix_multirate && fix_multirate->hold();
+    const double mr_dt_factor = fix_multirate ? static_cast<double>(fix_multirate->every()) : 1.;
+    const double mr_scale = mr_hold ? 1. : mr_dt_factor;
 
     cmodel.beginPass(sidata, i_forces, j_forces);
 
@@ -261,7 +284,9 @@ public:
       int * const contact_flags = first_contact_flag ? first_contact_flag[i] : NULL;
       double * const all_contact_hist = first_contact_hist ? first_contact_hist[i] : NULL;
       int * const jlist = firstneigh[i];
-      const int jnum = numneigh[i];
+      const int * const cl_row = cl_skip ? pg->contact_list_row(i) : NULL;
+      const int jnum = cl_skip ? pg->contact_list_rownum(i) : numneigh[i];
+      if (cl_rescan) pg->contact_list_begin_row(i);
 
       sidata.i = i;
       #ifdef SUPERQUADRIC_ACTIVE_FLAG
@@ -273,7 +298,8 @@ public:
           sidata.radi = radi;
       #endif
 
-      for (int jj = 0; jj < jnum; jj++) {
+      for (int kk = 0; kk < jnum; kk++) {
+        const int jj = cl_row ? cl_row[kk] : kk;
         const int j = jlist[jj] & NEIGHMASK;
 
         const double delx = xtmp - x[j][0];
@@ -310,6 +336,18 @@ public:
 #endif
         const double radsum = radi + radj;
 
+        if (cl_rescan) {
+          const double rcl = contactDistanceFactor*radsum + cl_margin;
+          if (rsq < rcl*rcl) pg->contact_list_add(i,jj);
+        }
+
+        bool mr_pair = false;
+        if (fix_multirate) {
+          mr_pair = fix_multirate->coarse(mask[i],radius[i]) && fix_multirate->coarse(mask[j],radius[j]);
+          if (mr_pair && !mr_coarse_step) continue;
+          sidata.dt = mr_pair ? mr_dt_factor*update->dt : update->dt;
+        }
+
         sidata.j = j;
         sidata.delta[0] = delx;
         sidata.delta[1] = dely;
@@ -421,12 +459,22 @@ public:
         if(sidata.has_force_update) {
           if (sidata.computeflag) {
 
+            const double mr_factor = mr_pair ? mr_scale : 1.;
             const double relax_i = pg->relax(i);
-            force_update(relax_i,f[i], torque[i], i_forces);
+            force_update(mr_factor*relax_i,f[i], torque[i], i_forces);
 
             if(newton_pair || j < nlocal) {
               const double relax_j = pg->relax(j);
-              force_update(relax_j,f[j], torque[j], j_forces);
+              force_update(mr_factor*relax_j,f[j], torque[j], j_forces);
+            }
+
+            if (mr_pair && mr_hold) {
+              double * const fh_i = fix_multirate->hold_force(i);
+              force_update(relax_i,&fh_i[0],&fh_i[3],i_forces);
+              if (j < nlocal) {
+                double * const fh_j = fix_multirate->hold_force(j);
+                force_update(pg->relax(j),&fh_j[0],&fh_j[3],j_forces);
+              }
             }
 
             // summation of f.n to compute a simplistic pressure
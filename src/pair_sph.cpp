@@ -77,6 +77,19 @@ PairSph::PairSph(LAMMPS *lmp) : Pair(lmp)
     viscosity_ = 0;
 
     kernel_style = NULL;
+    kernel_table_n = 0;
+    kernel_table = NULL;
+
+    kcache_.kernel_id = -1;
+    kcache_.inum = 0;
+    kcache_.ilist = NULL;
+    kcache_.first = NULL;
+    kcache_.jlist = NULL;
+    kcache_.del = NULL;
+    kcache_.w = NULL;
+    kcache_.dw = NULL;
+    kcache_imax_ = kcache_nmax_ = 0;
+    kcache_lastcall_ = -1;
 
     fppaSl = NULL;
     fppaSlType = NULL;
@@ -116,6 +129,14 @@ PairSph::~PairSph()
   delete [] onerad;
 
   if(kernel_style) delete []kernel_style;
+  if(kernel_table) delete kernel_table;
+
+  memory->destroy(kcache_.first);
+  memory->destroy(kcache_.jlist);
+  memory->destroy(kcache_.del);
+  memory->destroy(kcache_.w);
+  memory->destroy(kcache_.dw);
+
   if(fppaSl) modify->delete_fix("sl");
 //  if(fppaSlType) modify->delete_fix("sl");
 
@@ -325,6 +346,14 @@ void PairSph::init_style()
     MPI_Allreduce(&onerad[1],&maxrad[1],atom->ntypes,MPI_DOUBLE,MPI_MAX,world);
   }
 
+  kernel_cache_reset();
+
+  // (re-)build kernel table if requested
+
+  if(kernel_table) delete kernel_table;
+  kernel_table = NULL;
+  if(kernel_table_n > 0) kernel_table = new SPH_KERNEL_NS::SPHKernelTable(kernel_id,kernel_table_n);
+
   // proceed with initialisation of the substyle
   init_substyle();
 
@@ -395,3 +424,134 @@ double PairSph::interpDist(double disti, double distj)
   return 0.5*(disti+distj);
 }
 */
+
+/* ----------------------------------------------------------------------
+   return per-pair cache for kernel kid, build it if not done yet
+   needs current ghost positions, i.e. call after the forward comm of x
+   returns NULL if the cache was already built for a different kernel
+   or if smoothing length is per-atom (sph/var), which is not cached
+------------------------------------------------------------------------- */
+
+const SphKernelCache *PairSph::kernel_cache(int kid)
+{
+  if (kcache_.kernel_id >= 0 && kcache_lastcall_ == neighbor->lastcall)
+    return kernel_cache_valid(kid);
+
+  if (!list || !mass_type) return NULL;
+
+  if (0) return NULL;
+  #define SPH_KERNEL_CLASS
+  #define SPHKernel(ID,kernelstyle,SPHKernelCalculation,SPHKernelCalculationDer,SPHKernelCalculationCut) \
+  else if (kid == ID) kernel_cache_eval(SPH_KERNEL_NS::SPHKernelType<ID>());
+  #include "style_sph_kernel.h"
+  #undef SPH_KERNEL_CLASS
+  #undef SPHKernel
+  else return NULL;
+
+  kcache_.kernel_id = kid;
+  kcache_lastcall_ = neighbor->lastcall;
+  return &kcache_;
+}
+
+/* ----------------------------------------------------------------------
+   cache for the current pair computation, NULL if none
+   a cache built on the neighbor list of a previous build is stale
+------------------------------------------------------------------------- */
+
+const SphKernelCache *PairSph::kernel_cache_valid(int kid) const
+{
+  if (kcache_.kernel_id < 0 || kcache_.kernel_id != kid) return NULL;
+  if (kcache_lastcall_ != neighbor->lastcall) return NULL;
+  return &kcache_;
+}
+
+/* ---------------------------------------------------------------------- */
+
+template <class KERNEL>
+void PairSph::kernel_cache_eval(const KERNEL &kernel)
+{
+  double **x = atom->x;
+  int *type = atom->type;
+  const double kcut = kernel.cut();
+
+  const int inum = list->inum;
+  int *ilist = list->ilist;
+  int *numneigh = list->numneigh;
+  int **firstneigh = list->firstneigh;
+
+  // upper bound for # of pairs is the size of the neighbor list
+
+  int npair = 0;
+  for (int ii = 0; ii < inum; ii++)
+    npair += numneigh[ilist[ii]];
+
+  if (inum+1 > kcache_imax_) {
+    kcache_imax_ = inum+1;
+    memory->destroy(kcache_.first);
+    memory->create(kcache_.first,kcache_imax_,"pair:kcache_first");
+  }
+  if (npair > kcache_nmax_) {
+    kcache_nmax_ = npair;
+    memory->destroy(kcache_.jlist);
+    memory->destroy(kcache_.del);
+    memory->destroy(kcache_.w);
+    memory->destroy(kcache_.dw);
+    memory->create(kcache_.jlist,kcache_nmax_,"pair:kcache_jlist");
+    memory->create(kcache_.del,kcache_nmax_,4,"pair:kcache_del");
+    memory->create(kcache_.w,kcache_nmax_,"pair:kcache_w");
+    memory->create(kcache_.dw,kcache_nmax_,"pair:kcache_dw");
+  }
+
+  kcache_.inum = inum;
+  kcache_.ilist = ilist;
+
+  int n = 0;
+
+  for (int ii = 0; ii < inum; ii++) {
+    const int i = ilist[ii];
+    const double xtmp = x[i][0];
+    const double ytmp = x[i][1];
+    const double ztmp = x[i][2];
+    int *jlist = firstneigh[i];
+    const int jnum = numneigh[i];
+
+    const int itype = type[i];
+
+    kcache_.first[ii] = n;
+
+    for (int jj = 0; jj < jnum; jj++) {
+      const int j = jlist[jj];
+
+      const double slCom = slComType[itype][type[j]];
+      const double cut = slCom*kcut;
+
+      const double delx = xtmp - x[j][0];
+      const double dely = ytmp - x[j][1];
+      const double delz = ztmp - x[j][2];
+      const double rsq = delx*delx + dely*dely + delz*delz;
+
+      if (rsq >= cut*cut) continue;
+
+      const double r = sqrt(rsq);
+      if (r == 0.) {
+        char str[256];
+        sprintf(str,"Zero distance between SPH particles %d and %d at (%f, %f, %f)",
+                atom->tag[i],atom->tag[j],xtmp,ytmp,ztmp);
+        error->one(FLERR,str);
+      }
+      const double slComInv = 1./slCom;
+      const double s = r*slComInv;
+
+      kcache_.jlist[n] = j;
+      kcache_.del[n][0] = delx;
+      kcache_.del[n][1] = dely;
+      kcache_.del[n][2] = delz;
+      kcache_.del[n][3] = r;
+      kcache_.w[n] = kernel.w(s,slCom,slComInv);
+      kcache_.dw[n] = kernel.der(s,slCom,slComInv);
+      n++;
+    }
+  }
+
+  kcache_.first[inum] = n;
+}
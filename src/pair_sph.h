@@ -49,8 +49,29 @@
 
 #include "pair.h"
 
+namespace SPH_KERNEL_NS {
+  class SPHKernelTable;
+}
+
 namespace LAMMPS_NS {
 
+/* ----------------------------------------------------------------------
+   per-pair geometry and kernel values of one time step
+   built by the first sph fix in pre_force, reused by the other sph fixes
+   and by the pair style until the end of the pair computation
+------------------------------------------------------------------------- */
+
+struct SphKernelCache {
+  int kernel_id;    // kernel of w and dw, -1 if not built
+  int inum;         // # of i atoms, same order as the pair neighbor list
+  int *ilist;
+  int *first;       // pairs of ilist[ii] are first[ii] ... first[ii+1]-1
+  int *jlist;       // neighbor j of each pair inside the kernel cutoff
+  double **del;     // x_i - x_j (0..2) and distance r (3)
+  double *w;        // kernel W
+  double *dw;       // kernel derivative dW/dr
+};
+
 class PairSph : public Pair {
  public:
 
@@ -78,6 +99,9 @@ class PairSph : public Pair {
   /* PUBLIC ACCESS FUNCTIONS */
 
   int sph_kernel_id(){return kernel_id;}
+
+  const SphKernelCache *kernel_cache(int);
+  inline void kernel_cache_reset() {kcache_.kernel_id = -1;}
   int returnPairStyle(){return pairStyle_; };
   double returnViscosity() {return viscosity_; };
 
@@ -98,6 +122,10 @@ class PairSph : public Pair {
   int kernel_id;
   char *kernel_style;
 
+  // optional tabulated kernel, used instead of the analytic one if set
+  int kernel_table_n;
+  SPH_KERNEL_NS::SPHKernelTable *kernel_table;
+
   double *onerad;
   double *maxrad;
 
@@ -109,6 +137,17 @@ class PairSph : public Pair {
   // storage for force part caused by pressure gradient (grad P / rho):
   class FixPropertyAtom* fix_fgradP_;
   double **fgradP_;
+
+  // cache valid for the current pair computation, NULL if none
+  const SphKernelCache *kernel_cache_valid(int kid) const;
+
+ private:
+
+  template <class KERNEL> void kernel_cache_eval(const KERNEL &);
+
+  SphKernelCache kcache_;
+  int kcache_imax_, kcache_nmax_;
+  bigint kcache_lastcall_; // neighbor->lastcall the cache was built on
 };
 
 }
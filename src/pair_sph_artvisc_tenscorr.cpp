@@ -147,6 +147,12 @@ void PairSphArtviscTenscorr::settings(int narg, char **arg)
       if (iarg+1 > narg) error->all(FLERR, "Illegal pair_style sph command");
       tensCorr_flag = 1;
       iarg += 1;
+    } else if (strcmp(arg[iarg],"kernel_table") == 0) {
+      // number of intervals for tabulated kernel, 0 = analytic kernel
+      if (iarg+2 > narg) error->all(FLERR, "Illegal pair_style sph command");
+      kernel_table_n = force->inumeric(FLERR,arg[iarg+1]);
+      if (kernel_table_n < 0) error->all(FLERR, "Illegal pair_style sph command, kernel_table must be >= 0");
+      iarg += 2;
     } else error->all(FLERR, "Illegal pair_style sph command");
   }
 }
@@ -266,8 +272,24 @@ void PairSphArtviscTenscorr::allocate_properties(int size)
 
 void PairSphArtviscTenscorr::compute(int eflag, int vflag)
 {
-  if (mass_type) compute_eval<1>(eflag,vflag);
-  else compute_eval<0>(eflag,vflag);
+  // resolve kernel once per call so the pair loop can inline it
+
+  if (kernel_table) {
+    if (mass_type) compute_eval<1>(eflag,vflag,*kernel_table);
+    else compute_eval<0>(eflag,vflag,*kernel_table);
+  }
+  #define SPH_KERNEL_CLASS
+  #define SPHKernel(ID,kernelstyle,SPHKernelCalculation,SPHKernelCalculationDer,SPHKernelCalculationCut) \
+  else if (kernel_id == ID) { \
+    if (mass_type) compute_eval<1>(eflag,vflag,SPH_KERNEL_NS::SPHKernelType<ID>()); \
+    else compute_eval<0>(eflag,vflag,SPH_KERNEL_NS::SPHKernelType<ID>()); \
+  }
+  #include "style_sph_kernel.h"
+  #undef SPH_KERNEL_CLASS
+  #undef SPHKernel
+
+  // positions change before the next computation
+  kernel_cache_reset();
 }
 
 /* ----------------------------------------------------------------------
@@ -330,8 +352,8 @@ void PairSphArtviscTenscorr::read_restart_settings(FILE *fp, const int major, co
    template compute
 ------------------------------------------------------------------------- */
 
-template <int MASSFLAG>
-void PairSphArtviscTenscorr::compute_eval(int eflag, int vflag)
+template <int MASSFLAG, class KERNEL>
+void PairSphArtviscTenscorr::compute_eval(int eflag, int vflag, const KERNEL &kernel)
 {
   double sli,slCom,imass,jmass;
   double artVisc,fAB4,rAB;
@@ -340,6 +362,13 @@ void PairSphArtviscTenscorr::compute_eval(int eflag, int vflag)
 
   double radi,rcom;
 
+  // inverse kernel at deltaP = sl / 1.2 in normalized units, see below
+  const double wDeltaPOneInv = MASSFLAG ? 0. : 1./kernel.w(1./1.2,1.,1.);
+
+  // per-pair kernel values computed by the sph fixes in this time step
+  // (only for per-type smoothing length, same cutoff as cutsq)
+  const SphKernelCache *kc = (MASSFLAG && !kernel_table) ? kernel_cache_valid(kernel_id) : NULL;
+
   double **x = atom->x;
   double **v = atom->vest;
   double *p = atom->p;
@@ -396,13 +425,18 @@ void PairSphArtviscTenscorr::compute_eval(int eflag, int vflag)
     // derivative of kernel must be 0 at s = 0
     // so particle itself is not contributing
 
-    for (int jj = 0; jj < jnum; jj++) {
-      const int j = jlist[jj];
+    // with kernel cache only pairs inside the cutoff are visited
+
+    const int jbegin = kc ? kc->first[ii] : 0;
+    const int jend = kc ? kc->first[ii+1] : jnum;
+
+    for (int jj = jbegin; jj < jend; jj++) {
+      const int j = kc ? kc->jlist[jj] : jlist[jj];
       const int jtype = type[j];
 
-      const double delx = xtmp - x[j][0];
-      const double dely = ytmp - x[j][1];
-      const double delz = ztmp - x[j][2];
+      const double delx = kc ? kc->del[jj][0] : xtmp - x[j][0];
+      const double dely = kc ? kc->del[jj][1] : ytmp - x[j][1];
+      const double delz = kc ? kc->del[jj][2] : ztmp - x[j][2];
       const double rsq = delx*delx + dely*dely + delz*delz;
 
       if (!MASSFLAG) {
@@ -410,7 +444,7 @@ void PairSphArtviscTenscorr::compute_eval(int eflag, int vflag)
         rcom = interpDist(radi,radj);
       }
 
-      if ((MASSFLAG && rsq < cutsq[itype][jtype]) || (!MASSFLAG && rsq < rcom*rcom)) {
+      if (kc || (MASSFLAG && rsq < cutsq[itype][jtype]) || (!MASSFLAG && rsq < rcom*rcom)) {
 
         if (MASSFLAG) {
           jmass = mass[jtype];
@@ -427,7 +461,7 @@ void PairSphArtviscTenscorr::compute_eval(int eflag, int vflag)
         //cut = slCom*SPH_KERNEL_NS::sph_kernel_cut(kernel_id);
 
         // get distance and normalized distance
-        const double r = sqrt(rsq);
+        const double r = kc ? kc->del[jj][3] : sqrt(rsq);
         if (r == 0.) {
           printf("Particle %i and %i are at same position (%f, %f, %f)",i,j,xtmp,ytmp,ztmp);
           error->one(FLERR,"Zero distance between SPH particles!");
@@ -436,7 +470,7 @@ void PairSphArtviscTenscorr::compute_eval(int eflag, int vflag)
         const double s = r * slComInv;
 
         // calculate value for magnitude of grad W
-        const double gradWmag = SPH_KERNEL_NS::sph_kernel_der(kernel_id,s,slCom,slComInv);
+        const double gradWmag = kc ? kc->dw[jj] : kernel.der(s,slCom,slComInv);
 
         // artificial viscosity
         artVisc = 0.0;
@@ -472,16 +506,16 @@ void PairSphArtviscTenscorr::compute_eval(int eflag, int vflag)
             rAB = rA+rB;
           }
 
+          //TODO: Is fAB4 in this form ok?!
+          double fAB;
           if (MASSFLAG) {
             wDeltaPinv = wDeltaPTypeinv[itype][jtype];
+            fAB = (kc ? kc->w[jj] : kernel.w(s,slCom,slComInv)) * wDeltaPinv;
           } else {
-            // assumption that deltaP = sl / 1.2
-            const double deltaPOne = slCom/1.2;
-            wDeltaPinv = 1./SPH_KERNEL_NS::sph_kernel(kernel_id,deltaPOne * slComInv,slCom,slComInv);
+            // assumption that deltaP = sl / 1.2, so the smoothing length
+            // cancels and W(r)/W(deltaP) only depends on s
+            fAB = kernel.w(s,1.,1.) * wDeltaPOneInv;
           }
-
-          //TODO: Is fAB4 in this form ok?!
-          const double fAB =  SPH_KERNEL_NS::sph_kernel(kernel_id,s,slCom,slComInv) * wDeltaPinv;
           const double fAB2 = fAB * fAB;
           fAB4 = fAB2 * fAB2;
         }
@@ -70,7 +70,7 @@ class PairSphArtviscTenscorr : public PairSph {
 
  protected:
   void allocate();
-  template <int> void compute_eval(int, int);
+  template <int MASSFLAG, class KERNEL> void compute_eval(int, int, const KERNEL &);
 
   int     artVisc_flag, tensCorr_flag; // flags for additional styles
 
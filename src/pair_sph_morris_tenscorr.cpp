@@ -185,6 +185,12 @@ void PairSphMorrisTenscorr::settings(int narg, char **arg)
       epsilon = force->numeric(FLERR,arg[iarg+1]);
       deltaP = force->numeric(FLERR,arg[iarg+2]);
       iarg += 3;
+    } else if (strcmp(arg[iarg],"kernel_table") == 0) {
+      // number of intervals for tabulated kernel, 0 = analytic kernel
+      if (iarg+2 > narg) error->all(FLERR, "Illegal pair_style sph command");
+      kernel_table_n = force->inumeric(FLERR,arg[iarg+1]);
+      if (kernel_table_n < 0) error->all(FLERR, "Illegal pair_style sph command, kernel_table must be >= 0");
+      iarg += 2;
     } else error->all(FLERR, "Illegal pair_style sph command");
   }
 
@@ -293,8 +299,24 @@ void PairSphMorrisTenscorr::allocate_properties(int size)
 
 void PairSphMorrisTenscorr::compute(int eflag, int vflag)
 {
-  if (mass_type) compute_eval<1>(eflag,vflag);
-  else compute_eval<0>(eflag,vflag);
+  // resolve kernel once per call so the pair loop can inline it
+
+  if (kernel_table) {
+    if (mass_type) compute_eval<1>(eflag,vflag,*kernel_table);
+    else compute_eval<0>(eflag,vflag,*kernel_table);
+  }
+  #define SPH_KERNEL_CLASS
+  #define SPHKernel(ID,kernelstyle,SPHKernelCalculation,SPHKernelCalculationDer,SPHKernelCalculationCut) \
+  else if (kernel_id == ID) { \
+    if (mass_type) compute_eval<1>(eflag,vflag,SPH_KERNEL_NS::SPHKernelType<ID>()); \
+    else compute_eval<0>(eflag,vflag,SPH_KERNEL_NS::SPHKernelType<ID>()); \
+  }
+  #include "style_sph_kernel.h"
+  #undef SPH_KERNEL_CLASS
+  #undef SPHKernel
+
+  // positions change before the next computation
+  kernel_cache_reset();
 }
 
 /* ----------------------------------------------------------------------
@@ -354,8 +376,8 @@ void PairSphMorrisTenscorr::read_restart_settings(FILE *fp, const int major, con
    template compute
 ------------------------------------------------------------------------- */
 
-template <int MASSFLAG>
-void PairSphMorrisTenscorr::compute_eval(int eflag, int vflag)
+template <int MASSFLAG, class KERNEL>
+void PairSphMorrisTenscorr::compute_eval(int eflag, int vflag, const KERNEL &kernel)
 {
   int i,j,ii,jj,inum,jnum,itype,jtype;
   int *ilist,*jlist,*numneigh,**firstneigh;
@@ -389,6 +411,10 @@ void PairSphMorrisTenscorr::compute_eval(int eflag, int vflag)
 
   fgradP_ = fix_fgradP_->array_atom;
 
+  // per-pair kernel values computed by the sph fixes in this time step
+  // (only for per-type smoothing length, same cutoff as cutsq)
+  const SphKernelCache *kc = (MASSFLAG && !kernel_table) ? kernel_cache_valid(kernel_id) : NULL;
+
   if (modelStyle > 1) {
     dvdx_ = fix_dvdx_->array_atom;
     dvdy_ = fix_dvdy_->array_atom;
@@ -486,13 +512,24 @@ void PairSphMorrisTenscorr::compute_eval(int eflag, int vflag)
     // derivative of kernel must be 0 at s = 0
     // so particle itself is not contributing
 
-    for (jj = 0; jj < jnum; jj++) {
-      j = jlist[jj];
+    // with kernel cache only pairs inside the cutoff are visited
+
+    const int jbegin = kc ? kc->first[ii] : 0;
+    const int jend = kc ? kc->first[ii+1] : jnum;
+
+    for (jj = jbegin; jj < jend; jj++) {
+      if (kc) {
+        j = kc->jlist[jj];
+        delx = kc->del[jj][0];
+        dely = kc->del[jj][1];
+        delz = kc->del[jj][2];
+      } else {
+        j = jlist[jj];
+        delx = xtmp - x[j][0];
+        dely = ytmp - x[j][1];
+        delz = ztmp - x[j][2];
+      }
       jtype = type[j];
-
-      delx = xtmp - x[j][0];
-      dely = ytmp - x[j][1];
-      delz = ztmp - x[j][2];
       rsq = delx*delx + dely*dely + delz*delz;
 
       if (!MASSFLAG) {
@@ -500,7 +537,7 @@ void PairSphMorrisTenscorr::compute_eval(int eflag, int vflag)
         rcom = interpDist(radi,radj);
       }
 
-      if ((MASSFLAG && rsq < cutsq[itype][jtype]) || (!MASSFLAG && rsq < rcom*rcom)) {
+      if (kc || (MASSFLAG && rsq < cutsq[itype][jtype]) || (!MASSFLAG && rsq < rcom*rcom)) {
 
         if (MASSFLAG) {
           jmass = mass[jtype];
@@ -517,7 +554,7 @@ void PairSphMorrisTenscorr::compute_eval(int eflag, int vflag)
         //cut = slCom*SPH_KERNEL_NS::sph_kernel_cut(kernel_id);
 
         // get distance and normalized distance
-        r = sqrt(rsq);
+        r = kc ? kc->del[jj][3] : sqrt(rsq);
         if (r == 0.) {
           printf("Particle %i and %i are at same position (%f, %f, %f)\n",i,j,xtmp,ytmp,ztmp);
           error->one(FLERR,"Zero distance between SPH particles!");
@@ -526,7 +563,7 @@ void PairSphMorrisTenscorr::compute_eval(int eflag, int vflag)
         s = r * slComInv;
 
         // calculate value for magnitude of grad W
-        gradWmag = SPH_KERNEL_NS::sph_kernel_der(kernel_id,s,slCom,slComInv);
+        gradWmag = kc ? kc->dw[jj] : kernel.der(s,slCom,slComInv);
 
         // viscosity
         if (modelStyle == 1) {// Newtonian
@@ -557,11 +594,11 @@ void PairSphMorrisTenscorr::compute_eval(int eflag, int vflag)
           if (MASSFLAG) {
             wDeltaPinv = wDeltaPTypeinv[itype][jtype];
           } else {
-            wDeltaPinv = 1./SPH_KERNEL_NS::sph_kernel(kernel_id,deltaP * slComInv,slCom,slComInv);
+            wDeltaPinv = 1./kernel.w(deltaP * slComInv,slCom,slComInv);
           }
 
           //TODO: Is fAB4 in this form ok?!
-          fAB =  SPH_KERNEL_NS::sph_kernel(kernel_id,s,slCom,slComInv) * wDeltaPinv;
+          fAB =  (kc ? kc->w[jj] : kernel.w(s,slCom,slComInv)) * wDeltaPinv;
           fAB2 = fAB * fAB;
           fAB4 = fAB2 * fAB2;
         }
@@ -88,7 +88,7 @@ class PairSphMorrisTenscorr : public PairSph {
 //  void allocate_properties(int);
 //  double artificialViscosity(int, int, int, int, double, double, double, double, double, double, double, double **);
 //  template <int> void tensileCorrection(int, int, double, double, double, double, double, double, double, double &, double &);
-  template <int> void compute_eval(int, int);
+  template <int MASSFLAG, class KERNEL> void compute_eval(int, int, const KERNEL &);
 
   double  **wDeltaPTypeinv;
 
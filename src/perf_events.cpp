@@ -0,0 +1,189 @@
+/* ----------------------------------------------------------------------
+    This is the
+
+    ██╗     ██╗ ██████╗  ██████╗  ██████╗ ██╗  ██╗████████╗███████╗
+    ██║     ██║██╔════╝ ██╔════╝ ██╔════╝ ██║  ██║╚══██╔══╝██╔════╝
+    ██║     ██║██║  ███╗██║  ███╗██║  ███╗███████║   ██║   ███████╗
+    ██║     ██║██║   ██║██║   ██║██║   ██║██╔══██║   ██║   ╚════██║
+    ███████╗██║╚██████╔╝╚██████╔╝╚██████╔╝██║  ██║   ██║   ███████║
+    ╚══════╝╚═╝ ╚═════╝  ╚═════╝  ╚═════╝ ╚═╝  ╚═╝   ╚═╝   ╚══════╝®
+
+    DEM simulation engine, released by
+    DCS Computing Gmbh, Linz, Austria
+    http://www.dcs-computing.com, office@dcs-computing.com
+
+    LIGGGHTS® is part of CFDEM®project:
+    http://www.liggghts.com | http://www.cfdem.com
+
+    Core developer and main author:
+    Christoph Kloss, christoph.kloss@dcs-computing.com
+
+    LIGGGHTS® is open-source, distributed under the terms of the GNU Public
+    License, version 2 or later. It is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+    of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. You should have
+    received a copy of the GNU General Public License along with LIGGGHTS®.
+    If not, see http://www.gnu.org/licenses . See also top-level README
+    and LICENSE files.
+
+    LIGGGHTS® and CFDEM® are registered trade marks of DCS Computing GmbH,
+    the producer of the LIGGGHTS® software and the CFDEM®coupling software
+    See http://www.cfdem.com/terms-trademark-policy for details.
+
+-------------------------------------------------------------------------
+    Contributing author and copyright for this file:
+    (if not contributing author is listed, this file has been contributed
+    by the core developer)
+
+    Copyright 2012-     DCS Computing GmbH, Linz
+------------------------------------------------------------------------- */
+
+#include <mpi.h>
+#include <string.h>
+#include "perf_events.h"
+#include "comm.h"
+#include "error.h"
+
+#if defined(LAMMPS_PERF_EVENTS) && defined(__linux__)
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <linux/perf_event.h>
+#endif
+
+using namespace LAMMPS_NS;
+
+/* ---------------------------------------------------------------------- */
+
+PerfEvents::PerfEvents(LAMMPS *lmp) : Pointers(lmp)
+{
+  nopen = 0;
+  warned = false;
+  for (int i = 0; i < PERF_NCOUNTER; i++) fd[i] = slot[i] = -1;
+  memset(started,0,sizeof(started));
+  memset(begin,0,sizeof(begin));
+  memset(count,0,sizeof(count));
+  memset(ncall,0,sizeof(ncall));
+  memset(nscaled,0,sizeof(nscaled));
+}
+
+/* ---------------------------------------------------------------------- */
+
+PerfEvents::~PerfEvents()
+{
+  close();
+}
+
+/* ----------------------------------------------------------------------
+   open counter group for this process and reset counts
+   counters not supported by the CPU are skipped
+------------------------------------------------------------------------- */
+
+void PerfEvents::open()
+{
+  memset(started,0,sizeof(started));
+  memset(count,0,sizeof(count));
+  memset(ncall,0,sizeof(ncall));
+  memset(nscaled,0,sizeof(nscaled));
+
+#if defined(LAMMPS_PERF_EVENTS) && defined(__linux__)
+  if (nopen) return;
+
+  static const unsigned long long config[PERF_NCOUNTER] =
+    {PERF_COUNT_HW_CPU_CYCLES,PERF_COUNT_HW_INSTRUCTIONS,
+     PERF_COUNT_HW_CACHE_REFERENCES,PERF_COUNT_HW_CACHE_MISSES,
+     PERF_COUNT_HW_BRANCH_MISSES};
+
+  for (int i = 0; i < PERF_NCOUNTER; i++) {
+    struct perf_event_attr attr;
+    memset(&attr,0,sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.config = config[i];
+    attr.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED |
+      PERF_FORMAT_TOTAL_TIME_RUNNING;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    attr.disabled = (i == PERF_CYCLES);
+
+    fd[i] = syscall(__NR_perf_event_open,&attr,0,-1,fd[PERF_CYCLES],0);
+    if (fd[i] < 0) {
+      if (i == PERF_CYCLES) break;
+      continue;
+    }
+    slot[i] = nopen++;
+  }
+
+  if (fd[PERF_CYCLES] < 0) {
+    if (comm->me == 0 && !warned)
+      error->warning(FLERR,"Could not open hardware performance counters, "
+                     "perf regions are not counted");
+    warned = true;
+    return;
+  }
+
+  ioctl(fd[PERF_CYCLES],PERF_EVENT_IOC_RESET,PERF_IOC_FLAG_GROUP);
+  ioctl(fd[PERF_CYCLES],PERF_EVENT_IOC_ENABLE,PERF_IOC_FLAG_GROUP);
+#endif
+}
+
+/* ---------------------------------------------------------------------- */
+
+void PerfEvents::close()
+{
+#if defined(LAMMPS_PERF_EVENTS) && defined(__linux__)
+  for (int i = PERF_NCOUNTER-1; i >= 0; i--)
+    if (fd[i] >= 0) ::close(fd[i]);
+#endif
+  for (int i = 0; i < PERF_NCOUNTER; i++) fd[i] = slot[i] = -1;
+  nopen = 0;
+}
+
+/* ----------------------------------------------------------------------
+   print counts of all regions summed over procs
+   IPC = instructions per cycle, miss rate = cache misses per reference
+   counts of calls during which the counters were multiplexed are
+   scaled estimates
+------------------------------------------------------------------------- */
+
+void PerfEvents::print(FILE *scr, FILE *log)
+{
+  int open_any,open_me = fd[PERF_CYCLES] >= 0;
+  MPI_Allreduce(&open_me,&open_any,1,MPI_INT,MPI_MAX,world);
+  if (!open_any) return;
+
+  static const char *names[PERF_N] = {"Pair","Wall mesh","Neigh build"};
+
+  // counts followed by # of calls and # of scaled calls
+
+  double one[PERF_N][PERF_NCOUNTER+2],all[PERF_N][PERF_NCOUNTER+2];
+  for (int r = 0; r < PERF_N; r++) {
+    for (int i = 0; i < PERF_NCOUNTER; i++) one[r][i] = count[r][i];
+    one[r][PERF_NCOUNTER] = ncall[r];
+    one[r][PERF_NCOUNTER+1] = nscaled[r];
+  }
+  MPI_Allreduce(&one[0][0],&all[0][0],PERF_N*(PERF_NCOUNTER+2),
+                MPI_DOUBLE,MPI_SUM,world);
+
+  if (comm->me != 0) return;
+
+  for (int r = 0; r < PERF_N; r++) {
+    if (all[r][PERF_NCOUNTER] == 0.0) continue;
+    const double *c = all[r];
+    const double ipc = c[PERF_CYCLES] > 0.0 ?
+      c[PERF_INSTRUCTIONS]/c[PERF_CYCLES] : 0.0;
+    const double missrate = c[PERF_CACHE_REFERENCES] > 0.0 ?
+      100.0*c[PERF_CACHE_MISSES]/c[PERF_CACHE_REFERENCES] : 0.0;
+
+    for (int k = 0; k < 2; k++) {
+      FILE *fp = k ? log : scr;
+      if (!fp) continue;
+      fprintf(fp,"Perf %s: cycles = %g, instructions = %g, IPC = %g\n",
+              names[r],c[PERF_CYCLES],c[PERF_INSTRUCTIONS],ipc);
+      fprintf(fp,"  cache misses = %g (%g%% of refs), branch misses = %g\n",
+              c[PERF_CACHE_MISSES],missrate,c[PERF_BRANCH_MISSES]);
+      if (c[PERF_NCOUNTER+1] > 0.0)
+        fprintf(fp,"  counters multiplexed in %g of %g calls, "
+                "counts are scaled estimates\n",c[PERF_NCOUNTER+1],c[PERF_NCOUNTER]);
+    }
+  }
+}
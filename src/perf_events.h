@@ -0,0 +1,163 @@
+/* ----------------------------------------------------------------------
+    This is the
+
+    ██╗     ██╗ ██████╗  ██████╗  ██████╗ ██╗  ██╗████████╗███████╗
+    ██║     ██║██╔════╝ ██╔════╝ ██╔════╝ ██║  ██║╚══██╔══╝██╔════╝
+    ██║     ██║██║  ███╗██║  ███╗██║  ███╗███████║   ██║   ███████╗
+    ██║     ██║██║   ██║██║   ██║██║   ██║██╔══██║   ██║   ╚════██║
+    ███████╗██║╚██████╔╝╚██████╔╝╚██████╔╝██║  ██║   ██║   ███████║
+    ╚══════╝╚═╝ ╚═════╝  ╚═════╝  ╚═════╝ ╚═╝  ╚═╝   ╚═╝   ╚══════╝®
+
+    DEM simulation engine, released by
+    DCS Computing Gmbh, Linz, Austria
+    http://www.dcs-computing.com, office@dcs-computing.com
+
+    LIGGGHTS® is part of CFDEM®project:
+    http://www.liggghts.com | http://www.cfdem.com
+
+    Core developer and main author:
+    Christoph Kloss, christoph.kloss@dcs-computing.com
+
+    LIGGGHTS® is open-source, distributed under the terms of the GNU Public
+    License, version 2 or later. It is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+    of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. You should have
+    received a copy of the GNU General Public License along with LIGGGHTS®.
+    If not, see http://www.gnu.org/licenses . See also top-level README
+    and LICENSE files.
+
+    LIGGGHTS® and CFDEM® are registered trade marks of DCS Computing GmbH,
+    the producer of the LIGGGHTS® software and the CFDEM®coupling software
+    See http://www.cfdem.com/terms-trademark-policy for details.
+
+-------------------------------------------------------------------------
+    Contributing author and copyright for this file:
+    (if not contributing author is listed, this file has been contributed
+    by the core developer)
+
+    Copyright 2012-     DCS Computing GmbH, Linz
+------------------------------------------------------------------------- */
+
+/* ----------------------------------------------------------------------
+PerfEvents = hardware performance counters for hot code regions
+  counts cycles, instructions, cache references, cache misses and
+    branch misses of the calling process via perf_event_open
+  only compiled in with -DLAMMPS_PERF_EVENTS on Linux, start() and
+    stop() are empty otherwise
+  counters are only opened if fix timing is on (modify_timing on)
+  if the kernel refuses the counters (e.g. perf_event_paranoid),
+    a warning is printed and the regions are not counted
+  if the PMU multiplexes the group, counts are scaled by the ratio of
+    time enabled to time running, and print() says so
+  a region is not counted if one of its two reads fails
+methods:
+   void open() = open counters, called by Timer::init()
+   void start(region) = begin counting for region
+   void stop(region) = end counting for region and accumulate
+   void print(screen, logfile) = print counts summed over procs
+------------------------------------------------------------------------- */
+
+#ifndef LMP_PERF_EVENTS_H
+#define LMP_PERF_EVENTS_H
+
+#include "pointers.h"
+
+#if defined(LAMMPS_PERF_EVENTS) && defined(__linux__)
+#include <unistd.h>
+#endif
+
+// instrumented regions
+
+enum{PERF_PAIR,PERF_WALL_MESH,PERF_NEIGH_BUILD,PERF_N};
+
+// counters, PERF_CYCLES is the group leader
+
+enum{PERF_CYCLES,PERF_INSTRUCTIONS,PERF_CACHE_REFERENCES,
+     PERF_CACHE_MISSES,PERF_BRANCH_MISSES,PERF_NCOUNTER};
+
+// a read also returns the time the group was enabled and running
+
+enum{PERF_TIME_ENABLED = PERF_NCOUNTER,PERF_TIME_RUNNING,PERF_NREAD};
+
+namespace LAMMPS_NS {
+
+class PerfEvents : protected Pointers {
+ public:
+  PerfEvents(class LAMMPS *);
+  ~PerfEvents();
+
+  void open();
+  void close();
+  void print(FILE *, FILE *);
+
+#if defined(LAMMPS_PERF_EVENTS) && defined(__linux__)
+  inline void start(int region) {
+    if (fd[PERF_CYCLES] >= 0) started[region] = read_counters(begin[region]);
+  }
+
+  inline void stop(int region) {
+    if (fd[PERF_CYCLES] < 0 || !started[region]) return;
+    started[region] = false;
+    long long now[PERF_NREAD];
+    if (!read_counters(now)) return;
+
+    // scale for the time the group was multiplexed out
+    // nothing was counted if it was not running at all
+
+    const long long enabled = now[PERF_TIME_ENABLED] - begin[region][PERF_TIME_ENABLED];
+    const long long running = now[PERF_TIME_RUNNING] - begin[region][PERF_TIME_RUNNING];
+    if (running <= 0) return;
+    const double scale = static_cast<double>(enabled)/running;
+    if (running < enabled) nscaled[region]++;
+
+    for (int i = 0; i < PERF_NCOUNTER; i++)
+      count[region][i] += static_cast<long long>(scale*(now[i]-begin[region][i]) + 0.5);
+    ncall[region]++;
+  }
+#else
+  inline void start(int) {}
+  inline void stop(int) {}
+#endif
+
+ private:
+  int fd[PERF_NCOUNTER];             // file descriptor per counter, -1 if not open
+  int slot[PERF_NCOUNTER];           // position in group read, -1 if not open
+  int nopen;                         // # of open counters
+  bool warned;                       // warned about counters not opening
+  bool started[PERF_N];               // begin[] of region was read successfully
+  long long begin[PERF_N][PERF_NREAD];
+  long long count[PERF_N][PERF_NCOUNTER];
+  long long ncall[PERF_N];
+  long long nscaled[PERF_N];          // # of calls with multiplexed counters
+
+#if defined(LAMMPS_PERF_EVENTS) && defined(__linux__)
+  inline bool read_counters(long long *values) {
+
+    // group read: number of values, time enabled, time running, then
+    // the values in the order the counters were added to the group
+
+    long long buf[3+PERF_NCOUNTER];
+    const ssize_t nbytes = ::read(fd[PERF_CYCLES],buf,sizeof(buf));
+    if (nbytes < static_cast<ssize_t>((3+nopen)*sizeof(long long))) return false;
+    values[PERF_TIME_ENABLED] = buf[1];
+    values[PERF_TIME_RUNNING] = buf[2];
+    for (int i = 0; i < PERF_NCOUNTER; i++)
+      values[i] = slot[i] >= 0 ? buf[3+slot[i]] : 0;
+    return true;
+  }
+#endif
+};
+
+}
+
+#endif
+
+/* ERROR/WARNING messages:
+
+W: Could not open hardware performance counters, perf regions are not counted
+
+The perf_event_open system call failed, e.g. because
+/proc/sys/kernel/perf_event_paranoid does not allow it or because
+the code runs in a virtual machine without a PMU.
+
+*/
@@ -46,6 +46,7 @@
 
 #include "container.h"
 #include "neighbor.h"
+#include "memory.h"
 #include "primitive_wall_definitions.h"
 
 namespace LAMMPS_NS
@@ -60,7 +61,7 @@ namespace LAMMPS_NS
       public:
 
         PrimitiveWall(LAMMPS *lmp,PRIMITIVE_WALL_DEFINITIONS::WallType wType_, int nParam_, double *param_)
-        : Pointers(lmp), neighlist("neighlist"), wType(wType_), nParam(nParam_)
+        : Pointers(lmp), neighlist(0), nNeigh(0), maxNeigh(0), wType(wType_), nParam(nParam_)
         {
             param = new double[nParam];
             for(int i=0;i<nParam;i++)
@@ -70,6 +71,7 @@ namespace LAMMPS_NS
         virtual ~PrimitiveWall()
         {
             delete []param;
+            memory->destroy(neighlist);
         }
 
         inline int getNeighbors(int *&contactPtr);
@@ -82,13 +84,25 @@ namespace LAMMPS_NS
         inline double resolveContact(double *x, double r, double *delta);
         inline bool resolveNeighlist(double *x, double r, double treshold);
 
+        // batched versions, dispatched once per call on the wall type
+        // resolveContacts fills deltan[k] and delta[k] for particle list[k]
+        inline void resolveContacts(int n, const int *list, double **x, const double *r,
+                                    double r0, double *deltan, double **delta);
+
         inline int axis();
         inline double calcRadialDistance(double *pos, double *distvec);
 
         inline int isNear(int iPart,double treshold);
 
       private:
-        ScalarContainer<int> neighlist;
+        template<class W>
+        inline void buildNeighListTemplate(double treshold, double **x, double *r, int nPart);
+        template<class W>
+        inline void resolveContactsTemplate(int n, const int *list, double **x, const double *r,
+                                            double r0, double *deltan, double **delta);
+
+        int *neighlist;
+        int nNeigh, maxNeigh;
         PRIMITIVE_WALL_DEFINITIONS::WallType wType;
 
         double *param;
@@ -122,21 +136,87 @@ namespace LAMMPS_NS
 
   int PrimitiveWall::getNeighbors(int *&contactPtr)
   {
-    contactPtr = neighlist.begin();
-    return neighlist.size();
+    contactPtr = neighlist;
+    return nNeigh;
+  }
+
+  /* ---------------------------------------------------------------------- */
+
+  template<class W>
+  void PrimitiveWall::buildNeighListTemplate(double treshold, double **x, double *r, int nPart)
+  {
+    if(nPart > maxNeigh)
+    {
+      maxNeigh = atom->nmax;
+      memory->destroy(neighlist);
+      memory->create(neighlist,maxNeigh,"primitive_wall:neighlist");
+    }
+
+    // x is contiguous, branch-free compaction of the neighbor indices
+
+    double *xp = nPart > 0 ? x[0] : 0;
+    int n = 0;
+    for(int iPart = 0; iPart < nPart; iPart++)
+    {
+      neighlist[n] = iPart;
+      n += W::resolveNeighlist(&xp[3*iPart],r?r[iPart]:0.,treshold,param) ? 1 : 0;
+    }
+    nNeigh = n;
   }
 
+  /* ---------------------------------------------------------------------- */
+
   void PrimitiveWall::buildNeighList(double treshold, double **x, double *r, int nPart)
   {
-    neighlist.clearContainer();
-    for(int iPart=0;iPart<nPart;iPart++)
+    using namespace PRIMITIVE_WALL_DEFINITIONS;
+
+    switch(wType)
     {
-      
-      if(resolveNeighlist(x[iPart],r?r[iPart]:0.,treshold))
-        neighlist.add(iPart);
+      case XPLANE:    buildNeighListTemplate<Plane<0> >(treshold,x,r,nPart); break;
+      case YPLANE:    buildNeighListTemplate<Plane<1> >(treshold,x,r,nPart); break;
+      case ZPLANE:    buildNeighListTemplate<Plane<2> >(treshold,x,r,nPart); break;
+      case XCYLINDER: buildNeighListTemplate<Cylinder<0> >(treshold,x,r,nPart); break;
+      case YCYLINDER: buildNeighListTemplate<Cylinder<1> >(treshold,x,r,nPart); break;
+      case ZCYLINDER: buildNeighListTemplate<Cylinder<2> >(treshold,x,r,nPart); break;
+      default:        buildNeighListTemplate<NoWall>(treshold,x,r,nPart); break;
     }
   }
 
+  /* ---------------------------------------------------------------------- */
+
+  template<class W>
+  void PrimitiveWall::resolveContactsTemplate(int n, const int *list, double **x, const double *r,
+                                              double r0, double *deltan, double **delta)
+  {
+    double *xp = n > 0 ? x[0] : 0;
+    for(int k = 0; k < n; k++)
+    {
+      const int iPart = list[k];
+      deltan[k] = W::resolveContact(&xp[3*iPart],r?r[iPart]:r0,delta[k],param);
+    }
+  }
+
+  /* ---------------------------------------------------------------------- */
+
+  void PrimitiveWall::resolveContacts(int n, const int *list, double **x, const double *r,
+                                      double r0, double *deltan, double **delta)
+  {
+    using namespace PRIMITIVE_WALL_DEFINITIONS;
+
+    switch(wType)
+    {
+      case XPLANE:    resolveContactsTemplate<Plane<0> >(n,list,x,r,r0,deltan,delta); break;
+      case YPLANE:    resolveContactsTemplate<Plane<1> >(n,list,x,r,r0,deltan,delta); break;
+      case ZPLANE:    resolveContactsTemplate<Plane<2> >(n,list,x,r,r0,deltan,delta); break;
+      case XCYLINDER: resolveContactsTemplate<Cylinder<0> >(n,list,x,r,r0,deltan,delta); break;
+      case YCYLINDER: resolveContactsTemplate<Cylinder<1> >(n,list,x,r,r0,deltan,delta); break;
+      case ZCYLINDER: resolveContactsTemplate<Cylinder<2> >(n,list,x,r,r0,deltan,delta); break;
+      default:        resolveContactsTemplate<NoWall>(n,list,x,r,r0,deltan,delta); break;
+    }
+  }
+
+  /* ---------------------------------------------------------------------- */
+
   int PrimitiveWall::isNear(int iPart,double treshold)
   {
     if(resolveNeighlist(atom->x[iPart],atom->radius?atom->radius[iPart]:0.,treshold))
@@ -202,6 +202,19 @@ namespace LAMMPS_NS
 
     };
 
+/* ---------------------------------------------------------------------- */
+
+    /*
+     * fallback for unknown wall types, same as the defaults above
+     */
+    struct NoWall
+    {
+      static double resolveContact(double *, double, double *, double *)
+      { return 1.; }
+      static bool resolveNeighlist(double *, double, double, double *)
+      { return true; }
+    };
+
 /* ---------------------------------------------------------------------- */
 
     /*
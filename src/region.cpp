@@ -530,6 +530,12 @@ inline void Region::rand_bounds(bool subdomain_flag, double *lo, double *hi)
 
 void Region::generate_random(double *pos,bool subdomain_flag)
 {
+    if(use_direct_sampling(subdomain_flag,0.))
+    {
+        while(!sample_direct(pos,0.,random) || (subdomain_flag && !domain->is_in_subdomain(pos)));
+        return;
+    }
+
     double lo[3],hi[3],diff[3];
     rand_bounds(subdomain_flag,lo,hi);
     vectorSubtract3D(hi,lo,diff);
@@ -543,6 +549,44 @@ void Region::generate_random(double *pos,bool subdomain_flag)
     
 }
 
+/* ----------------------------------------------------------------------
+   draw a point from the direct sampler of the region style
+   if region has variable shape, update it as match() does
+   if region is dynamic, move the point from the untransformed region
+------------------------------------------------------------------------- */
+
+int Region::sample_direct(double *pos,double cut,RanPark *ranpark)
+{
+    if (varshape && update->ntimestep != lastshape) {
+        shape_update();
+        lastshape = update->ntimestep;
+    }
+
+    if(!sample_interior(pos,cut,ranpark)) return 0;
+
+    if (dynamic) forward_transform(pos[0],pos[1],pos[2]);
+    return 1;
+}
+
+/* ----------------------------------------------------------------------
+   decide between direct sampling and rejection sampling of the bbox
+   (restricted to the subdomain if requested)
+   both need on average V(region & subdomain) / V(set sampled from) draws
+     per accepted point, so use the one that samples the smaller set
+------------------------------------------------------------------------- */
+
+bool Region::use_direct_sampling(bool subdomain_flag,double cut)
+{
+    double vol_direct = sample_volume(cut);
+    if(vol_direct <= 0.) return false;
+
+    double lo[3],hi[3];
+    rand_bounds(subdomain_flag,lo,hi);
+    double vol_box = (hi[0]-lo[0]) * (hi[1]-lo[1]) * (hi[2]-lo[2]);
+
+    return vol_direct < vol_box;
+}
+
 /* ---------------------------------------------------------------------- */
 
 // generates a random point within the region and has a min distance from surface
@@ -560,6 +604,13 @@ void Region::generate_random_shrinkby_cut(double *pos,double cut,bool subdomain_
         error->one(FLERR,"Impossible to generate random points within region - region too small "
         "(smaller than twice the particle cutoff)");
 
+    if(use_direct_sampling(subdomain_flag,cut))
+    {
+        while(!sample_direct(pos,cut,random) || (subdomain_flag && !domain->is_in_subdomain(pos)) ||
+              match_cut(pos,cut));
+        return;
+    }
+
     do
     {
         pos[0] = lo[0] + random->uniform()*diff[0];
@@ -633,8 +684,7 @@ int Region::match_shrinkby_cut(double *pos,double cut)
 
 void Region::volume_mc(int n_test,bool cutflag,double cut,double &vol_global,double &vol_local)
 {
-    double pos[3],vol_bbox, vol_local_all;
-    int n_in_local = 0, n_in_global = 0, n_in_global_all;
+    double vol_local_all, vol_exact = 0.;
 
     // impossible to calculate volume if bbox non-existent
     if(!bboxflag)
@@ -644,50 +694,40 @@ void Region::volume_mc(int n_test,bool cutflag,double cut,double &vol_global,dou
         return;
     }
 
-    for(int i = 0; i < n_test; i++)
-    {
-        pos[0] = extent_xlo + random->uniform() * (extent_xhi - extent_xlo);
-        pos[1] = extent_ylo + random->uniform() * (extent_yhi - extent_ylo);
-        pos[2] = extent_zlo + random->uniform() * (extent_zhi - extent_zlo);
+    // use exact volume if region is static and fully inside the domain
+    // (a wedge domain does not contain all of its bounding box)
+    // the local volume is exact as well if the style supports it or
+    // if there is only one proc and no cut
 
-        if(!domain->is_in_domain(pos)) continue;
+    bool exact_global = !dynamic && !varshape && !domain->is_wedge &&
+                        !bbox_extends_outside_box() && volume_analytic(vol_exact);
+    bool exact_local = false;
 
-        // point is in region
-        // assume every proc can evaluate this
-        
-        if(!cutflag)
-        {
-            if(match(pos[0],pos[1],pos[2]))
-            {
-                n_in_global++;
-                if(domain->is_in_subdomain(pos))
-                    n_in_local++;
-            }
-        }
-        else
+    if(exact_global)
+    {
+        vol_global = vol_exact;
+        if(!cutflag && comm->nprocs == 1)
         {
-            if(match(pos[0],pos[1],pos[2]))
-            {
-                n_in_global++;
-                if(domain->is_in_subdomain(pos) && !match_cut(pos,cut) )
-                    n_in_local++;
-            }
+            vol_local = vol_exact;
+            exact_local = true;
         }
+        else exact_local = volume_local_analytic(cutflag,cut,vol_local);
+    }
+
+    if(!exact_local)
+    {
+        double vol_in_local;
+        volume_sample_subdomain(n_test,cutflag,cut,vol_in_local,vol_local);
+        if(!exact_global)
+            MPI_Sum_Scalar(vol_in_local,vol_global,world);
     }
 
-    MPI_Sum_Scalar(n_in_global,n_in_global_all,world);
-    if(n_in_global_all == 0)
+    if(vol_global == 0.)
         error->all(FLERR,"Unable to calculate region volume. Possible sources of error: \n"
                          "   (a) region volume is too small or out of domain (you may want to increase the 'volume_limit' in the input script)\n"
                          "   (b) particles for insertion are too large when using all_in yes\n"
                          "   (c) region is 2d, but should be 3d");
 
-    vol_bbox = (extent_xhi - extent_xlo) * (extent_yhi - extent_ylo) * (extent_zhi - extent_zlo);
-
-    // return calculated values
-    vol_global = static_cast<double>(n_in_global_all)/static_cast<double>(n_test*comm->nprocs) * vol_bbox;
-    vol_local  = static_cast<double>(n_in_local )/static_cast<double>(n_test) * vol_bbox;
-
     MPI_Sum_Scalar(vol_local,vol_local_all,world);
 
     if(vol_local_all < volume_limit_)
@@ -696,8 +736,80 @@ void Region::volume_mc(int n_test,bool cutflag,double cut,double &vol_global,dou
                          "   (b) particles for insertion are too large when using all_in yes\n"
                          "   (c) region is 2d, but should be 3d\n");
 
+    // local volumes are cut-adjusted, scale so they add up to vol_global
+
     vol_local *= (vol_global/vol_local_all);
-    
+}
+
+/* ----------------------------------------------------------------------
+   MC estimate of the volume of the region in this proc's subdomain
+   vol_in = volume inside region and domain
+   vol_in_cut = same, but excluding points within cut of the surface
+     (equal to vol_in if cutflag is false)
+   each proc only samples the intersection of the region bbox with its
+     subdomain, using a number of points proportional to this volume,
+     so n_test points are distributed over all procs in total
+   points are taken from the additive recurrence (Kronecker) sequence
+     based on the generalized golden ratio in 3d, which converges faster
+     than random sampling, costs one add per coordinate and leaves the
+     region's random generator alone
+------------------------------------------------------------------------- */
+
+void Region::volume_sample_subdomain(int n_test,bool cutflag,double cut,
+                                     double &vol_in,double &vol_in_cut)
+{
+    double pos[3],lo[3],hi[3],len[3];
+    int n_in = 0, n_in_cut = 0;
+
+    vol_in = vol_in_cut = 0.;
+
+    vectorConstruct3D(lo,extent_xlo,extent_ylo,extent_zlo);
+    vectorConstruct3D(hi,extent_xhi,extent_yhi,extent_zhi);
+    double vol_bbox = (hi[0]-lo[0]) * (hi[1]-lo[1]) * (hi[2]-lo[2]);
+    if(vol_bbox <= 0.) return;
+
+    // sub-box in lamda coords for triclinic, so sample whole bbox then
+
+    if(!domain->triclinic)
+    {
+        for(int dim = 0; dim < 3; dim++)
+        {
+            lo[dim] = std::max(lo[dim],domain->sublo[dim]);
+            hi[dim] = std::min(hi[dim],domain->subhi[dim]);
+            if(lo[dim] >= hi[dim]) return;
+        }
+    }
+
+    vectorSubtract3D(hi,lo,len);
+    double vol_sample = len[0]*len[1]*len[2];
+    int n_sample = static_cast<int>(ceil(static_cast<double>(n_test)*vol_sample/vol_bbox));
+    if(n_sample < 1) n_sample = 1;
+
+    // g = root of g^4 = g + 1, sequence is u_i = frac(0.5 + i*alpha)
+
+    const double g = 1.22074408460575947536;
+    const double alpha[3] = { 1./g, 1./(g*g), 1./(g*g*g) };
+    double u[3] = { 0.5, 0.5, 0.5 };
+
+    for(int i = 0; i < n_sample; i++)
+    {
+        for(int dim = 0; dim < 3; dim++)
+        {
+            u[dim] += alpha[dim];
+            if(u[dim] >= 1.) u[dim] -= 1.;
+            pos[dim] = lo[dim] + u[dim] * len[dim];
+        }
+
+        if(!domain->is_in_domain(pos) || !domain->is_in_subdomain(pos)) continue;
+        if(!match(pos[0],pos[1],pos[2])) continue;
+
+        n_in++;
+        if(!cutflag || !match_cut(pos,cut))
+            n_in_cut++;
+    }
+
+    vol_in     = static_cast<double>(n_in)    /static_cast<double>(n_sample) * vol_sample;
+    vol_in_cut = static_cast<double>(n_in_cut)/static_cast<double>(n_sample) * vol_sample;
 }
 
 /* ---------------------------------------------------------------------- */
@@ -707,5 +819,15 @@ int Region::bbox_extends_outside_box()
     double min[3],max[3];
     vectorConstruct3D(min,extent_xlo+SMALL,extent_ylo+SMALL,extent_zlo+SMALL);
     vectorConstruct3D(max,extent_xhi-SMALL,extent_yhi-SMALL,extent_zhi-SMALL);
+
+    // corners of the box are not part of a wedge domain, compare bounds
+    if(domain->is_wedge)
+    {
+        for(int idim = 0; idim < 3; idim++)
+            if(min[idim] < domain->boxlo[idim] || max[idim] > domain->boxhi[idim])
+                return 1;
+        return 0;
+    }
+
     return (!(domain->is_in_domain(min)) || !(domain->is_in_domain(max)));
 }
@@ -99,6 +99,16 @@ class Region : protected Pointers {
   // generates a random point within the region
   virtual void generate_random(double *,bool subdomain_flag);
 
+  // draw a point from the region's direct sampler, see sample_interior()
+  // returns 0 if the point was rejected and the caller has to draw again
+  // random numbers are taken from the generator passed in, so sub-regions
+  // of union/intersect use the (per-proc seeded) generator of the parent
+  int sample_direct(double *,double,class RanPark *);
+
+  // volume of the set sample_interior() draws from if asked for points
+  // further than cut from the surface, 0 if style has no direct sampler
+  virtual double sample_volume(double) { return 0.; }
+
   // generate a point inside region OR within cut distance from surface
   virtual void generate_random_expandby_cut(double *,double,bool subdomain_flag);
 
@@ -114,9 +124,16 @@ class Region : protected Pointers {
   // inside region OR within a minimum distance from surface
   int match_shrinkby_cut(double *,double);
 
-  // volume calculation based on MC
+  // volume calculation, analytic where possible, else based on MC
   virtual void volume_mc(int n_test,bool cutflag,double cut,double &vol_global,double &vol_local);
 
+  // exact volume of the region, returns 0 if not available for the style
+  virtual int volume_analytic(double &) { return 0; }
+
+  // exact volume of the region in this proc's subdomain, optionally shrunk
+  // by cut, returns 0 if not available for the style
+  virtual int volume_local_analytic(bool,double,double &) { return 0; }
+
   // flag if region bbox extends outside simulation domain
   virtual int bbox_extends_outside_box();
 
@@ -128,6 +145,10 @@ class Region : protected Pointers {
   virtual void shape_update() {}
   virtual void pretransform();
 
+  // draw a point uniformly from the untransformed region, or from a
+  // superset of it shrunk by cut, returns 0 if point was rejected
+  virtual int sample_interior(double *, double, class RanPark *) { return 0; }
+
  protected:
   void add_contact(int, double *, double, double, double);
   void options(int, char **);
@@ -145,6 +166,8 @@ class Region : protected Pointers {
   double dx,dy,dz,theta;
   bigint lastshape,lastdynamic;
 
+  void volume_sample_subdomain(int,bool,double,double &,double &);
+  bool use_direct_sampling(bool,double);
   void forward_transform(double &, double &, double &);
   void inverse_transform(double &, double &, double &);
   void rotate(double &, double &, double &, const double);
@@ -43,9 +43,11 @@
     the GNU General Public License.
 ------------------------------------------------------------------------- */
 
+#include <algorithm>
 #include <stdlib.h>
 #include <string.h>
 #include "region_block.h"
+#include "random_park.h"
 #include "domain.h"
 #include "error.h"
 #include "force.h"
@@ -257,3 +259,61 @@ int RegBlock::surface_exterior(double *x, double cutoff)
   if (contact[0].r < cutoff) return 1;
   return 0;
 }
+
+/* ----------------------------------------------------------------------
+   exact volume of block
+------------------------------------------------------------------------- */
+
+int RegBlock::volume_analytic(double &vol)
+{
+  if (!interior) return 0;
+  vol = (xhi-xlo) * (yhi-ylo) * (zhi-zlo);
+  return 1;
+}
+
+/* ----------------------------------------------------------------------
+   exact volume of block shrunk by cut inside this proc's subdomain
+------------------------------------------------------------------------- */
+
+int RegBlock::volume_local_analytic(bool cutflag, double cut, double &vol)
+{
+  if (!interior || domain->triclinic) return 0;
+
+  double delta = cutflag ? cut : 0.0;
+  double lo[3] = {xlo+delta,ylo+delta,zlo+delta};
+  double hi[3] = {xhi-delta,yhi-delta,zhi-delta};
+
+  vol = 1.0;
+  for (int dim = 0; dim < 3; dim++) {
+    double len = std::min(hi[dim],domain->subhi[dim]) -
+                 std::max(lo[dim],domain->sublo[dim]);
+    if (len <= 0.0) {
+      vol = 0.0;
+      break;
+    }
+    vol *= len;
+  }
+  return 1;
+}
+
+/* ----------------------------------------------------------------------
+   direct sampling of block shrunk by cut
+------------------------------------------------------------------------- */
+
+double RegBlock::sample_volume(double cut)
+{
+  if (!interior) return 0.0;
+  double lx = xhi-xlo-2.0*cut;
+  double ly = yhi-ylo-2.0*cut;
+  double lz = zhi-zlo-2.0*cut;
+  if (lx <= 0.0 || ly <= 0.0 || lz <= 0.0) return 0.0;
+  return lx*ly*lz;
+}
+
+int RegBlock::sample_interior(double *pos, double cut, RanPark *ranpark)
+{
+  pos[0] = xlo+cut + ranpark->uniform()*(xhi-xlo-2.0*cut);
+  pos[1] = ylo+cut + ranpark->uniform()*(yhi-ylo-2.0*cut);
+  pos[2] = zlo+cut + ranpark->uniform()*(zhi-zlo-2.0*cut);
+  return 1;
+}
@@ -65,6 +65,10 @@ class RegBlock : public Region {
   int inside(double, double, double);
   int surface_interior(double *, double);
   int surface_exterior(double *, double);
+  int volume_analytic(double &);
+  int volume_local_analytic(bool, double, double &);
+  double sample_volume(double);
+  int sample_interior(double *, double, class RanPark *);
 
  private:
   double xlo,xhi,ylo,yhi,zlo,zhi;
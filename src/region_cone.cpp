@@ -51,6 +51,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include "region_cone.h"
+#include "random_park.h"
 #include "domain.h"
 #include "error.h"
 #include "force.h"
@@ -615,3 +616,65 @@ double RegCone::dotproduct(double *v1, double *v2)
 {
   return (v1[0]*v2[0] + v1[1]*v2[1] + v1[2]*v2[2]);
 }
+
+/* ----------------------------------------------------------------------
+   exact volume of cone frustum
+------------------------------------------------------------------------- */
+
+int RegCone::volume_analytic(double &vol)
+{
+  if (!interior) return 0;
+  vol = M_PI/3.0 * (hi-lo) *
+    (radiuslo*radiuslo + radiuslo*radiushi + radiushi*radiushi);
+  return 1;
+}
+
+/* ----------------------------------------------------------------------
+   direct sampling of cone, cut is not applied
+   position along axis from inverse of cumulative cross-section area,
+     r(h)^3 is linear in the cumulative volume
+------------------------------------------------------------------------- */
+
+double RegCone::sample_volume(double)
+{
+  if (!interior) return 0.0;
+  double vol;
+  volume_analytic(vol);
+  return vol;
+}
+
+int RegCone::sample_interior(double *pos, double, RanPark *ranpark)
+{
+  double rlo3 = radiuslo*radiuslo*radiuslo;
+  double rhi3 = radiushi*radiushi*radiushi;
+  double u = ranpark->uniform();
+  double h,rh;
+
+  if (radiuslo == radiushi) {
+    h = lo + u*(hi-lo);
+    rh = radiuslo;
+  } else {
+    rh = cbrt(rlo3 + u*(rhi3-rlo3));
+    h = lo + (rh-radiuslo)/(radiushi-radiuslo) * (hi-lo);
+  }
+
+  double r = rh * sqrt(ranpark->uniform());
+  double phi = 2.0*M_PI * ranpark->uniform();
+  double del1 = r*cos(phi);
+  double del2 = r*sin(phi);
+
+  if (axis == 'x') {
+    pos[0] = h;
+    pos[1] = c1 + del1;
+    pos[2] = c2 + del2;
+  } else if (axis == 'y') {
+    pos[0] = c1 + del1;
+    pos[1] = h;
+    pos[2] = c2 + del2;
+  } else {
+    pos[0] = c1 + del1;
+    pos[1] = c2 + del2;
+    pos[2] = h;
+  }
+  return 1;
+}
@@ -63,6 +63,9 @@ class RegCone : public Region {
   int inside(double, double, double);
   int surface_interior(double *, double);
   int surface_exterior(double *, double);
+  int volume_analytic(double &);
+  double sample_volume(double);
+  int sample_interior(double *, double, class RanPark *);
 
  private:
   char axis;
@@ -47,6 +47,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include "region_cylinder.h"
+#include "random_park.h"
 #include "update.h"
 #include "domain.h"
 #include "input.h"
@@ -489,3 +490,48 @@ void RegCylinder::variable_check()
   if (!input->variable->equalstyle(rvar))
     error->all(FLERR,"Variable for region cylinder is invalid style");
 }
+
+/* ----------------------------------------------------------------------
+   exact volume of cylinder
+------------------------------------------------------------------------- */
+
+int RegCylinder::volume_analytic(double &vol)
+{
+  if (!interior) return 0;
+  vol = M_PI * radius*radius * (hi-lo);
+  return 1;
+}
+
+/* ----------------------------------------------------------------------
+   direct sampling of cylinder shrunk by cut
+------------------------------------------------------------------------- */
+
+double RegCylinder::sample_volume(double cut)
+{
+  if (!interior || radius <= cut || hi-lo <= 2.0*cut) return 0.0;
+  return M_PI * (radius-cut)*(radius-cut) * (hi-lo-2.0*cut);
+}
+
+int RegCylinder::sample_interior(double *pos, double cut, RanPark *ranpark)
+{
+  double r = (radius-cut) * sqrt(ranpark->uniform());
+  double phi = 2.0*M_PI * ranpark->uniform();
+  double del1 = r*cos(phi);
+  double del2 = r*sin(phi);
+  double h = lo+cut + ranpark->uniform()*(hi-lo-2.0*cut);
+
+  if (axis == 'x') {
+    pos[0] = h;
+    pos[1] = c1 + del1;
+    pos[2] = c2 + del2;
+  } else if (axis == 'y') {
+    pos[0] = c1 + del1;
+    pos[1] = h;
+    pos[2] = c2 + del2;
+  } else {
+    pos[0] = c1 + del1;
+    pos[1] = c2 + del2;
+    pos[2] = h;
+  }
+  return 1;
+}
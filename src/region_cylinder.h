@@ -66,6 +66,9 @@ class RegCylinder : public Region {
   int inside(double, double, double);
   int surface_interior(double *, double);
   int surface_exterior(double *, double);
+  int volume_analytic(double &);
+  double sample_volume(double);
+  int sample_interior(double *, double, class RanPark *);
   void shape_update();
 
  private:
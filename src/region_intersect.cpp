@@ -46,6 +46,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include "region_intersect.h"
+#include "random_park.h"
 #include "domain.h"
 #include "error.h"
 #include "force.h"
@@ -285,3 +286,41 @@ void RegIntersect::shape_update()
   for (int ilist = 0; ilist < nregion; ilist++)
     regions[list[ilist]]->shape_update();
 }
+
+/* ----------------------------------------------------------------------
+   direct sampling of intersection
+   draw from the sub-region with the smallest direct sampler and keep
+     the point if it is in all other sub-regions
+   shrinking a sub-region by cut keeps the intersection shrunk by cut
+------------------------------------------------------------------------- */
+
+double RegIntersect::sample_volume(double cut)
+{
+  if (!interior) return 0.0;
+
+  Region **regions = domain->regions;
+  double vol = 0.0;
+  for (int ilist = 0; ilist < nregion; ilist++) {
+    double vol_sub = regions[list[ilist]]->sample_volume(cut);
+    if (vol_sub > 0.0 && (vol == 0.0 || vol_sub < vol)) vol = vol_sub;
+  }
+  return vol;
+}
+
+int RegIntersect::sample_interior(double *pos, double cut, RanPark *ranpark)
+{
+  Region **regions = domain->regions;
+  int ichosen = -1;
+  double vol = 0.0;
+  for (int ilist = 0; ilist < nregion; ilist++) {
+    double vol_sub = regions[list[ilist]]->sample_volume(cut);
+    if (vol_sub > 0.0 && (vol == 0.0 || vol_sub < vol)) {
+      vol = vol_sub;
+      ichosen = ilist;
+    }
+  }
+  if (ichosen < 0) return 0;
+
+  if (!regions[list[ichosen]]->sample_direct(pos,cut,ranpark)) return 0;
+  return inside(pos[0],pos[1],pos[2]);
+}
@@ -113,6 +113,11 @@ RegTetMesh::RegTetMesh(LAMMPS *lmp, int narg, char **arg) :
 
   volume = NULL;
   acc_volume = NULL;
+  n_tet_sub = -1;
+  tet_sub = NULL;
+  acc_volume_sub = NULL;
+  vectorZeroize3D(sublo_cdf);
+  vectorZeroize3D(subhi_cdf);
   nTet = 0;
   nTetMax = 0;
   total_volume = 0.;
@@ -153,6 +158,8 @@ RegTetMesh::~RegTetMesh()
   memory->destroy(center);
   memory->sfree(volume);
   memory->sfree(acc_volume);
+  memory->destroy(tet_sub);
+  memory->destroy(acc_volume_sub);
 }
 
 /* ----------------------------------------------------------------------
@@ -215,10 +222,10 @@ void RegTetMesh::generate_random(double *pos,bool subdomain_flag)
 
     do
     {
-        mesh_randpos(pos);
+        mesh_randpos(pos,subdomain_flag);
         ntry++;
     }
-    while(ntry < 10000 && (!subdomain_flag || !domain->is_in_subdomain(pos)));
+    while(ntry < 10000 && subdomain_flag && !domain->is_in_subdomain(pos));
 
     if(10000 == ntry)
         error->one(FLERR,"internal error");
@@ -243,7 +250,7 @@ void RegTetMesh::generate_random_shrinkby_cut(double *pos,double cut,bool subdom
     {
        ntry++;
        
-       int iTetChosen = mesh_randpos(pos);
+       int iTetChosen = mesh_randpos(pos,subdomain_flag);
        is_near_surface = false;
        double delta[3];
 
@@ -299,7 +306,7 @@ void RegTetMesh::generate_random_shrinkby_cut(double *pos,double cut,bool subdom
        }
     }
     // pos has to be within region, and within cut of region surface
-    while(ntry < 10000 && (is_near_surface || (!subdomain_flag || !domain->is_in_subdomain(pos))));
+    while(ntry < 10000 && (is_near_surface || (subdomain_flag && !domain->is_in_subdomain(pos))));
 
     if(10000 == ntry)
     {
@@ -768,9 +775,9 @@ inline void RegTetMesh::set_extent_region()
 
 /* ---------------------------------------------------------------------- */
 
-inline int RegTetMesh::mesh_randpos(double *pos)
+inline int RegTetMesh::mesh_randpos(double *pos,bool subdomain_flag)
 {
-    int iTriChosen = tet_rand_tri();
+    int iTriChosen = subdomain_flag ? tet_rand_sub() : tet_rand_tri();
     tet_randpos(iTriChosen,pos);
     if(pos[0] == 0. && pos[1] == 0. && pos[2] == 0.)
         error->one(FLERR,"illegal RegTetMesh::mesh_randpos");
@@ -834,6 +841,74 @@ inline int RegTetMesh::tet_rand_tri()
     return 0;
 }
 
+/* ----------------------------------------------------------------------
+   choose a tet overlapping my subdomain, weighted by volume
+------------------------------------------------------------------------- */
+
+inline int RegTetMesh::tet_rand_sub()
+{
+    build_subdomain_cdf();
+    if(n_tet_sub == 0)
+        error->one(FLERR,"Impossible to generate random points on wrong sub-domain");
+
+    double rd = acc_volume_sub[n_tet_sub-1] * random->uniform();
+    int i = std::upper_bound(acc_volume_sub,acc_volume_sub+n_tet_sub,rd) - acc_volume_sub;
+    if(i >= n_tet_sub) i = n_tet_sub-1;
+    return tet_sub[i];
+}
+
+/* ----------------------------------------------------------------------
+   (re-)build volume CDF of the tets whose bbox overlaps my subdomain
+   so sampling a point in the subdomain only rejects points of tets that
+     cross the subdomain boundary
+   rebuilt only if the subdomain changed
+   for triclinic boxes the sub-box is in lamda coords, so use all tets
+------------------------------------------------------------------------- */
+
+void RegTetMesh::build_subdomain_cdf()
+{
+    if(n_tet_sub >= 0 &&
+       sublo_cdf[0] == domain->sublo[0] && subhi_cdf[0] == domain->subhi[0] &&
+       sublo_cdf[1] == domain->sublo[1] && subhi_cdf[1] == domain->subhi[1] &&
+       sublo_cdf[2] == domain->sublo[2] && subhi_cdf[2] == domain->subhi[2])
+        return;
+
+    vectorCopy3D(domain->sublo,sublo_cdf);
+    vectorCopy3D(domain->subhi,subhi_cdf);
+
+    memory->destroy(tet_sub);
+    memory->destroy(acc_volume_sub);
+    memory->create(tet_sub,nTet+1,"RegTetMesh:tet_sub");
+    memory->create(acc_volume_sub,nTet+1,"RegTetMesh:acc_volume_sub");
+
+    n_tet_sub = 0;
+    double acc = 0.;
+
+    for(int iTet = 0; iTet < nTet; iTet++)
+    {
+        bool overlap = true;
+        if(!domain->triclinic)
+        {
+            for(int dim = 0; dim < 3; dim++)
+            {
+                double lo = node[iTet][0][dim], hi = node[iTet][0][dim];
+                for(int j = 1; j < 4; j++)
+                {
+                    lo = std::min(lo,node[iTet][j][dim]);
+                    hi = std::max(hi,node[iTet][j][dim]);
+                }
+                if(lo >= subhi_cdf[dim] || hi < sublo_cdf[dim]) overlap = false;
+            }
+        }
+        if(!overlap) continue;
+
+        acc += volume[iTet];
+        tet_sub[n_tet_sub] = iTet;
+        acc_volume_sub[n_tet_sub] = acc;
+        n_tet_sub++;
+    }
+}
+
 /* ---------------------------------------------------------------------- */
 
 void RegTetMesh::volume_mc(int n_test,bool cutflag,double cut,double &vol_global,double &vol_local)
@@ -94,8 +94,10 @@ class RegTetMesh : public Region {
    double volume_of_tet(double* v0, double* v1, double* v2, double* v3);
    double volume_of_tet(int iTet);
 
-   int mesh_randpos(double *pos);
+   int mesh_randpos(double *pos,bool subdomain_flag = false);
    int  tet_rand_tri();
+   int  tet_rand_sub();
+   void build_subdomain_cdf();
 
    char *filename;
    double scale_fact;
@@ -121,6 +123,12 @@ class RegTetMesh : public Region {
    double *volume;
    double *acc_volume;
 
+   // volume CDF of tets overlapping my subdomain, for sampling
+   int n_tet_sub;
+   int *tet_sub;
+   double *acc_volume_sub;
+   double sublo_cdf[3],subhi_cdf[3];
+
    class BoundingBox &bounding_box_mesh;
 
    class RegionNeighborList<interpolate_no> &neighList;
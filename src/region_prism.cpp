@@ -51,6 +51,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include "region_prism.h"
+#include "random_park.h"
 #include "domain.h"
 #include "force.h"
 #include "error.h"
@@ -541,3 +542,36 @@ void RegPrism::normalize(double *x)
   x[1] *= invlen;
   x[2] *= invlen;
 }
+
+/* ----------------------------------------------------------------------
+   exact volume of prism, tilt factors do not change it
+------------------------------------------------------------------------- */
+
+int RegPrism::volume_analytic(double &vol)
+{
+  if (!interior || domain->dimension == 2) return 0;
+  vol = (xhi-xlo) * (yhi-ylo) * (zhi-zlo);
+  return 1;
+}
+
+/* ----------------------------------------------------------------------
+   direct sampling of prism via its edge vectors, cut is not applied
+------------------------------------------------------------------------- */
+
+double RegPrism::sample_volume(double)
+{
+  double vol;
+  if (!volume_analytic(vol)) return 0.0;
+  return vol;
+}
+
+int RegPrism::sample_interior(double *pos, double, RanPark *ranpark)
+{
+  double u = ranpark->uniform();
+  double v = ranpark->uniform();
+  double w = ranpark->uniform();
+  pos[0] = clo[0] + u*a[0] + v*b[0] + w*c[0];
+  pos[1] = clo[1] + u*a[1] + v*b[1] + w*c[1];
+  pos[2] = clo[2] + u*a[2] + v*b[2] + w*c[2];
+  return 1;
+}
@@ -65,6 +65,9 @@ class RegPrism : public Region {
   int inside(double, double, double);
   int surface_interior(double *, double);
   int surface_exterior(double *, double);
+  int volume_analytic(double &);
+  double sample_volume(double);
+  int sample_interior(double *, double, class RanPark *);
 
  private:
   double xlo,xhi,ylo,yhi,zlo,zhi;
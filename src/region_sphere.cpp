@@ -47,6 +47,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include "region_sphere.h"
+#include "random_park.h"
 #include "update.h"
 #include "input.h"
 #include "variable.h"
@@ -210,3 +211,43 @@ void RegSphere::variable_check()
   if (!input->variable->equalstyle(rvar))
     error->all(FLERR,"Variable for region sphere is invalid style");
 }
+
+/* ----------------------------------------------------------------------
+   exact volume of sphere
+------------------------------------------------------------------------- */
+
+int RegSphere::volume_analytic(double &vol)
+{
+  if (!interior) return 0;
+  vol = 4.0/3.0 * M_PI * radius*radius*radius;
+  return 1;
+}
+
+/* ----------------------------------------------------------------------
+   direct sampling of sphere shrunk by cut
+   isotropic direction from 3 gaussians, radius ~ r^2
+------------------------------------------------------------------------- */
+
+double RegSphere::sample_volume(double cut)
+{
+  if (!interior || radius <= cut) return 0.0;
+  double r = radius-cut;
+  return 4.0/3.0 * M_PI * r*r*r;
+}
+
+int RegSphere::sample_interior(double *pos, double cut, RanPark *ranpark)
+{
+  double dir[3],lensq;
+  do {
+    dir[0] = ranpark->gaussian();
+    dir[1] = ranpark->gaussian();
+    dir[2] = ranpark->gaussian();
+    lensq = dir[0]*dir[0] + dir[1]*dir[1] + dir[2]*dir[2];
+  } while (lensq == 0.0);
+
+  double r = (radius-cut) * cbrt(ranpark->uniform()) / sqrt(lensq);
+  pos[0] = xc + r*dir[0];
+  pos[1] = yc + r*dir[1];
+  pos[2] = zc + r*dir[2];
+  return 1;
+}
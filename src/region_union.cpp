@@ -46,6 +46,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include "region_union.h"
+#include "random_park.h"
 #include "domain.h"
 #include "error.h"
 #include "force.h"
@@ -278,3 +279,51 @@ void RegUnion::shape_update()
   for (int ilist = 0; ilist < nregion; ilist++)
     regions[list[ilist]]->shape_update();
 }
+
+/* ----------------------------------------------------------------------
+   direct sampling of union
+   pick sub-region i with probability V_i / sum(V), draw from it and
+     accept with probability 1/k, k = # of sub-regions the point is in,
+     so overlaps are not over-sampled
+   cut is not passed on, a point away from the union surface may be
+     close to the surfaces of all sub-regions it is in
+------------------------------------------------------------------------- */
+
+double RegUnion::sample_volume(double)
+{
+  if (!interior) return 0.0;
+
+  Region **regions = domain->regions;
+  double vol = 0.0;
+  for (int ilist = 0; ilist < nregion; ilist++) {
+    double vol_sub = regions[list[ilist]]->sample_volume(0.0);
+    if (vol_sub <= 0.0) return 0.0;
+    vol += vol_sub;
+  }
+  return vol;
+}
+
+int RegUnion::sample_interior(double *pos, double, RanPark *ranpark)
+{
+  Region **regions = domain->regions;
+  double vol = sample_volume(0.0);
+  double r = ranpark->uniform()*vol;
+
+  int ichosen = nregion-1;
+  for (int ilist = 0; ilist < nregion-1; ilist++) {
+    r -= regions[list[ilist]]->sample_volume(0.0);
+    if (r < 0.0) {
+      ichosen = ilist;
+      break;
+    }
+  }
+
+  if (!regions[list[ichosen]]->sample_direct(pos,0.0,ranpark)) return 0;
+
+  int k = 0;
+  for (int ilist = 0; ilist < nregion; ilist++)
+    if (regions[list[ilist]]->match(pos[0],pos[1],pos[2])) k++;
+
+  if (k <= 1) return 1;
+  return (ranpark->uniform()*k < 1.0);
+}
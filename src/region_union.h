@@ -65,6 +65,8 @@ class RegUnion : public Region {
   int inside(double, double, double);
   int surface_interior(double *, double);
   int surface_exterior(double *, double);
+  double sample_volume(double);
+  int sample_interior(double *, double, class RanPark *);
   void shape_update();
 
  private:
@@ -255,7 +255,7 @@ namespace ContactModels
       const double eny = sidata.en[1];
       const double enz = sidata.en[2];
 
-      const double dt = update->dt; 
+      const double dt = sidata.dt; 
 
       double * const c_history = &sidata.contact_history[history_offset]; // requires Style::TANGENTIAL == TANGENTIAL_HISTORY
       const double rmu= coeffRollFrict[itype][jtype];
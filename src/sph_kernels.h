@@ -40,6 +40,7 @@
 #ifndef LMP_SPH_KERNELS
 #define LMP_SPH_KERNELS
 
+#include <cmath>
 #include "style_sph_kernel.h"
 
 namespace SPH_KERNEL_NS {
@@ -48,6 +49,31 @@ namespace SPH_KERNEL_NS {
   inline double sph_kernel(int id,double s,double h,double hinv);
   inline double sph_kernel_der(int id,double s,double h,double hinv);
   inline double sph_kernel_cut(int id);
+
+  /* ----------------------------------------------------------------------
+     compile-time kernel selection
+     SPHKernelType<id> forwards to the functions registered for kernel id,
+     so templated pair loops can inline the kernel instead of going through
+     the run-time if-chain of sph_kernel() / sph_kernel_der() per pair
+  ------------------------------------------------------------------------- */
+
+  template<int KERNEL_ID> struct SPHKernelType;
+
+  #define SPH_KERNEL_CLASS
+  #define SPHKernel(kernel_id,kernelstyle,SPHKernelCalculation,SPHKernelCalculationDer,SPHKernelCalculationCut) \
+  template<> struct SPHKernelType<kernel_id> { \
+    inline double w(double s,double h,double hinv) const \
+    { return SPH_KERNEL_NS::SPHKernelCalculation(s,h,hinv); } \
+    inline double der(double s,double h,double hinv) const \
+    { return SPH_KERNEL_NS::SPHKernelCalculationDer(s,h,hinv); } \
+    inline double cut() const \
+    { return SPH_KERNEL_NS::SPHKernelCalculationCut(); } \
+  };
+  #include "style_sph_kernel.h"
+  #undef SPH_KERNEL_CLASS
+  #undef SPHKernel
+
+  class SPHKernelTable;
 }
 
 /* ---------------------------------------------------------------------- */
@@ -129,4 +155,84 @@ inline double SPH_KERNEL_NS::sph_kernel_cut(int id)
   return 0.;
 }
 
+/* ----------------------------------------------------------------------
+   tabulated kernel
+   all kernels are of the form W = hinv^d f(s) and dW/dr = hinv^(d+1) g(s),
+   so f and g are sampled once on [0,cut] and linearly interpolated.
+   d is detected by evaluating the kernel for two smoothing lengths
+------------------------------------------------------------------------- */
+
+class SPH_KERNEL_NS::SPHKernelTable
+{
+  public:
+
+    SPHKernelTable(int id,int n) :
+      n_(n),
+      cut_(sph_kernel_cut(id)),
+      w_(new double[n+2]),
+      der_(new double[n+2])
+    {
+      dsinv_ = static_cast<double>(n_)/cut_;
+
+      const double s0 = 0.5*cut_;
+      dim_ = static_cast<int>(floor(log(sph_kernel(id,s0,1.,1.)/sph_kernel(id,s0,2.,0.5))/log(2.)+0.5));
+
+      for (int k = 0; k <= n_; k++)
+      {
+          const double s = static_cast<double>(k)/dsinv_;
+          w_[k] = sph_kernel(id,s,1.,1.);
+          der_[k] = sph_kernel_der(id,s,1.,1.);
+      }
+      // pad so interpolation at s == cut does not read past the table
+      w_[n_+1] = w_[n_];
+      der_[n_+1] = der_[n_];
+    }
+
+    ~SPHKernelTable()
+    {
+      delete [] w_;
+      delete [] der_;
+    }
+
+    inline double w(double s,double,double hinv) const
+    { return hpow(hinv,dim_) * interpolate(w_,s); }
+
+    inline double der(double s,double,double hinv) const
+    { return hpow(hinv,dim_+1) * interpolate(der_,s); }
+
+    inline double cut() const
+    { return cut_; }
+
+    int dim() const
+    { return dim_; }
+
+  private:
+
+    SPHKernelTable(const SPHKernelTable &);
+    SPHKernelTable &operator=(const SPHKernelTable &);
+
+    inline double interpolate(const double *tab,double s) const
+    {
+      const double x = s*dsinv_;
+      const int k = static_cast<int>(x);
+      if (k > n_) return 0.;
+      const double t = x-static_cast<double>(k);
+      return tab[k] + t*(tab[k+1]-tab[k]);
+    }
+
+    static inline double hpow(double hinv,int d)
+    {
+      double res = hinv;
+      for (int k = 1; k < d; k++) res *= hinv;
+      return res;
+    }
+
+    int n_;
+    int dim_;
+    double cut_;
+    double dsinv_;
+    double *w_;
+    double *der_;
+};
+
 #endif
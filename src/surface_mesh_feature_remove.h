@@ -1 +1,2 @@
-void handleExclusion(int *) {if(MultiNodeMesh<NUM_NODES>::minFeatureLength() > 0. ) this->error->one(FLERR,"surface mesh feature remove not available in this version");}
+        // exclude entities where no element is larger than min_feature_length
+        void handleExclusion(int *idListVisited);
@@ -1 +1,125 @@
+/* ----------------------------------------------------------------------
+    This is the
 
+    ██╗     ██╗ ██████╗  ██████╗  ██████╗ ██╗  ██╗████████╗███████╗
+    ██║     ██║██╔════╝ ██╔════╝ ██╔════╝ ██║  ██║╚══██╔══╝██╔════╝
+    ██║     ██║██║  ███╗██║  ███╗██║  ███╗███████║   ██║   ███████╗
+    ██║     ██║██║   ██║██║   ██║██║   ██║██╔══██║   ██║   ╚════██║
+    ███████╗██║╚██████╔╝╚██████╔╝╚██████╔╝██║  ██║   ██║   ███████║
+    ╚══════╝╚═╝ ╚═════╝  ╚═════╝  ╚═════╝ ╚═╝  ╚═╝   ╚═╝   ╚══════╝®
+
+    DEM simulation engine, released by
+    DCS Computing Gmbh, Linz, Austria
+    http://www.dcs-computing.com, office@dcs-computing.com
+
+    LIGGGHTS® is part of CFDEM®project:
+    http://www.liggghts.com | http://www.cfdem.com
+
+    Core developer and main author:
+    Christoph Kloss, christoph.kloss@dcs-computing.com
+
+    LIGGGHTS® is open-source, distributed under the terms of the GNU Public
+    License, version 2 or later. It is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+    of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. You should have
+    received a copy of the GNU General Public License along with LIGGGHTS®.
+    If not, see http://www.gnu.org/licenses . See also top-level README
+    and LICENSE files.
+
+    LIGGGHTS® and CFDEM® are registered trade marks of DCS Computing GmbH,
+    the producer of the LIGGGHTS® software and the CFDEM®coupling software
+    See http://www.cfdem.com/terms-trademark-policy for details.
+
+-------------------------------------------------------------------------
+    Contributing author and copyright for this file:
+
+    Christoph Kloss (DCS Computing GmbH, Linz)
+
+    Copyright 2012-     DCS Computing GmbH, Linz
+------------------------------------------------------------------------- */
+
+#ifndef LMP_SURFACE_MESH_FEATURE_REMOVE_I_H
+#define LMP_SURFACE_MESH_FEATURE_REMOVE_I_H
+
+/* ----------------------------------------------------------------------
+   remove small features
+   an entity is a set of elements connected via shared edges
+   if no element of an entity has an edge longer than min_feature_length,
+   all elements of the entity are written to the element exclusion list
+   only called in serial (element_exclusion_list write), so all elements
+   of an entity are available on this proc
+------------------------------------------------------------------------- */
+
+template<int NUM_NODES, int NUM_NEIGH_MAX>
+void SurfaceMesh<NUM_NODES,NUM_NEIGH_MAX>::handleExclusion(int *idListVisited)
+{
+    const int nall = this->sizeLocal()+this->sizeGhost();
+    const double minFeatureLength = MultiNodeMesh<NUM_NODES>::minFeatureLength();
+    FILE *exclusionList = MultiNodeMesh<NUM_NODES>::elementExclusionList();
+
+    // idListVisited is used as stack of local indices for the flood fill
+    // entity stores the local indices of the entity being processed
+
+    std::vector<bool> visited(nall,false);
+    std::vector<int> entity;
+    int nEntitiesRemoved = 0, nElementsRemoved = 0;
+
+    for(int iSeed = 0; iSeed < nall; iSeed++)
+    {
+        if(visited[iSeed])
+            continue;
+
+        entity.clear();
+        double maxEdgeLen = 0.;
+        int nStack = 0;
+        idListVisited[nStack++] = iSeed;
+        visited[iSeed] = true;
+
+        while(nStack > 0)
+        {
+            const int i = idListVisited[--nStack];
+            entity.push_back(i);
+
+            for(int iEdge = 0; iEdge < NUM_NODES; iEdge++)
+                maxEdgeLen = std::max(maxEdgeLen,edgeLen_(i)[iEdge]);
+
+            for(int iN = 0; iN < nNeighs_(i); iN++)
+            {
+                const int idNeigh = neighFaces_(i)[iN];
+                if(idNeigh < 0)
+                    continue;
+                const int nTri_j = this->map_size(idNeigh);
+                for(int j = 0; j < nTri_j; j++)
+                {
+                    const int iNeigh = this->map(idNeigh,j);
+                    if(iNeigh >= 0 && !visited[iNeigh])
+                    {
+                        visited[iNeigh] = true;
+                        idListVisited[nStack++] = iNeigh;
+                    }
+                }
+            }
+        }
+
+        if(maxEdgeLen >= minFeatureLength)
+            continue;
+
+        nEntitiesRemoved++;
+        nElementsRemoved += entity.size();
+
+        for(size_t k = 0; k < entity.size(); k++)
+        {
+            if(TrackingMesh<NUM_NODES>::verbose() && 0 == this->comm->me)
+                fprintf(this->screen,"Mesh %s: element id %d (line %d) belongs to a feature smaller than min_feature_length (%f)\n",
+                        this->mesh_id_,TrackingMesh<NUM_NODES>::id(entity[k]),TrackingMesh<NUM_NODES>::lineNo(entity[k]),minFeatureLength);
+            if(0 == this->comm->me)
+                fprintf(exclusionList,"%d\n",TrackingMesh<NUM_NODES>::lineNo(entity[k]));
+        }
+    }
+
+    if(0 == this->comm->me)
+        fprintf(this->screen,"Mesh %s: %d feature(s) with %d element(s) smaller than min_feature_length written to element exclusion list\n",
+                this->mesh_id_,nEntitiesRemoved,nElementsRemoved);
+}
+
+#endif
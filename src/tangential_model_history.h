@@ -145,7 +145,7 @@ namespace ContactModels
             vectorCopy3D(shear, shear_old);
 
         if (update_history) {
-          const double dt = update->dt;
+          const double dt = sidata.dt;
           shear[0] += sidata.vtr1 * dt;
           shear[1] += sidata.vtr2 * dt;
           shear[2] += sidata.vtr3 * dt;
@@ -181,7 +181,7 @@ namespace ContactModels
             
             if(heating)
             {
-              const double P_diss_local = (Ft_shear - Ft_friction)*(Ft_shear + Ft_friction) / (update->dt*kt); 
+              const double P_diss_local = (Ft_shear - Ft_friction)*(Ft_shear + Ft_friction) / (sidata.dt*kt); 
               sidata.P_diss += P_diss_local;
               if(heating_track && sidata.is_wall)
                   cmb->tally_pw(P_diss_local, sidata.i, sidata.jtype, 2);
@@ -277,7 +277,7 @@ namespace ContactModels
                 {
                     double delta[3];
                     sidata.fix_mesh->triMesh()->get_global_vel(delta);
-                    vectorScalarMult3D(delta, update->dt);
+                    vectorScalarMult3D(delta, sidata.dt);
                     
                     elastic_pot[10] -= (delta[0]*Ft_ela1 +
                                         delta[1]*Ft_ela2 +
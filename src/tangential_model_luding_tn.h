@@ -116,7 +116,7 @@ namespace ContactModels
       double * const shear = &sidata.contact_history[history_offset];
       // double * const K_adh = &sidata.contact_history[kc_Stiffness];
       if (sidata.shearupdate && sidata.computeflag) {
-        const double dt = update->dt;
+        const double dt = sidata.dt;
         shear[0] += sidata.vtr1 * dt;
         shear[1] += sidata.vtr2 * dt;
         shear[2] += sidata.vtr3 * dt;
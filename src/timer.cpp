@@ -47,6 +47,7 @@
 #include "timer.h"
 #include "memory.h"
 #include "modify.h"
+#include "perf_events.h"
 
 using namespace LAMMPS_NS;
 
@@ -55,6 +56,8 @@ using namespace LAMMPS_NS;
 Timer::Timer(LAMMPS *lmp) : Pointers(lmp)
 {
   memory->create(array,TIME_N,"array");
+  memory->create(start_time,TIME_N,"start_time");
+  perf = new PerfEvents(lmp);
 }
 
 /* ---------------------------------------------------------------------- */
@@ -62,6 +65,8 @@ Timer::Timer(LAMMPS *lmp) : Pointers(lmp)
 Timer::~Timer()
 {
   memory->destroy(array);
+  memory->destroy(start_time);
+  delete perf;
 }
 
 /* ---------------------------------------------------------------------- */
@@ -72,7 +77,9 @@ void Timer::init()
 
   if(modify->timing) {
     for (int i = 0; i < modify->nfix; i++) modify->fix[i]->reset_time_recording();
+    perf->open();
   }
+  else perf->close();
 }
 
 /* ---------------------------------------------------------------------- */
@@ -49,13 +49,15 @@
 #include "pointers.h"
 
 enum{TIME_LOOP,TIME_PAIR,TIME_BOND,TIME_KSPACE,TIME_NEIGHBOR,
-     TIME_COMM,TIME_OUTPUT,TIME_MODIFY,TIME_N};
+     TIME_COMM,TIME_OUTPUT,TIME_MODIFY,TIME_MESH_NEIGHBOR,TIME_WALL_CONTACT,
+     TIME_N};
 
 namespace LAMMPS_NS {
 
 class Timer : protected Pointers {
  public:
   double *array;
+  class PerfEvents *perf;       // hardware counters for hot regions
 
   Timer(class LAMMPS *);
   ~Timer();
@@ -66,8 +68,20 @@ class Timer : protected Pointers {
   void barrier_stop(int);
   double elapsed(int);
 
+  // sub-timers inside a fix, part of TIME_MODIFY
+  // do not touch previous_time, so the stamps of the integrator stay valid
+
+  inline void start(int which) {
+    start_time[which] = MPI_Wtime();
+  }
+
+  inline void stop(int which) {
+    array[which] += MPI_Wtime() - start_time[which];
+  }
+
  private:
   double previous_time;
+  double *start_time;
 };
 
 }
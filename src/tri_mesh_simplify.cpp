@@ -0,0 +1,524 @@
+/* ----------------------------------------------------------------------
+    This is the
+
+    ██╗     ██╗ ██████╗  ██████╗  ██████╗ ██╗  ██╗████████╗███████╗
+    ██║     ██║██╔════╝ ██╔════╝ ██╔════╝ ██║  ██║╚══██╔══╝██╔════╝
+    ██║     ██║██║  ███╗██║  ███╗██║  ███╗███████║   ██║   ███████╗
+    ██║     ██║██║   ██║██║   ██║██║   ██║██╔══██║   ██║   ╚════██║
+    ███████╗██║╚██████╔╝╚██████╔╝╚██████╔╝██║  ██║   ██║   ███████║
+    ╚══════╝╚═╝ ╚═════╝  ╚═════╝  ╚═════╝ ╚═╝  ╚═╝   ╚═╝   ╚══════╝®
+
+    DEM simulation engine, released by
+    DCS Computing Gmbh, Linz, Austria
+    http://www.dcs-computing.com, office@dcs-computing.com
+
+    LIGGGHTS® is part of CFDEM®project:
+    http://www.liggghts.com | http://www.cfdem.com
+
+    Core developer and main author:
+    Christoph Kloss, christoph.kloss@dcs-computing.com
+
+    LIGGGHTS® is open-source, distributed under the terms of the GNU Public
+    License, version 2 or later. It is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+    of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. You should have
+    received a copy of the GNU General Public License along with LIGGGHTS®.
+    If not, see http://www.gnu.org/licenses . See also top-level README
+    and LICENSE files.
+
+    LIGGGHTS® and CFDEM® are registered trade marks of DCS Computing GmbH,
+    the producer of the LIGGGHTS® software and the CFDEM®coupling software
+    See http://www.cfdem.com/terms-trademark-policy for details.
+
+-------------------------------------------------------------------------
+    Contributing author and copyright for this file:
+    (if not contributing author is listed, this file has been contributed
+    by the core developer)
+
+    Copyright 2012-     DCS Computing GmbH, Linz
+------------------------------------------------------------------------- */
+
+#include <cmath>
+#include <queue>
+#include <algorithm>
+#include "tri_mesh_simplify.h"
+#include "tri_mesh.h"
+#include "comm.h"
+#include "memory_ns.h"
+#include "vector_liggghts.h"
+
+using namespace LAMMPS_NS;
+
+// smallest angle new elements may have (or curvature, if larger),
+// unless the removed elements were worse
+#define SIMPLIFY_MIN_ANGLE 10.
+
+#define BIG_SIMPLIFY 1.e30
+
+/* ---------------------------------------------------------------------- */
+
+TriMeshSimplify::TriMeshSimplify(LAMMPS *lmp, double precision, double angle) :
+  Pointers(lmp),
+  precision_(precision),
+  cosAngle_(cos(angle*M_PI/180.)),
+  cosMinAngle_(cos(std::max(SIMPLIFY_MIN_ANGLE,angle)*M_PI/180.)),
+  maxErr_(0.)
+{
+}
+
+/* ---------------------------------------------------------------------- */
+
+TriMeshSimplify::~TriMeshSimplify()
+{
+}
+
+/* ----------------------------------------------------------------------
+   add a triangle to the soup, nodes closer than precision are welded
+   degenerate triangles are passed through and their nodes are locked
+------------------------------------------------------------------------- */
+
+void TriMeshSimplify::addTriangle(double *a, double *b, double *c, int lineNumber)
+{
+    const int t = lineNo_.size();
+    const int ia = weld(a), ib = weld(b), ic = weld(c);
+
+    tri_.push_back(ia);
+    tri_.push_back(ib);
+    tri_.push_back(ic);
+    lineNo_.push_back(lineNumber);
+    alive_.push_back(true);
+
+    double n[3];
+    normal(&x_[3*ia],&x_[3*ib],&x_[3*ic],n);
+    nref_.insert(nref_.end(),n,n+3);
+
+    if(ia == ib || ib == ic || ia == ic)
+    {
+        locked_[ia] = locked_[ib] = locked_[ic] = true;
+        return;
+    }
+
+    vtri_[ia].push_back(t);
+    vtri_[ib].push_back(t);
+    vtri_[ic].push_back(t);
+}
+
+/* ----------------------------------------------------------------------
+   return index of welded vertex for node p, add new vertex if needed
+   cells have size precision, so matching vertices are in adjacent cells
+------------------------------------------------------------------------- */
+
+int TriMeshSimplify::weld(double *p)
+{
+    long long ix[3];
+    for(int k = 0; k < 3; k++)
+        ix[k] = static_cast<long long>(floor(p[k]/precision_));
+
+    for(int dx = -1; dx <= 1; dx++)
+      for(int dy = -1; dy <= 1; dy++)
+        for(int dz = -1; dz <= 1; dz++)
+        {
+            const long long key = ((ix[0]+dx)*73856093LL) ^ ((ix[1]+dy)*19349663LL) ^ ((ix[2]+dz)*83492791LL);
+            std::pair<std::unordered_multimap<long long,int>::iterator,std::unordered_multimap<long long,int>::iterator>
+                range = cells_.equal_range(key);
+            for(std::unordered_multimap<long long,int>::iterator it = range.first; it != range.second; ++it)
+            {
+                const int j = it->second;
+                if(MathExtraLiggghts::compDouble(x_[3*j],p[0],precision_) &&
+                   MathExtraLiggghts::compDouble(x_[3*j+1],p[1],precision_) &&
+                   MathExtraLiggghts::compDouble(x_[3*j+2],p[2],precision_))
+                    return j;
+            }
+        }
+
+    const int n = err_.size();
+    x_.insert(x_.end(),p,p+3);
+    err_.push_back(0.);
+    stamp_.push_back(0);
+    locked_.push_back(false);
+    vtri_.push_back(std::vector<int>());
+    cells_.insert(std::make_pair((ix[0]*73856093LL) ^ (ix[1]*19349663LL) ^ (ix[2]*83492791LL),n));
+    return n;
+}
+
+/* ----------------------------------------------------------------------
+   neighbor vertices of v and number of triangles sharing each edge
+------------------------------------------------------------------------- */
+
+void TriMeshSimplify::ring(int v, std::vector<int> &neighs, std::vector<int> &count)
+{
+    neighs.clear();
+    count.clear();
+
+    for(size_t i = 0; i < vtri_[v].size(); i++)
+    {
+        const int t = vtri_[v][i];
+        for(int k = 0; k < 3; k++)
+        {
+            const int w = tri_[3*t+k];
+            if(w == v)
+                continue;
+            std::vector<int>::iterator it = std::find(neighs.begin(),neighs.end(),w);
+            if(it == neighs.end())
+            {
+                neighs.push_back(w);
+                count.push_back(1);
+            }
+            else
+                count[it-neighs.begin()]++;
+        }
+    }
+}
+
+/* ----------------------------------------------------------------------
+   check if vertex v can be collapsed onto its neighbor u
+   cost is the accumulated error bound of the region after the collapse
+------------------------------------------------------------------------- */
+
+bool TriMeshSimplify::evaluate(int v, int u, double &cost)
+{
+    if(locked_[v] || vtri_[v].empty())
+        return false;
+
+    std::vector<int> nv, cv, nu, cu;
+    ring(v,nv,cv);
+
+    // v must be a manifold vertex, either interior (closed fan)
+    // or on a boundary (open fan) where v-u is a boundary edge
+
+    const int nTri = vtri_[v].size();
+    int nBoundary = 0, iu = -1, w = -1;
+    for(size_t i = 0; i < nv.size(); i++)
+    {
+        if(cv[i] > 2)
+            return false;
+        if(cv[i] == 1)
+        {
+            nBoundary++;
+            if(nv[i] != u)
+                w = nv[i];
+        }
+        if(nv[i] == u)
+            iu = i;
+    }
+
+    if(iu < 0)
+        return false;
+    if(0 == nBoundary && static_cast<int>(nv.size()) != nTri)
+        return false;
+    if(nBoundary != 0 && (nBoundary != 2 || static_cast<int>(nv.size()) != nTri+1 || cv[iu] != 1))
+        return false;
+
+    // link condition: common neighbors of v and u are exactly the
+    // opposite vertices of the triangles sharing edge v-u
+
+    ring(u,nu,cu);
+    int nCommon = 0;
+    for(size_t i = 0; i < nv.size(); i++)
+        if(std::find(nu.begin(),nu.end(),nv[i]) != nu.end())
+            nCommon++;
+    if(nCommon != cv[iu])
+        return false;
+
+    // element quality before collapse
+
+    double maxCosOld = -1.;
+    for(int i = 0; i < nTri; i++)
+    {
+        const int *n = &tri_[3*vtri_[v][i]];
+        maxCosOld = std::max(maxCosOld,maxCosAngle(&x_[3*n[0]],&x_[3*n[1]],&x_[3*n[2]]));
+    }
+    const double maxCosAllowed = std::max(maxCosOld,cosMinAngle_);
+
+    // check elements that survive the collapse
+
+    double dist = BIG_SIMPLIFY;
+    for(int i = 0; i < nTri; i++)
+    {
+        const int t = vtri_[v][i];
+        const int *n = &tri_[3*t];
+        if(n[0] == u || n[1] == u || n[2] == u)
+            continue;
+
+        // resulting element must not be a duplicate
+
+        int p = -1, q = -1;
+        for(int k = 0; k < 3; k++)
+            if(n[k] != v)
+                (p < 0 ? p : q) = n[k];
+        for(size_t j = 0; j < vtri_[u].size(); j++)
+        {
+            const int *m = &tri_[3*vtri_[u][j]];
+            if((m[0] == p || m[1] == p || m[2] == p) && (m[0] == q || m[1] == q || m[2] == q))
+                return false;
+        }
+
+        const double *xold[3], *xnew[3];
+        for(int k = 0; k < 3; k++)
+        {
+            xold[k] = &x_[3*n[k]];
+            xnew[k] = (n[k] == v) ? &x_[3*u] : xold[k];
+        }
+
+        if(maxCosAngle(xnew[0],xnew[1],xnew[2]) > maxCosAllowed)
+            return false;
+
+        double nold[3], nnew[3];
+        normal(xold[0],xold[1],xold[2],nold);
+        normal(xnew[0],xnew[1],xnew[2],nnew);
+        if(vectorDot3D(nnew,nold) < cosAngle_ || vectorDot3D(nnew,&nref_[3*t]) < cosAngle_)
+            return false;
+
+        dist = std::min(dist,distPointTri(&x_[3*v],xnew[0],xnew[1],xnew[2]));
+    }
+
+    // at least one element must survive
+    if(dist == BIG_SIMPLIFY)
+        return false;
+
+    // boundary must stay within tolerance as well
+    if(nBoundary)
+        dist = std::max(dist,distPointSegment(&x_[3*v],&x_[3*u],&x_[3*w]));
+
+    double errRegion = err_[v];
+    for(size_t i = 0; i < nv.size(); i++)
+        errRegion = std::max(errRegion,err_[nv[i]]);
+
+    cost = dist + errRegion;
+    return cost <= precision_;
+}
+
+/* ----------------------------------------------------------------------
+   find cheapest valid collapse of vertex v
+------------------------------------------------------------------------- */
+
+bool TriMeshSimplify::findBest(int v, Collapse &c)
+{
+    if(locked_[v] || vtri_[v].empty())
+        return false;
+
+    std::vector<int> nv, cv;
+    ring(v,nv,cv);
+
+    c.cost = BIG_SIMPLIFY;
+    c.v = v;
+    c.u = -1;
+    c.stamp = stamp_[v];
+
+    for(size_t i = 0; i < nv.size(); i++)
+    {
+        double cost;
+        if(evaluate(v,nv[i],cost) && cost < c.cost)
+        {
+            c.cost = cost;
+            c.u = nv[i];
+        }
+    }
+
+    return c.u >= 0;
+}
+
+/* ----------------------------------------------------------------------
+   collapse vertex v onto u
+------------------------------------------------------------------------- */
+
+void TriMeshSimplify::collapse(int v, int u, double cost)
+{
+    std::vector<int> nv, cv;
+    ring(v,nv,cv);
+
+    for(size_t i = 0; i < vtri_[v].size(); i++)
+    {
+        const int t = vtri_[v][i];
+        int *n = &tri_[3*t];
+
+        if(n[0] == u || n[1] == u || n[2] == u)
+        {
+            alive_[t] = false;
+            for(int k = 0; k < 3; k++)
+            {
+                if(n[k] == v)
+                    continue;
+                std::vector<int> &vt = vtri_[n[k]];
+                vt.erase(std::find(vt.begin(),vt.end(),t));
+            }
+        }
+        else
+        {
+            for(int k = 0; k < 3; k++)
+                if(n[k] == v)
+                    n[k] = u;
+            vtri_[u].push_back(t);
+        }
+    }
+    vtri_[v].clear();
+
+    for(size_t i = 0; i < nv.size(); i++)
+        err_[nv[i]] = std::max(err_[nv[i]],cost);
+    maxErr_ = std::max(maxErr_,cost);
+}
+
+/* ----------------------------------------------------------------------
+   simplify the soup, cheapest collapse first, and add result to mesh
+------------------------------------------------------------------------- */
+
+void TriMeshSimplify::simplify(TriMesh *mesh)
+{
+    const int nTriBefore = lineNo_.size();
+    const int nVert = err_.size();
+
+    std::priority_queue<Collapse> queue;
+    Collapse c;
+
+    for(int v = 0; v < nVert; v++)
+        if(findBest(v,c))
+            queue.push(c);
+
+    std::vector<int> nu, cu;
+    while(!queue.empty())
+    {
+        const Collapse top = queue.top();
+        queue.pop();
+
+        if(top.stamp != stamp_[top.v] || vtri_[top.v].empty())
+            continue;
+
+        // costs only grow as errors accumulate, re-queue if outdated
+
+        double cost;
+        if(!evaluate(top.v,top.u,cost) || cost > top.cost)
+        {
+            stamp_[top.v]++;
+            if(findBest(top.v,c))
+                queue.push(c);
+            continue;
+        }
+
+        collapse(top.v,top.u,cost);
+
+        ring(top.u,nu,cu);
+        nu.push_back(top.u);
+        for(size_t i = 0; i < nu.size(); i++)
+        {
+            stamp_[nu[i]]++;
+            if(findBest(nu[i],c))
+                queue.push(c);
+        }
+    }
+
+    int nTriAfter = 0;
+    double **nodeTmp = create<double>(nodeTmp,3,3);
+    for(int t = 0; t < nTriBefore; t++)
+    {
+        if(!alive_[t])
+            continue;
+        for(int k = 0; k < 3; k++)
+            vectorCopy3D(&x_[3*tri_[3*t+k]],nodeTmp[k]);
+        mesh->addElement(nodeTmp,lineNo_[t]);
+        nTriAfter++;
+    }
+    destroy<double>(nodeTmp);
+
+    if(0 == comm->me)
+        fprintf(screen,"Mesh %s: simplification reduced number of elements from %d to %d (%.1f%% reduction), "
+                       "estimated max. geometric error %g\n",
+                mesh->mesh_id(),nTriBefore,nTriAfter,
+                nTriBefore > 0 ? 100.*(nTriBefore-nTriAfter)/nTriBefore : 0.,maxErr_);
+}
+
+/* ----------------------------------------------------------------------
+   geometric helpers
+------------------------------------------------------------------------- */
+
+void TriMeshSimplify::normal(const double *a, const double *b, const double *c, double *n)
+{
+    double ab[3], ac[3];
+    vectorSubtract3D(b,a,ab);
+    vectorSubtract3D(c,a,ac);
+    vectorCross3D(ab,ac,n);
+    vectorNormalize3D(n);
+}
+
+// cosine of the smallest angle of the triangle, 1 if degenerate
+
+double TriMeshSimplify::maxCosAngle(const double *a, const double *b, const double *c)
+{
+    const double *x[3] = {a,b,c};
+    double maxCos = -1.;
+
+    for(int k = 0; k < 3; k++)
+    {
+        double e0[3], e1[3];
+        vectorSubtract3D(x[(k+1)%3],x[k],e0);
+        vectorSubtract3D(x[(k+2)%3],x[k],e1);
+        const double l0 = vectorMag3D(e0), l1 = vectorMag3D(e1);
+        if(l0 == 0. || l1 == 0.)
+            return 1.;
+        maxCos = std::max(maxCos,vectorDot3D(e0,e1)/(l0*l1));
+    }
+    return maxCos;
+}
+
+// distance of p to triangle a,b,c via closest point on triangle
+
+double TriMeshSimplify::distPointTri(const double *p, const double *a, const double *b, const double *c)
+{
+    double ab[3], ac[3], ap[3], bp[3], cp[3], q[3];
+    vectorSubtract3D(b,a,ab);
+    vectorSubtract3D(c,a,ac);
+    vectorSubtract3D(p,a,ap);
+
+    const double d1 = vectorDot3D(ab,ap), d2 = vectorDot3D(ac,ap);
+    if(d1 <= 0. && d2 <= 0.)
+        return pointDistance(p,a);
+
+    vectorSubtract3D(p,b,bp);
+    const double d3 = vectorDot3D(ab,bp), d4 = vectorDot3D(ac,bp);
+    if(d3 >= 0. && d4 <= d3)
+        return pointDistance(p,b);
+
+    const double vc = d1*d4 - d3*d2;
+    if(vc <= 0. && d1 >= 0. && d3 <= 0.)
+    {
+        vectorAddMultiple3D(a,d1/(d1-d3),ab,q);
+        return pointDistance(p,q);
+    }
+
+    vectorSubtract3D(p,c,cp);
+    const double d5 = vectorDot3D(ab,cp), d6 = vectorDot3D(ac,cp);
+    if(d6 >= 0. && d5 <= d6)
+        return pointDistance(p,c);
+
+    const double vb = d5*d2 - d1*d6;
+    if(vb <= 0. && d2 >= 0. && d6 <= 0.)
+    {
+        vectorAddMultiple3D(a,d2/(d2-d6),ac,q);
+        return pointDistance(p,q);
+    }
+
+    const double va = d3*d6 - d5*d4;
+    if(va <= 0. && (d4-d3) >= 0. && (d5-d6) >= 0.)
+    {
+        double bc[3];
+        vectorSubtract3D(c,b,bc);
+        vectorAddMultiple3D(b,(d4-d3)/((d4-d3)+(d5-d6)),bc,q);
+        return pointDistance(p,q);
+    }
+
+    const double denom = 1./(va+vb+vc);
+    vectorAddMultiple3D(a,vb*denom,ab,q);
+    vectorAddMultiple3D(q,vc*denom,ac,q);
+    return pointDistance(p,q);
+}
+
+double TriMeshSimplify::distPointSegment(const double *p, const double *a, const double *b)
+{
+    double ab[3], ap[3], q[3];
+    vectorSubtract3D(b,a,ab);
+    vectorSubtract3D(p,a,ap);
+    const double len2 = vectorDot3D(ab,ab);
+    double s = len2 > 0. ? vectorDot3D(ap,ab)/len2 : 0.;
+    s = std::max(0.,std::min(1.,s));
+    vectorAddMultiple3D(a,s,ab,q);
+    return pointDistance(p,q);
+}
@@ -0,0 +1,123 @@
+/* ----------------------------------------------------------------------
+    This is the
+
+    ██╗     ██╗ ██████╗  ██████╗  ██████╗ ██╗  ██╗████████╗███████╗
+    ██║     ██║██╔════╝ ██╔════╝ ██╔════╝ ██║  ██║╚══██╔══╝██╔════╝
+    ██║     ██║██║  ███╗██║  ███╗██║  ███╗███████║   ██║   ███████╗
+    ██║     ██║██║   ██║██║   ██║██║   ██║██╔══██║   ██║   ╚════██║
+    ███████╗██║╚██████╔╝╚██████╔╝╚██████╔╝██║  ██║   ██║   ███████║
+    ╚══════╝╚═╝ ╚═════╝  ╚═════╝  ╚═════╝ ╚═╝  ╚═╝   ╚═╝   ╚══════╝®
+
+    DEM simulation engine, released by
+    DCS Computing Gmbh, Linz, Austria
+    http://www.dcs-computing.com, office@dcs-computing.com
+
+    LIGGGHTS® is part of CFDEM®project:
+    http://www.liggghts.com | http://www.cfdem.com
+
+    Core developer and main author:
+    Christoph Kloss, christoph.kloss@dcs-computing.com
+
+    LIGGGHTS® is open-source, distributed under the terms of the GNU Public
+    License, version 2 or later. It is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+    of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. You should have
+    received a copy of the GNU General Public License along with LIGGGHTS®.
+    If not, see http://www.gnu.org/licenses . See also top-level README
+    and LICENSE files.
+
+    LIGGGHTS® and CFDEM® are registered trade marks of DCS Computing GmbH,
+    the producer of the LIGGGHTS® software and the CFDEM®coupling software
+    See http://www.cfdem.com/terms-trademark-policy for details.
+
+-------------------------------------------------------------------------
+    Contributing author and copyright for this file:
+    (if not contributing author is listed, this file has been contributed
+    by the core developer)
+
+    Copyright 2012-     DCS Computing GmbH, Linz
+------------------------------------------------------------------------- */
+
+#ifndef LMP_TRI_MESH_SIMPLIFY_H
+#define LMP_TRI_MESH_SIMPLIFY_H
+
+#include "pointers.h"
+#include <vector>
+#include <unordered_map>
+
+namespace LAMMPS_NS {
+
+/* ----------------------------------------------------------------------
+   simplification of a triangle soup before it is inserted into a TriMesh
+
+   nodes are welded with the mesh precision, then vertices are removed by
+   half-edge collapses, cheapest first. a collapse is only accepted if
+   (a) the topology stays manifold
+   (b) no element normal turns by more than the curvature, both
+       w.r.t. the current and the original normal of the element
+   (c) the estimated distance to the original surface stays below the
+       precision (accumulated over all collapses in the region)
+   (d) the smallest angle of the new elements is not worse than
+       min(smallest angle of the old elements, SIMPLIFY_MIN_ANGLE or
+       curvature, whichever is larger)
+   collapses in coplanar regions cost (almost) nothing and are done first,
+   which merges coplanar triangles
+------------------------------------------------------------------------- */
+
+class TriMeshSimplify : protected Pointers
+{
+  public:
+
+    TriMeshSimplify(class LAMMPS *lmp, double precision, double angle);
+    ~TriMeshSimplify();
+
+    void addTriangle(double *a, double *b, double *c, int lineNumber);
+
+    // simplify and add remaining triangles to mesh
+    void simplify(class TriMesh *mesh);
+
+  private:
+
+    struct Collapse
+    {
+        double cost;
+        int v, u, stamp;
+        bool operator<(const Collapse &other) const
+        { return cost > other.cost; }
+    };
+
+    int weld(double *p);
+    void ring(int v, std::vector<int> &neighs, std::vector<int> &count);
+    bool evaluate(int v, int u, double &cost);
+    bool findBest(int v, Collapse &c);
+    void collapse(int v, int u, double cost);
+
+    void normal(const double *a, const double *b, const double *c, double *n);
+    double maxCosAngle(const double *a, const double *b, const double *c);
+    double distPointTri(const double *p, const double *a, const double *b, const double *c);
+    double distPointSegment(const double *p, const double *a, const double *b);
+
+    double precision_;
+    double cosAngle_;
+    double cosMinAngle_;
+
+    // welded vertices
+    std::vector<double> x_;
+    std::vector<double> err_;
+    std::vector<int> stamp_;
+    std::vector<bool> locked_;
+    std::vector< std::vector<int> > vtri_;
+    std::unordered_multimap<long long,int> cells_;
+
+    // triangles
+    std::vector<int> tri_;
+    std::vector<int> lineNo_;
+    std::vector<double> nref_;
+    std::vector<bool> alive_;
+
+    double maxErr_;
+};
+
+}
+
+#endif
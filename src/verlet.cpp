@@ -75,11 +75,15 @@
 #include "signal_handling.h"
 
 using namespace LAMMPS_NS;
+using namespace FixConst;
 
 /* ---------------------------------------------------------------------- */
 
 Verlet::Verlet(LAMMPS *lmp, int narg, char **arg) :
-  Integrate(lmp, narg, arg) {}
+  Integrate(lmp, narg, arg)
+{
+  overlap = 0;
+}
 
 /* ----------------------------------------------------------------------
    initialization before run
@@ -125,6 +129,22 @@ void Verlet::init()
   // orthogonal vs triclinic simulation box
 
   triclinic = domain->triclinic;
+
+  // overlap forward comm with pair compute of interior atoms if requested
+  // pair style must be able to split its compute into two passes
+  // fixes with pre_force() must not alter what pair compute reads,
+  //   since pre_force() is invoked after the interior pass
+
+  overlap = 0;
+  if (comm->overlap_flag && pair_compute_flag) {
+    overlap = force->pair->split_enable;
+    for (int i = 0; i < modify->nfix; i++)
+      if ((modify->fmask[i] & PRE_FORCE) &&
+          !modify->fix[i]->pre_force_overlap) overlap = 0;
+    if (!overlap && comm->me == 0)
+      error->warning(FLERR,"Communicate overlap is not supported by pair style "
+                     "or fixes, using regular forward communication");
+  }
 }
 
 /* ----------------------------------------------------------------------
@@ -165,6 +185,7 @@ void Verlet::setup()
   
   neighbor->build();
   neighbor->ncalls = 0;
+  if (overlap) force->pair->split_neighbor_list();
 
   // compute all forces
 
@@ -208,6 +229,10 @@ void Verlet::setup_minimal(int flag)
 {
   update->setupflag = 1;
 
+  // a distance check posted in a previous run may be out of date
+
+  neighbor->check_distance_discard();
+
   // setup domain, communication and neighboring
   // acquire ghosts
   // build neighbor lists
@@ -227,6 +252,7 @@ void Verlet::setup_minimal(int flag)
     modify->setup_pre_neighbor();
     neighbor->build();
     neighbor->ncalls = 0;
+    if (overlap) force->pair->split_neighbor_list();
   }
 
   // compute all forces
@@ -264,7 +290,7 @@ void Verlet::setup_minimal(int flag)
 void Verlet::run(int n)
 {
   bigint ntimestep;
-  int nflag,sortflag;
+  int nflag,sortflag,splitflag;
 
   const int n_pre_initial_integrate = modify->n_pre_initial_integrate;
   const int n_post_integrate = modify->n_post_integrate;
@@ -298,7 +324,17 @@ void Verlet::run(int n)
 
     nflag = neighbor->decide();
 
-    if (nflag == 0) {
+    // split pair compute on steps without reneighboring or energy/virial
+    // interior atoms are computed while first ghost swaps are in flight
+
+    splitflag = overlap && nflag == 0 && !eflag && !vflag &&
+      force->pair->split_allowed();
+
+    if (splitflag) {
+      timer->stamp();
+      comm->forward_comm_start();
+      timer->stamp(TIME_COMM);
+    } else if (nflag == 0) {
       timer->stamp();
       comm->forward_comm();
       timer->stamp(TIME_COMM);
@@ -326,6 +362,7 @@ void Verlet::run(int n)
       if (n_pre_neighbor) modify->pre_neighbor();
       
       neighbor->build();
+      if (overlap) force->pair->split_neighbor_list();
       timer->stamp(TIME_NEIGHBOR);
     }
 
@@ -335,12 +372,22 @@ void Verlet::run(int n)
     // and Pair:ev_tally() needs to be called before any tallying
 
     force_clear();
+
+    if (splitflag) {
+      timer->stamp();
+      force->pair->compute_split(eflag,vflag,0);
+      timer->stamp(TIME_PAIR);
+      comm->forward_comm_finish();
+      timer->stamp(TIME_COMM);
+    }
+
     if (n_pre_force) modify->pre_force(vflag);
 
     timer->stamp();
 
     if (pair_compute_flag) {
-      force->pair->compute(eflag,vflag);
+      if (splitflag) force->pair->compute_split(eflag,vflag,1);
+      else force->pair->compute(eflag,vflag);
       timer->stamp(TIME_PAIR);
     }
 
@@ -76,6 +76,7 @@ class Verlet : public Integrate {
   int triclinic;                    // 0 if domain is orthog, 1 if triclinic
   int torqueflag,erforceflag;
   int e_flag,rho_flag;
+  int overlap;                      // 1 if forward comm overlaps pair compute
 
   void force_clear();
 };
@@ -92,4 +93,10 @@ W: No fixes defined, atoms won't move
 If you are not using a fix like nve, nvt, npt then atom velocities and
 coordinates will not be updated during timestepping.
 
+W: Communicate overlap is not supported by pair style or fixes, using regular forward communication
+
+The communicate overlap option requires a pair style that can compute
+interior and boundary atoms separately, e.g. the granular pair styles,
+and only fixes whose pre_force() step is independent of pair forces.
+
 */